@@ -0,0 +1,109 @@
+// Compares the default median split along the longest axis with the
+// SAH-driven choice of the split axis, on ray and distance queries.
+// Compile with CGAL_PROFILE defined to get the number of nodes visited.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+void run_queries(const Tree& tree,
+                 const std::vector<Ray>& rays,
+                 const std::vector<Point>& points)
+{
+  CGAL::Real_timer time;
+  time.start();
+  std::size_t nb_hits = 0;
+  for(const Ray& r : rays)
+    if(tree.first_intersected_primitive(r))
+      ++nb_hits;
+  time.stop();
+  std::cout << "  " << rays.size() << " first_intersection(): " << time.time()
+            << " (" << nb_hits << " hits)\n";
+
+  time.reset();
+  time.start();
+  std::size_t nb_inter = 0;
+  for(const Ray& r : rays)
+    nb_inter += tree.number_of_intersected_primitives(r);
+  time.stop();
+  std::cout << "  " << rays.size() << " number_of_intersected_primitives(): " << time.time()
+            << " (" << nb_inter << " intersections)\n";
+
+  time.reset();
+  time.start();
+  for(const Point& p : points)
+    tree.closest_point(p);
+  time.stop();
+  std::cout << "  " << points.size() << " closest_point(): " << time.time() << "\n";
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::size_t nb_queries = (argc > 2) ? std::stoul(argv[2]) : 100000;
+
+  Mesh tm;
+  if(!CGAL::IO::read_polygon_mesh(filename, tm))
+  {
+    std::cerr << "Cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(tm) << " faces" << std::endl;
+
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(tm.points().begin(), tm.points().end());
+  CGAL::Random rng(0);
+  std::vector<Ray> rays;
+  std::vector<Point> points;
+  for(std::size_t i=0; i<nb_queries; ++i)
+  {
+    const Point p(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    points.push_back(p);
+    rays.emplace_back(p, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+  }
+
+  {
+    std::cout << "Median split along the longest axis\n";
+    Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+    CGAL::Real_timer time;
+    time.start();
+    tree.build();
+    tree.accelerate_distance_queries();
+    time.stop();
+    std::cout << "  build() time: " << time.time() << "\n";
+    run_queries(tree, rays, points);
+  }
+
+  {
+    std::cout << "Median split along the axis chosen with the SAH\n";
+    Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+    CGAL::Real_timer time;
+    time.start();
+    tree.custom_build(tree.traits().compute_bbox_object(),
+                      tree.traits().sah_split_primitives_object());
+    tree.accelerate_distance_queries();
+    time.stop();
+    std::cout << "  custom_build() time: " << time.time() << "\n";
+    run_queries(tree, rays, points);
+  }
+
+  return EXIT_SUCCESS;
+}
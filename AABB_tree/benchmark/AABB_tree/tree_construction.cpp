@@ -7,6 +7,7 @@
 #include <CGAL/Polygon_mesh_processing/bbox.h>
 
 #include <CGAL/Timer.h>
+#include <CGAL/Real_timer.h>
 
 #include <iostream>
 #include <fstream>
@@ -82,6 +83,25 @@ void run(std::string input)
   std::cout << "  build() time: " << time.time() << "\n";
   }
 
+  {
+  Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+  CGAL::Real_timer time; // wall-clock time, as the construction is multi-threaded
+  time.start();
+  tree.template build<CGAL::Parallel_if_available_tag>();
+  time.stop();
+  std::cout << "  build<Parallel_if_available_tag>() time: " << time.time() << "\n";
+  }
+
+  {
+  Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+  tree.build();
+  CGAL::Timer time;
+  time.start();
+  tree.refit(); // the vertices did not move, only the cost of the update is measured
+  time.stop();
+  std::cout << "  refit() time: " << time.time() << "\n";
+  }
+
   {
   Tree tree(faces(tm).begin(), faces(tm).end(), tm);
   CGAL::Timer time;
@@ -24,9 +24,9 @@
 #include <CGAL/AABB_tree/internal/AABB_traits_base.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Is_ray_intersection_geomtraits.h>
+#include <CGAL/AABB_tree/internal/Precomputed_ray.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
 #include <CGAL/AABB_tree/internal/Remove_optional.h>
-#include <CGAL/Kernel_23/internal/Has_boolean_tags.h>
 #include <CGAL/Search_traits_2.h>
 #include <optional>
 
@@ -115,6 +115,13 @@ public:
       else
         return t_near;
     }
+
+    // Data of a ray computed once per query rather than once per box.
+    typedef internal::AABB_tree::Precomputed_ray<GeomTraits, 2> Precomputed_ray;
+
+    std::optional<FT> operator()(const Precomputed_ray& ray, const Bounding_box& bbox) const {
+      return ray.intersection_distance(bbox);
+    }
   };
 
   Intersection_distance intersection_distance_object() const { return Intersection_distance(); }
@@ -393,25 +400,21 @@ public:
       typedef typename AT::FT FT;
       typedef typename AT::Primitive Primitive;
   public:
-      CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound, Tag_true) const
-      {
-          return GeomTraits().do_intersect_2_object()
-          (GeomTraits().construct_circle_2_object()
-           (p, GeomTraits().compute_squared_distance_2_object()(p, bound)), bb,true)?
-          CGAL::SMALLER : CGAL::LARGER;
-      }
-
-      CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound, Tag_false) const
-      {
-          return GeomTraits().do_intersect_2_object()
-          (GeomTraits().construct_circle_2_object()
-           (p, GeomTraits().compute_squared_distance_2_object()(p, bound)), bb)?
-          CGAL::SMALLER : CGAL::LARGER;
-      }
-
+      // `do_intersect(Circle_2, Bbox_2)` is false for a box lying inside the circle,
+      // so the box has to be compared with the disk bounded by the circle here
       CGAL::Comparison_result operator()(const Point& p, const Bounding_box& bb, const Point& bound) const
       {
-        return (*this)(p, bb, bound, Boolean_tag<internal::Has_static_filters<GeomTraits>::value>());
+        const FT sq_radius = GeomTraits().compute_squared_distance_2_object()(p, bound);
+        FT sq_distance = FT(0);
+        if(p.x() < bb.xmin())
+          sq_distance += CGAL::square(FT(bb.xmin()) - p.x());
+        else if(p.x() > bb.xmax())
+          sq_distance += CGAL::square(p.x() - FT(bb.xmax()));
+        if(p.y() < bb.ymin())
+          sq_distance += CGAL::square(FT(bb.ymin()) - p.y());
+        else if(p.y() > bb.ymax())
+          sq_distance += CGAL::square(p.y() - FT(bb.ymax()));
+        return (sq_distance <= sq_radius) ? CGAL::SMALLER : CGAL::LARGER;
       }
 
       // The following functions seem unused...?
@@ -24,11 +24,14 @@
 #include <CGAL/AABB_tree/internal/AABB_traits_base.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Is_ray_intersection_geomtraits.h>
+#include <CGAL/AABB_tree/internal/Precomputed_ray.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
 #include <CGAL/AABB_tree/internal/Remove_optional.h>
 #include <CGAL/Kernel_23/internal/Has_boolean_tags.h>
 #include <CGAL/Search_traits_3.h>
 
+#include <array>
+#include <limits>
 #include <optional>
 
 /// \file AABB_traits_3.h
@@ -119,6 +122,13 @@ public:
       else
         return t_near;
     }
+
+    // Data of a ray computed once per query rather than once per box.
+    typedef internal::AABB_tree::Precomputed_ray<GeomTraits, 3> Precomputed_ray;
+
+    std::optional<FT> operator()(const Precomputed_ray& ray, const Bounding_box& bbox) const {
+      return ray.intersection_distance(bbox);
+    }
   };
 
   Intersection_distance intersection_distance_object() const { return Intersection_distance(); }
@@ -265,25 +275,108 @@ public:
                     PrimitiveIterator beyond,
                     const typename AT::Bounding_box& bbox) const
       {
-        PrimitiveIterator middle = first + (beyond - first)/2;
-        switch(Traits::longest_axis(bbox))
+        Traits::median_split(first, beyond, Traits::longest_axis(bbox), m_traits);
+      }
+  };
+
+  Split_primitives split_primitives_object() const {return Split_primitives(*this);}
+
+  /// \brief Function object sorting a range of primitives like `Split_primitives`,
+  /// the axis being chosen with a binned surface area heuristic (SAH).
+  ///
+  /// As the tree is balanced, the range is always split at its median.
+  /// For each axis, the primitives are binned according to the coordinate of their
+  /// reference point, which is also the key used to split the range, and the cost of
+  /// the split is estimated as the sum of the areas of the bounding boxes of both halves,
+  /// weighted by their number of primitives. The axis with the lowest cost is used.
+  /// Compared to the longest axis rule, this gives less overlapping boxes when the sizes
+  /// of the primitives vary a lot, at the price of a slower construction.
+  ///
+  /// It is used by the trees whose traits class is wrapped by `AABB_traits_with_SAH_split`,
+  /// and can also be passed to `AABB_tree::custom_build()`, together with `Compute_bbox`.
+  class SAH_split_primitives
+  {
+    typedef AABB_traits_3<GeomTraits,AABBPrimitive,BboxMap> Traits;
+    const Traits& m_traits;
+
+    static constexpr int nb_bins = 16;
+
+    static double half_area(const Bounding_box& bb)
+    {
+      if(bb.xmin() > bb.xmax())
+        return 0.;
+      const double dx = bb.xmax() - bb.xmin();
+      const double dy = bb.ymax() - bb.ymin();
+      const double dz = bb.zmax() - bb.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    }
+
+  public:
+    SAH_split_primitives(const AABB_traits_3<GeomTraits,AABBPrimitive,BboxMap>& traits)
+      : m_traits(traits) {}
+
+    typedef void result_type;
+    template<typename PrimitiveIterator>
+    void operator()(PrimitiveIterator first,
+                    PrimitiveIterator beyond,
+                    const typename AT::Bounding_box& bbox) const
+      {
+        const std::size_t size = static_cast<std::size_t>(beyond - first);
+
+        std::array<Bounding_box, 3*nb_bins> bin_bboxes;
+        std::array<std::size_t, 3*nb_bins> bin_sizes;
+        bin_sizes.fill(0);
+        for(PrimitiveIterator it = first; it != beyond; ++it)
         {
-        case AT::CGAL_AXIS_X: // sort along x
-          std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_x(p1, p2, this->m_traits); });
-          break;
-        case AT::CGAL_AXIS_Y: // sort along y
-          std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_y(p1, p2, this->m_traits); });
-          break;
-        case AT::CGAL_AXIS_Z: // sort along z
-          std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_z(p1, p2, this->m_traits); });
-          break;
-        default:
-          CGAL_error();
+          const Bounding_box pr_bbox = m_traits.compute_bbox(*it, m_traits.bbm);
+          // the bins are sorted along each axis like the reference points by `median_split()`
+          Cartesian_const_iterator_3 coord = GeomTraits().construct_cartesian_const_iterator_3_object()(
+                                               internal::Primitive_helper<AT>::get_reference_point(*it, m_traits));
+          for(int i=0; i<3; ++i, ++coord)
+          {
+            const double extent = (bbox.max)(i) - (bbox.min)(i);
+            int b = 0;
+            if(extent > 0)
+            {
+              b = static_cast<int>(nb_bins * (CGAL::to_double(*coord) - (bbox.min)(i)) / extent);
+              b = (std::min)((std::max)(b, 0), nb_bins-1);
+            }
+            bin_bboxes[i*nb_bins+b] += pr_bbox;
+            ++bin_sizes[i*nb_bins+b];
+          }
         }
+
+        Axis best_axis = Traits::longest_axis(bbox);
+        double best_cost = (std::numeric_limits<double>::max)();
+        for(int i=0; i<3; ++i)
+        {
+          // the left half gathers the bins before the median
+          Bounding_box left_bbox, right_bbox;
+          std::size_t left_size = 0;
+          int b = 0;
+          for(; b<nb_bins && 2*(left_size + bin_sizes[i*nb_bins+b]) <= size; ++b)
+          {
+            left_bbox += bin_bboxes[i*nb_bins+b];
+            left_size += bin_sizes[i*nb_bins+b];
+          }
+          for(; b<nb_bins; ++b)
+            right_bbox += bin_bboxes[i*nb_bins+b];
+
+          const double cost = half_area(left_bbox) * double(left_size)
+                            + half_area(right_bbox) * double(size - left_size);
+          if(cost < best_cost)
+          {
+            best_cost = cost;
+            best_axis = Axis(i);
+          }
+        }
+
+        Traits::median_split(first, beyond, best_axis, m_traits);
       }
   };
 
-  Split_primitives split_primitives_object() const {return Split_primitives(*this);}
+  /// returns the function object sorting the primitives with the surface area heuristic
+  SAH_split_primitives sah_split_primitives_object() const {return SAH_split_primitives(*this);}
 
 
   /*
@@ -468,6 +561,30 @@ private:
     return internal::Primitive_helper<AT>::get_datum(pr,*this).bbox();
   }
 
+  // Partitions [first,beyond[ around its median along `axis`
+  template<typename PrimitiveIterator>
+  static void median_split(PrimitiveIterator first,
+                           PrimitiveIterator beyond,
+                           const Axis axis,
+                           const AABB_traits_3<GeomTraits,AABBPrimitive, BboxMap>& traits)
+  {
+    PrimitiveIterator middle = first + (beyond - first)/2;
+    switch(axis)
+    {
+    case CGAL_AXIS_X: // sort along x
+      std::nth_element(first, middle, beyond, [&traits](const Primitive& p1, const Primitive& p2){ return less_x(p1, p2, traits); });
+      break;
+    case CGAL_AXIS_Y: // sort along y
+      std::nth_element(first, middle, beyond, [&traits](const Primitive& p1, const Primitive& p2){ return less_y(p1, p2, traits); });
+      break;
+    case CGAL_AXIS_Z: // sort along z
+      std::nth_element(first, middle, beyond, [&traits](const Primitive& p1, const Primitive& p2){ return less_z(p1, p2, traits); });
+      break;
+    default:
+      CGAL_error();
+    }
+  }
+
   /// Comparison functions
   static bool less_x(const Primitive& pr1, const Primitive& pr2,const AABB_traits_3<GeomTraits,AABBPrimitive, BboxMap>& traits)
   {
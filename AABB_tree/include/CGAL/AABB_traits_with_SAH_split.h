@@ -0,0 +1,59 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_AABB_TRAITS_WITH_SAH_SPLIT_H
+#define CGAL_AABB_TRAITS_WITH_SAH_SPLIT_H
+
+#include <CGAL/license/AABB_tree.h>
+
+namespace CGAL {
+
+/// \ingroup PkgAABBTreeRef
+///
+/// This class wraps a traits class of `AABB_tree` so that the tree chooses the split axis
+/// of each of its nodes with the binned surface area heuristic of `AABB_traits_3::SAH_split_primitives`
+/// instead of the longest axis of the bounding box of the node. This applies to `AABB_tree::build()`
+/// and to the subtrees reconstructed by `AABB_tree::refit()`.
+///
+/// It can itself be wrapped by `AABB_traits_with_compressed_nodes` or `AABB_traits_with_wide_nodes`.
+///
+/// \tparam AABBTraits a model of `AABBTraits` providing the nested type `SAH_split_primitives`
+///                    and the member function `sah_split_primitives_object()`, for example `AABB_traits_3`.
+///
+/// \cgalModels{AABBTraits}
+///
+/// \sa `AABB_tree`
+/// \sa `AABB_traits_3::SAH_split_primitives`
+template <typename AABBTraits>
+class AABB_traits_with_SAH_split
+  : public AABBTraits
+{
+public:
+  /// the function object used by `AABB_tree` to split the range of primitives of a node
+  typedef typename AABBTraits::SAH_split_primitives Split_primitives;
+
+  /// constructors of `AABBTraits`
+  using AABBTraits::AABBTraits;
+
+  /// constructor from the wrapped traits
+  AABB_traits_with_SAH_split(const AABBTraits& traits)
+    : AABBTraits(traits)
+  {}
+
+  /// returns `AABBTraits::sah_split_primitives_object()`
+  Split_primitives split_primitives_object() const { return this->sah_split_primitives_object(); }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_AABB_TRAITS_WITH_SAH_SPLIT_H
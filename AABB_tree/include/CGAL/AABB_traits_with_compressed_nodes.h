@@ -0,0 +1,61 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_AABB_TRAITS_WITH_COMPRESSED_NODES_H
+#define CGAL_AABB_TRAITS_WITH_COMPRESSED_NODES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/tags.h>
+
+namespace CGAL {
+
+/// \ingroup PkgAABBTreeRef
+///
+/// This class wraps a traits class of `AABB_tree` so that each node of the tree
+/// stores its bounding box with single precision coordinates instead of double precision ones.
+/// The coordinates are rounded outwards, so that the box stored contains the exact one:
+/// the boxes are only used to discard nodes and the intersection and distance computations
+/// done on primitives are not affected. The nodes of a tree in 3D are then 40 bytes long instead of 64.
+/// The coordinates are not quantized relative to the box of the parent node, as the box of
+/// a node is read without the one of its parent by the traversals.
+///
+/// As the bounding box returned by `AABB_tree::bbox()` is the one of the root node,
+/// it might be slightly larger than the exact bounding box of the primitives.
+///
+/// \tparam AABBTraits a model of `AABBTraits` whose `Bounding_box` type is `Bbox_2` or `Bbox_3`,
+///                    for example `AABB_traits_3`.
+///
+/// \cgalModels{AABBTraits}
+///
+/// \sa `AABB_tree`
+template <typename AABBTraits>
+class AABB_traits_with_compressed_nodes
+  : public AABBTraits
+{
+public:
+  /// the tag used by `AABB_tree` to select the storage of the bounding boxes of its nodes
+  typedef Tag_true Compressed_node_bbox;
+
+  /// constructors of `AABBTraits`
+  using AABBTraits::AABBTraits;
+
+  /// constructor from the wrapped traits
+  AABB_traits_with_compressed_nodes(const AABBTraits& traits)
+    : AABBTraits(traits)
+  {}
+};
+
+} // namespace CGAL
+
+#endif // CGAL_AABB_TRAITS_WITH_COMPRESSED_NODES_H
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_AABB_TRAITS_WITH_WIDE_NODES_H
+#define CGAL_AABB_TRAITS_WITH_WIDE_NODES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <type_traits>
+
+namespace CGAL {
+
+/// \ingroup PkgAABBTreeRef
+///
+/// This class wraps a traits class of `AABB_tree` so that the tree also stores its hierarchy
+/// with nodes having up to `arity` children, obtained by collapsing levels of the binary hierarchy.
+/// The bounding boxes of the children of a node are stored together, axis by axis, with single
+/// precision coordinates rounded outwards, and a ray is tested against all of them at once,
+/// with AVX or SSE2 instructions when they are available.
+///
+/// This layout is used by the queries with a ray: `AABB_tree::first_intersection()`,
+/// `AABB_tree::first_intersected_primitive()`, `AABB_tree::do_intersect()`,
+/// `AABB_tree::any_intersection()`, `AABB_tree::any_intersected_primitive()`,
+/// `AABB_tree::all_intersections()`, `AABB_tree::all_intersected_primitives()`,
+/// `AABB_tree::number_of_intersected_primitives()`, and the batched versions of the first ones.
+/// The other queries use the binary hierarchy. The boxes only conservatively discard nodes and
+/// primitives, and the intersections are computed on the primitives by the wrapped traits:
+/// the answers are the same as with the binary hierarchy, up to the choice among several
+/// first intersections.
+///
+/// The wide hierarchy is built along with the binary one, and is updated by `AABB_tree::refit()`.
+///
+/// \tparam AABBTraits a model of `AABBRayIntersectionTraits` whose `Bounding_box` type is `Bbox_2` or `Bbox_3`
+///                    and whose number type `FT` is `double`, for example `AABB_traits_3<Exact_predicates_inexact_constructions_kernel, Primitive>`.
+/// \tparam arity the maximal number of children of a node, which must be 4 or 8.
+///
+/// \cgalModels{AABBTraits}
+///
+/// \sa `AABB_tree`
+/// \sa `AABB_traits_with_compressed_nodes`
+template <typename AABBTraits, int arity = 4>
+class AABB_traits_with_wide_nodes
+  : public AABBTraits
+{
+  static_assert(arity == 4 || arity == 8, "The nodes of the wide hierarchy have 4 or 8 children");
+  static_assert(std::is_same<typename AABBTraits::FT, double>::value,
+                "The wide hierarchy requires a traits class with double coordinates");
+
+public:
+  /// the constant used by `AABB_tree` to select the arity of the nodes of its wide hierarchy
+  typedef std::integral_constant<int, arity> Wide_node_arity;
+
+  /// constructors of `AABBTraits`
+  using AABBTraits::AABBTraits;
+
+  /// constructor from the wrapped traits
+  AABB_traits_with_wide_nodes(const AABBTraits& traits)
+    : AABBTraits(traits)
+  {}
+};
+
+} // namespace CGAL
+
+#endif // CGAL_AABB_TRAITS_WITH_WIDE_NODES_H
@@ -19,19 +19,44 @@
 
 #include <CGAL/disable_warnings.h>
 
+#include <array>
 #include <vector>
 #include <iterator>
 #include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
 #include <CGAL/AABB_tree/internal/AABB_node.h>
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
+#include <CGAL/AABB_tree/internal/AABB_wide_node.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/tags.h>
+#include <CGAL/Dimension.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/property_map.h>
+#include <boost/iterator/function_output_iterator.hpp>
+#include <boost/property_map/function_property_map.hpp>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <numeric>
 #include <optional>
+#include <type_traits>
 
 #ifdef CGAL_HAS_THREADS
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -145,6 +170,19 @@ namespace CGAL {
     /// primitives of the tree.
     template<typename ... T>
     void build(T&& ...);
+
+    /// triggers the (re)construction of the internal tree structure, similarly to `build()`.
+    /// If `ConcurrencyTag` is `Parallel_tag`, the top levels of the hierarchy are split
+    /// in parallel tasks and the bounding boxes of large groups of primitives are computed
+    /// with a parallel reduction. The tree obtained is identical to the one built sequentially.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \warning The functors `Compute_bbox` and `Split_primitives` of the traits are called
+    /// concurrently on disjoint ranges of primitives when `ConcurrencyTag` is `Parallel_tag`.
+    template <typename ConcurrencyTag>
+    void build();
 #ifndef DOXYGEN_RUNNING
     void build();
 
@@ -154,7 +192,77 @@ namespace CGAL {
     template <class ComputeBbox, class SplitPrimitives>
     void custom_build(const ComputeBbox& compute_bbox,
                       const SplitPrimitives& split_primitives);
+
+    /// same as above, with the concurrency of the construction selected by `ConcurrencyTag`.
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void custom_build(const ComputeBbox& compute_bbox,
+                      const SplitPrimitives& split_primitives);
 #endif
+
+    /// updates the bounding boxes of the nodes of the tree, from the leaves to the root,
+    /// after the geometry of the primitives has changed (for example, after the vertices
+    /// of the underlying mesh have been moved) while the set of primitives is unchanged.
+    /// The hierarchy itself is kept: this is much faster than `build()` since primitives are
+    /// not sorted again, but queries become slower if the primitives have moved a lot.
+    /// If primitives have been inserted since the last construction of the tree, `build<ConcurrencyTag>()`
+    /// is called instead.
+    ///
+    /// The internal KD-tree built from the reference points of the primitives is cleared, and it is
+    /// lazily reconstructed upon the next distance query. A KD-tree built from the points given to
+    /// `accelerate_distance_queries(first,beyond)` is kept: if these points no longer lie on
+    /// the primitives, `accelerate_distance_queries(first,beyond)` must be called again with updated points.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel update of the bounding boxes.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \pre The primitives compute their datum from the current geometry, that is they do not store
+    /// a copy of it (e.g., `CacheDatum` is `Tag_false` for `AABB_face_graph_triangle_primitive`).
+    template <typename ConcurrencyTag = Sequential_tag>
+    void refit();
+
+    /// same as `refit()`, then reconstructs the subtrees whose hierarchy is of poor quality.
+    /// The tree is traversed from the root, and the subtree of a node is reconstructed, using the
+    /// functors `Compute_bbox` and `Split_primitives` of the traits, if the bounding boxes of its
+    /// two children overlap on more than the fraction `max_overlap` of the bounding box of the node
+    /// (the measure of a box being the product of its non-zero extents).
+    /// Only the primitives of the reconstructed subtrees are sorted again.
+    ///
+    /// \returns the number of reconstructed subtrees.
+    /// \pre `0 <= max_overlap <= 1`
+    template <typename ConcurrencyTag = Sequential_tag>
+    std::size_t refit(double max_overlap);
+
+    /// writes the structure of the tree into the output stream `os` in a binary format,
+    /// so that the same tree can later be reconstructed by `read_structure()` without
+    /// sorting the primitives again. The hierarchy of the tree is entirely given by the order of its
+    /// primitives, which is written together with the structure of the internal KD-tree if
+    /// it is constructed from the primitives. Neither the primitives nor the bounding boxes
+    /// are written. The tree is built if it was not.
+    ///
+    /// The data is written in the native byte order of the machine, and it can only be read
+    /// on a platform with the same byte order.
+    ///
+    /// \tparam PrimitiveIndexMap a model of `ReadablePropertyMap` with key type `Primitive::Id`
+    ///         and value type `std::size_t`, giving the position of each primitive in the sequence
+    ///         of primitives inserted in the tree.
+    template <typename PrimitiveIndexMap>
+    std::ostream& write_structure(std::ostream& os, const PrimitiveIndexMap& index_map) const;
+
+    /// reads the structure of a tree written by `write_structure()` from the input stream `is`
+    /// and uses it as the structure of this tree. The bounding boxes of the nodes
+    /// are recomputed from the primitives as in `refit()`, and the internal KD-tree
+    /// is reconstructed without sorting its points again if its structure was written.
+    ///
+    /// \returns `false`, leaving the tree unchanged, if the structure read does not
+    ///          correspond to the primitives of this tree.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel computation of the bounding boxes.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \pre The primitives of this tree are the primitives of the tree written, inserted in the same
+    /// order, and the tree has not been built since their insertion.
+    template <typename ConcurrencyTag = Sequential_tag>
+    bool read_structure(std::istream& is);
     ///@}
 
     /// \name Operations
@@ -228,8 +336,9 @@ namespace CGAL {
       set_primitive_data_impl(CGAL::Boolean_tag<internal::Has_nested_type_Shared_data<Primitive>::value>(),std::forward<T>(t)...);
     }
 
+    template <typename ConcurrencyTag = Sequential_tag>
     bool build_kd_tree();
-    template<typename ConstPointIterator>
+    template<typename ConcurrencyTag = Sequential_tag, typename ConstPointIterator>
     bool build_kd_tree(ConstPointIterator first, ConstPointIterator beyond);
 public:
 
@@ -379,6 +488,73 @@ public:
 
     ///@}
 
+    /// \name Batched Queries
+    /// The following functions answer many independent queries in a single call.
+    /// The query points of distance queries are processed in the order of a Hilbert curve,
+    /// so that consecutive queries are close to one another: the result of a query is used
+    /// as hint for the next one, and the internal KD-tree is only queried once per group of queries.
+    /// The results are output in the order of the input range.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel processing of the queries.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///         If it is `Parallel_tag`, the output is identical to the sequential one up to
+    ///         the choice among several closest points or first intersections.
+    ///@{
+
+    /// puts in `out` the result of `closest_point(q)` for each point `q` of `queries`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting objects of type `Point`
+    /// \pre `!empty()`
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points(const PointRange& queries, OutputIterator out) const;
+
+    /// puts in `out` the result of `closest_point_and_primitive(q)` for each point `q` of `queries`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting objects of type `Point_and_primitive_id`
+    /// \pre `!empty()`
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points_and_primitives(const PointRange& queries, OutputIterator out) const;
+
+    /// puts in `out` the result of `first_intersection(r)` for each ray `r` of `rays`.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray`
+    /// \tparam OutputIterator an output iterator accepting objects of type
+    /// `std::optional<Intersection_and_primitive_id<AABBTraits::Ray>::%Type>`
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template <typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+    OutputIterator first_intersections(const RayRange& rays, OutputIterator out) const;
+
+    /// puts in `out` the result of `first_intersected_primitive(r)` for each ray `r` of `rays`.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray`
+    /// \tparam OutputIterator an output iterator accepting objects of type `std::optional<Primitive_id>`
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template <typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+    OutputIterator first_intersected_primitives(const RayRange& rays, OutputIterator out) const;
+
+    ///@}
+
+  private:
+    // returns the indices of `points` sorted along a Hilbert curve
+    template <typename ConcurrencyTag>
+    std::vector<std::size_t> hilbert_order(const std::vector<Point>& points) const;
+
+    // calls `f(first, beyond)` on consecutive blocks of [0, n[, concurrently if
+    // `ConcurrencyTag` is `Parallel_tag`
+    template <typename Function>
+    static void for_each_block(const std::size_t n, const Function& f, const Sequential_tag&);
+#ifdef CGAL_LINKED_WITH_TBB
+    template <typename Function>
+    static void for_each_block(const std::size_t n, const Function& f, const Parallel_tag&);
+
+    // number of consecutive batched queries handled by one task
+    static constexpr std::size_t batch_grain_size = 256;
+#endif
+
+  public:
+
     /// \name Accelerating the Distance Queries
     ///
     /// In the following paragraphs, we discuss details of the
@@ -440,6 +616,14 @@ public:
     /// a point set taken on the internal primitives
     /// returns `true` iff successful memory allocation
     bool accelerate_distance_queries();
+
+    /// same as `accelerate_distance_queries()`, the internal KD-tree being
+    /// constructed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    template <typename ConcurrencyTag>
+    bool accelerate_distance_queries();
+
     /// turns off the usage of the internal search tree and clears it if it was already constructed.
     void do_not_accelerate_distance_queries();
 
@@ -486,6 +670,7 @@ public:
     void clear_nodes()
     {
       m_nodes.clear();
+      m_wide_nodes.clear();
     }
 
     // clears internal KD tree
@@ -513,6 +698,7 @@ public:
     template <class Query, class Traversal_traits>
     void traversal(const Query& query, Traversal_traits& traits) const
     {
+      CGAL_PROFILER("[AABB_tree] traversals");
       switch(size())
       {
       case 0:
@@ -528,6 +714,7 @@ public:
     template <class Query, class Traversal_traits>
     void traversal_with_priority(const Query& query, Traversal_traits& traits) const
     {
+      CGAL_PROFILER("[AABB_tree] traversals with priority");
       switch(size())
       {
       case 0:
@@ -543,6 +730,7 @@ public:
     template <class Query, class Traversal_traits>
     void traversal_with_priority_and_group_traversal(const Query& query, Traversal_traits& traits, const std::size_t group_traversal_bound) const
     {
+      CGAL_PROFILER("[AABB_tree] traversals with priority and group traversal");
       switch(size())
       {
       case 0:
@@ -558,6 +746,41 @@ public:
   private:
     typedef AABB_node<AABBTraits> Node;
 
+    // maximal number of children of the nodes of the wide hierarchy, 0 if the tree has none
+    static constexpr int wide_node_arity = internal::AABB_tree::Wide_node_arity<AABBTraits>::value;
+    static constexpr bool uses_wide_nodes = (wide_node_arity > 0);
+    typedef internal::AABB_tree::AABB_wide_node<Bounding_box::Ambient_dimension::value,
+                                                (uses_wide_nodes ? wide_node_arity : 2)> Wide_node;
+
+    // builds the wide hierarchy from the binary one
+    void build_wide_nodes();
+
+    // builds the wide node collapsing the subtree of `node`, whose `range` primitives
+    // start at the primitive of index `first`, and returns its index
+    std::size_t build_wide_node(const Node& node,
+                                const std::size_t first,
+                                const std::size_t range);
+
+    // same as `traversal()` with a ray, the wide hierarchy being traversed
+    template <class Ray, class Traversal_traits>
+    void wide_traversal(const Ray& query, Traversal_traits& traits) const;
+
+    // calls `wide_traversal()` if the tree has a wide hierarchy and `query` is a ray,
+    // and `traversal()` otherwise
+    template <class Query, class Traversal_traits>
+    void intersection_traversal(const Query& query, Traversal_traits& traits) const
+    {
+      if constexpr(uses_wide_nodes)
+      {
+        if constexpr(std::is_same<Query, typename AABBTraits::Ray>::value)
+        {
+          wide_traversal(query, traits);
+          return;
+        }
+      }
+      traversal(query, traits);
+    }
+
     /**
      * @brief Builds the tree by recursive expansion.
      * @param node the root node of the subtree to generate
@@ -568,6 +791,9 @@ public:
      * @param split_primitives a functor
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * The `range-1` nodes of the subtree are stored contiguously in `m_nodes`
+     * starting at `node` (in depth-first order), so that independent subtrees
+     * can be filled concurrently without any synchronization.
      */
     template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
     void expand(Node& node,
@@ -575,7 +801,63 @@ public:
                 ConstPrimitiveIterator beyond,
                 const std::size_t range,
                 const ComputeBbox& compute_bbox,
-                const SplitPrimitives& split_primitives);
+                const SplitPrimitives& split_primitives,
+                const Sequential_tag&);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    void expand(Node& node,
+                ConstPrimitiveIterator first,
+                ConstPrimitiveIterator beyond,
+                const std::size_t range,
+                const ComputeBbox& compute_bbox,
+                const SplitPrimitives& split_primitives,
+                const Parallel_tag&);
+
+    // Below this number of primitives, subtrees are built sequentially
+    static constexpr std::size_t parallel_build_threshold = 4096;
+#endif
+
+    // recomputes the bounding boxes of the subtree of `node`, whose `range`
+    // primitives start at `first`, keeping the children of each node
+    void refit_node(Node& node,
+                    typename Primitives::iterator first,
+                    const std::size_t range,
+                    const Sequential_tag&);
+
+    // reconstructs the subtrees of poor quality, returns their number
+    std::size_t rebuild_overlapping_subtrees(Node& node,
+                                             typename Primitives::iterator first,
+                                             const std::size_t range,
+                                             const double max_overlap,
+                                             const Sequential_tag&);
+#ifdef CGAL_LINKED_WITH_TBB
+    void refit_node(Node& node,
+                    typename Primitives::iterator first,
+                    const std::size_t range,
+                    const Parallel_tag&);
+
+    std::size_t rebuild_overlapping_subtrees(Node& node,
+                                             typename Primitives::iterator first,
+                                             const std::size_t range,
+                                             const double max_overlap,
+                                             const Parallel_tag&);
+#endif
+
+    // sets the children of the nodes of the subtree of `node`, whose `range`
+    // primitives start at `first`, as `expand()` does
+    void link_nodes(Node& node,
+                    typename Primitives::iterator first,
+                    const std::size_t range);
+
+    // signature of the binary format of `write_structure()`
+    static const char* structure_signature() { return "CGAL::AABB_tree 1"; }
+
+    // returns the measure of the intersection of `b1` and `b2` divided by the measure
+    // of `bbox`, ignoring the axes along which `bbox` is flat
+    static double overlap_ratio(const Bounding_box& b1,
+                                const Bounding_box& b2,
+                                const Bounding_box& bbox);
 
   public:
     // returns a point which must be on one primitive
@@ -629,6 +911,8 @@ public:
     Primitives m_primitives;
     // tree nodes. first node is the root node
     std::vector<Node> m_nodes;
+    // nodes of the wide hierarchy, if the traits ask for it. first node is the root node
+    std::vector<Wide_node> m_wide_nodes;
     #ifdef CGAL_HAS_THREADS
     mutable CGAL_MUTEX build_mutex; // mutex used to protect const calls inducing build() and build_kd_tree()
     #endif
@@ -650,12 +934,6 @@ public:
       }
       return std::addressof(m_nodes[0]);
     }
-
-    Node& new_node()
-    {
-      m_nodes.emplace_back();
-      return m_nodes.back();
-    }
   private:
     const Primitive& singleton_data() const {
       CGAL_assertion(size() == 1);
@@ -693,6 +971,7 @@ public:
     m_traits = std::move(tree.m_traits);
     m_primitives = std::move(tree.m_primitives);
     m_nodes = std::move(tree.m_nodes);
+    m_wide_nodes = std::move(tree.m_wide_nodes);
     m_p_search_tree = std::move(tree.m_p_search_tree);
     m_use_default_search_tree = std::exchange(tree.m_use_default_search_tree, true);
 #ifdef CGAL_HAS_THREADS
@@ -791,37 +1070,90 @@ public:
                         ConstPrimitiveIterator beyond,
                         const std::size_t range,
                         const ComputeBbox& compute_bbox,
-                        const SplitPrimitives& split_primitives)
+                        const SplitPrimitives& split_primitives,
+                        const Sequential_tag& tag)
   {
     node.set_bbox(compute_bbox(first, beyond));
 
     // sort primitives along longest axis aabb
     split_primitives(first, beyond, node.bbox());
 
+    // the left subtree (new_range primitives) uses the new_range-1 nodes following `node`
+    Node* p_node = std::addressof(node);
     switch(range)
     {
     case 2:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, p_node[1]);
+      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives, tag);
       break;
     default:
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      node.set_children(p_node[1], p_node[new_range]);
+      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives, tag);
+      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag);
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  void
+  AABB_tree<Tr>::expand(Node& node,
+                        ConstPrimitiveIterator first,
+                        ConstPrimitiveIterator beyond,
+                        const std::size_t range,
+                        const ComputeBbox& compute_bbox,
+                        const SplitPrimitives& split_primitives,
+                        const Parallel_tag& tag)
+  {
+    if(range < parallel_build_threshold)
+    {
+      expand(node, first, beyond, range, compute_bbox, split_primitives, Sequential_tag());
+      return;
+    }
+
+    // parallel reduction of the bounding box, the box of the first primitive
+    // being neutral for the union
+    const Bounding_box first_bbox = compute_bbox(first, first+1);
+    node.set_bbox(tbb::parallel_reduce(
+      tbb::blocked_range<ConstPrimitiveIterator>(first, beyond, parallel_build_threshold / 4),
+      first_bbox,
+      [&compute_bbox](const tbb::blocked_range<ConstPrimitiveIterator>& r, const Bounding_box& bbox)
+      {
+        return bbox + compute_bbox(r.begin(), r.end());
+      },
+      [](const Bounding_box& b1, const Bounding_box& b2) { return b1 + b2; }));
+
+    // sort primitives along longest axis aabb
+    split_primitives(first, beyond, node.bbox());
+
+    // both subtrees are large enough to be internal nodes (see the sequential version)
+    const std::size_t new_range = range/2;
+    Node* p_node = std::addressof(node);
+    node.set_children(p_node[1], p_node[new_range]);
+    tbb::parallel_invoke(
+      [&]{ expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives, tag); },
+      [&]{ expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag); });
+  }
+#endif
 
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
   void AABB_tree<Tr>::build()
   {
-    custom_build(m_traits.compute_bbox_object(),
-                 m_traits.split_primitives_object());
+    custom_build<Sequential_tag>(m_traits.compute_bbox_object(),
+                                 m_traits.split_primitives_object());
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::build()
+  {
+    custom_build<ConcurrencyTag>(m_traits.compute_bbox_object(),
+                                 m_traits.split_primitives_object());
   }
 #ifndef DOXYGEN_RUNNING
   // Build the data structure, after calls to insert(..)
@@ -831,19 +1163,35 @@ public:
     const ComputeBbox& compute_bbox,
     const SplitPrimitives& split_primitives)
   {
+    custom_build<Sequential_tag>(compute_bbox, split_primitives);
+  }
+
+  template<typename Tr>
+  template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+  void AABB_tree<Tr>::custom_build(
+    const ComputeBbox& compute_bbox,
+    const SplitPrimitives& split_primitives)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     clear_nodes();
 
     if(m_primitives.size() > 1) {
 
       // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+      m_nodes.resize(m_primitives.size()-1);
 
       // constructs the tree
-      expand(new_node(),
+      expand(m_nodes[0],
              m_primitives.begin(), m_primitives.end(),
              m_primitives.size(),
              compute_bbox,
-             split_primitives);
+             split_primitives,
+             ConcurrencyTag());
+      build_wide_nodes();
     }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
@@ -852,9 +1200,449 @@ public:
 #endif
   }
 #endif
+
+  template<typename Tr>
+  void
+  AABB_tree<Tr>::build_wide_nodes()
+  {
+    if constexpr(uses_wide_nodes)
+    {
+      m_wide_nodes.clear();
+      if(m_primitives.size() < 2)
+        return;
+      CGAL_precondition(m_primitives.size() <= (std::numeric_limits<typename Wide_node::Index>::max)());
+      m_wide_nodes.reserve(m_primitives.size() / (wide_node_arity - 1) + 1);
+      build_wide_node(m_nodes[0], 0, m_primitives.size());
+    }
+  }
+
+  template<typename Tr>
+  std::size_t
+  AABB_tree<Tr>::build_wide_node(const Node& node,
+                                 const std::size_t first,
+                                 const std::size_t range)
+  {
+    // a subtree of the binary hierarchy, which is a primitive if `range` is 1
+    struct Subtree
+    {
+      const Node* node;
+      std::size_t first;
+      std::size_t range;
+    };
+
+    // the children of a binary node, as built by `expand()`
+    const auto split = [](const Subtree& subtree, Subtree& left, Subtree& right)
+    {
+      const std::size_t new_range = subtree.range/2;
+      left = Subtree{ (new_range > 1) ? &(subtree.node->left_child()) : nullptr,
+                      subtree.first, new_range };
+      right = Subtree{ (subtree.range - new_range > 1) ? &(subtree.node->right_child()) : nullptr,
+                       subtree.first + new_range, subtree.range - new_range };
+    };
+
+    // the subtree with the most primitives is replaced by its two children
+    // until the node has as many children as possible
+    std::array<Subtree, wide_node_arity> children;
+    split(Subtree{ &node, first, range }, children[0], children[1]);
+    int nb_children = 2;
+    while(nb_children < wide_node_arity)
+    {
+      int largest = -1;
+      for(int c=0; c<nb_children; ++c)
+        if(children[c].range > 1 && (largest < 0 || children[c].range > children[largest].range))
+          largest = c;
+      if(largest < 0)
+        break;
+      const Subtree subtree = children[largest];
+      split(subtree, children[largest], children[nb_children++]);
+    }
+
+    const std::size_t index = m_wide_nodes.size();
+    m_wide_nodes.emplace_back();
+    const auto& compute_bbox = m_traits.compute_bbox_object();
+    for(int c=0; c<nb_children; ++c)
+    {
+      const Subtree& subtree = children[c];
+      if(subtree.range == 1)
+      {
+        const typename Primitives::const_iterator primitive = m_primitives.begin() + subtree.first;
+        m_wide_nodes[index].add_child(compute_bbox(primitive, primitive+1), subtree.first, true);
+      }
+      else
+      {
+        const std::size_t child = build_wide_node(*subtree.node, subtree.first, subtree.range);
+        m_wide_nodes[index].add_child(subtree.node->bbox(), child, false);
+      }
+    }
+    return index;
+  }
+
+  template<typename Tr>
+  template<class Ray, class Traversal_traits>
+  void
+  AABB_tree<Tr>::wide_traversal(const Ray& query, Traversal_traits& traits) const
+  {
+    CGAL_PROFILER("[AABB_tree] traversals of the wide hierarchy");
+    switch(size())
+    {
+    case 0:
+      break;
+    case 1:
+      traits.intersection(query, singleton_data());
+      break;
+    default: // if(size() >= 2)
+    {
+      root_node(); // triggers the build
+      const typename Tr::Intersection_distance::Precomputed_ray ray(query);
+
+      // the wide hierarchy is not deeper than the binary one, whose depth is
+      // at most 32 as the indices of the primitives have 32 bits
+      std::array<typename Wide_node::Index, 32 * (wide_node_arity - 1) + 1> stack;
+      std::size_t stack_size = 0;
+      stack[stack_size++] = 0;
+      std::array<double, wide_node_arity> t_entry;
+      while(stack_size > 0)
+      {
+        const Wide_node& node = m_wide_nodes[stack[--stack_size]];
+        CGAL_PROFILER("[AABB_tree] wide nodes visited by traversals");
+        const unsigned int hits = node.intersect(ray, t_entry);
+        for(int c=0; c<node.number_of_children(); ++c)
+        {
+          if((hits & (1u << c)) == 0)
+            continue;
+          if(node.is_leaf(c))
+          {
+            traits.intersection(query, m_primitives[node.child(c)]);
+            if(!traits.go_further())
+              return;
+          }
+          else
+          {
+            stack[stack_size++] = node.child(c);
+          }
+        }
+      }
+    }
+    }
+  }
+
+  template<typename Tr>
+  void
+  AABB_tree<Tr>::refit_node(Node& node,
+                            typename Primitives::iterator first,
+                            const std::size_t range,
+                            const Sequential_tag& tag)
+  {
+    const auto& compute_bbox = m_traits.compute_bbox_object();
+    switch(range)
+    {
+    case 2:
+      node.set_bbox(compute_bbox(first, first+2));
+      break;
+    case 3:
+      refit_node(node.right_child(), first+1, 2, tag);
+      node.set_bbox(compute_bbox(first, first+1) + node.right_child().bbox());
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      refit_node(node.left_child(), first, new_range, tag);
+      refit_node(node.right_child(), first + new_range, range - new_range, tag);
+      node.set_bbox(node.left_child().bbox() + node.right_child().bbox());
+    }
+  }
+
+  template<typename Tr>
+  std::size_t
+  AABB_tree<Tr>::rebuild_overlapping_subtrees(Node& node,
+                                              typename Primitives::iterator first,
+                                              const std::size_t range,
+                                              const double max_overlap,
+                                              const Sequential_tag& tag)
+  {
+    // the children of smaller subtrees are not both nodes
+    if(range < 4)
+      return 0;
+
+    if(overlap_ratio(node.left_child().bbox(), node.right_child().bbox(), node.bbox()) > max_overlap)
+    {
+      // the subtree keeps the same nodes and the same primitives
+      expand(node, first, first + range, range,
+             m_traits.compute_bbox_object(), m_traits.split_primitives_object(), tag);
+      return 1;
+    }
+
+    const std::size_t new_range = range/2;
+    return rebuild_overlapping_subtrees(node.left_child(), first, new_range, max_overlap, tag)
+         + rebuild_overlapping_subtrees(node.right_child(), first + new_range, range - new_range, max_overlap, tag);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template<typename Tr>
+  void
+  AABB_tree<Tr>::refit_node(Node& node,
+                            typename Primitives::iterator first,
+                            const std::size_t range,
+                            const Parallel_tag& tag)
+  {
+    if(range < parallel_build_threshold)
+    {
+      refit_node(node, first, range, Sequential_tag());
+      return;
+    }
+
+    const std::size_t new_range = range/2;
+    tbb::parallel_invoke(
+      [&]{ refit_node(node.left_child(), first, new_range, tag); },
+      [&]{ refit_node(node.right_child(), first + new_range, range - new_range, tag); });
+    node.set_bbox(node.left_child().bbox() + node.right_child().bbox());
+  }
+
+  template<typename Tr>
+  std::size_t
+  AABB_tree<Tr>::rebuild_overlapping_subtrees(Node& node,
+                                              typename Primitives::iterator first,
+                                              const std::size_t range,
+                                              const double max_overlap,
+                                              const Parallel_tag& tag)
+  {
+    if(range < parallel_build_threshold)
+      return rebuild_overlapping_subtrees(node, first, range, max_overlap, Sequential_tag());
+
+    if(overlap_ratio(node.left_child().bbox(), node.right_child().bbox(), node.bbox()) > max_overlap)
+    {
+      expand(node, first, first + range, range,
+             m_traits.compute_bbox_object(), m_traits.split_primitives_object(), tag);
+      return 1;
+    }
+
+    const std::size_t new_range = range/2;
+    std::size_t nb_left = 0, nb_right = 0;
+    tbb::parallel_invoke(
+      [&]{ nb_left = rebuild_overlapping_subtrees(node.left_child(), first, new_range, max_overlap, tag); },
+      [&]{ nb_right = rebuild_overlapping_subtrees(node.right_child(), first + new_range, range - new_range, max_overlap, tag); });
+    return nb_left + nb_right;
+  }
+#endif
+
+  template<typename Tr>
+  void
+  AABB_tree<Tr>::link_nodes(Node& node,
+                            typename Primitives::iterator first,
+                            const std::size_t range)
+  {
+    Node* p_node = std::addressof(node);
+    switch(range)
+    {
+    case 2:
+      node.set_children(*first, *(first+1));
+      break;
+    case 3:
+      node.set_children(*first, p_node[1]);
+      link_nodes(node.right_child(), first+1, 2);
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      node.set_children(p_node[1], p_node[new_range]);
+      link_nodes(node.left_child(), first, new_range);
+      link_nodes(node.right_child(), first + new_range, range - new_range);
+    }
+  }
+
+  template<typename Tr>
+  template<typename PrimitiveIndexMap>
+  std::ostream&
+  AABB_tree<Tr>::write_structure(std::ostream& os, const PrimitiveIndexMap& index_map) const
+  {
+    os.write(structure_signature(), std::strlen(structure_signature()));
+    const std::uint64_t nb_primitives = m_primitives.size();
+    os.write(reinterpret_cast<const char*>(&nb_primitives), sizeof(std::uint64_t));
+    if(m_primitives.size() > 1)
+      root_node(); // triggers the build
+
+    // position of each primitive in the inserted sequence
+    std::vector<std::uint64_t> order;
+    order.reserve(m_primitives.size());
+    for(const Primitive& p : m_primitives)
+      order.push_back(get(index_map, p.id()));
+    os.write(reinterpret_cast<const char*>(order.data()), order.size() * sizeof(std::uint64_t));
+
+#ifdef CGAL_HAS_THREADS
+    const bool m_search_tree_constructed = m_atomic_search_tree_constructed.load(std::memory_order_acquire);
+#endif
+    // the structure of the KD-tree can only be used if its points are the reference points of the primitives
+    const std::uint8_t has_search_tree = m_use_default_search_tree && m_search_tree_constructed;
+    os.write(reinterpret_cast<const char*>(&has_search_tree), 1);
+    if(has_search_tree)
+    {
+      auto kd_index_map = boost::make_function_property_map<Point_and_primitive_id, std::size_t>(
+        [&](const Point_and_primitive_id& p) { return get(index_map, p.second); });
+      m_p_search_tree->write_structure(os, kd_index_map);
+    }
+    return os;
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  bool
+  AABB_tree<Tr>::read_structure(std::istream& is)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::size_t signature_size = std::strlen(structure_signature());
+    std::string signature(signature_size, ' ');
+    is.read(&signature[0], signature_size);
+    std::uint64_t nb_primitives;
+    is.read(reinterpret_cast<char*>(&nb_primitives), sizeof(std::uint64_t));
+    if(!is || signature != structure_signature() || nb_primitives != m_primitives.size())
+      return false;
+
+#ifdef CGAL_HAS_THREADS
+    const bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    CGAL_precondition(m_need_build || m_primitives.size() < 2);
+
+    std::vector<std::uint64_t> order(m_primitives.size());
+    is.read(reinterpret_cast<char*>(order.data()), order.size() * sizeof(std::uint64_t));
+    if(!is)
+      return false;
+    std::vector<bool> is_used(m_primitives.size(), false);
+    Primitives primitives;
+    primitives.reserve(m_primitives.size());
+    for(std::uint64_t i : order)
+    {
+      if(i >= m_primitives.size() || is_used[i])
+        return false;
+      is_used[i] = true;
+      primitives.push_back(m_primitives[i]);
+    }
+
+    std::uint8_t has_search_tree;
+    is.read(reinterpret_cast<char*>(&has_search_tree), 1);
+    if(!is)
+      return false;
+    std::unique_ptr<Search_tree> p_search_tree;
+    if(has_search_tree)
+    {
+      // the points of the KD-tree are given in the order of insertion of the primitives
+      std::vector<Point_and_primitive_id> points;
+      points.reserve(m_primitives.size());
+      for(const Primitive& p : m_primitives)
+        points.push_back( Point_and_primitive_id( Helper::get_reference_point(p, m_traits), p.id() ) );
+      p_search_tree = std::make_unique<Search_tree>();
+      if(!p_search_tree->read_structure(points.begin(), points.end(), is))
+        return false;
+    }
+
+    // the structure is valid, the tree is updated
+    clear_nodes();
+    clear_search_tree();
+    m_primitives.swap(primitives);
+    if(m_primitives.size() > 1)
+    {
+      m_nodes.resize(m_primitives.size()-1);
+      link_nodes(m_nodes[0], m_primitives.begin(), m_primitives.size());
+      refit_node(m_nodes[0], m_primitives.begin(), m_primitives.size(), ConcurrencyTag());
+      build_wide_nodes();
+    }
+#ifdef CGAL_HAS_THREADS
+    m_atomic_need_build.store(false, std::memory_order_release);
+#else
+    m_need_build = false;
+#endif
+
+    if(p_search_tree)
+    {
+      m_use_default_search_tree = true;
+      m_p_search_tree = std::move(p_search_tree);
+#ifdef CGAL_HAS_THREADS
+      m_atomic_search_tree_constructed.store(true, std::memory_order_release);
+#else
+      m_search_tree_constructed = true;
+#endif
+    }
+    return true;
+  }
+
+  template<typename Tr>
+  double
+  AABB_tree<Tr>::overlap_ratio(const Bounding_box& b1,
+                               const Bounding_box& b2,
+                               const Bounding_box& bbox)
+  {
+    double ratio = 1.;
+    for(int i=0; i<bbox.dimension(); ++i)
+    {
+      const double overlap = (std::min)((b1.max)(i), (b2.max)(i)) - (std::max)((b1.min)(i), (b2.min)(i));
+      if(overlap < 0)
+        return 0.;
+      const double extent = (bbox.max)(i) - (bbox.min)(i);
+      if(extent > 0)
+        ratio *= overlap / extent;
+    }
+    return ratio;
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::refit()
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+#ifdef CGAL_HAS_THREADS
+    const bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    if(m_need_build)
+    {
+      build<ConcurrencyTag>();
+      return;
+    }
+
+    // the reference points of the primitives have moved, the points given by the user are theirs
+    if(m_use_default_search_tree)
+      clear_search_tree();
+
+    if(m_primitives.size() > 1)
+    {
+      refit_node(m_nodes[0], m_primitives.begin(), m_primitives.size(), ConcurrencyTag());
+      build_wide_nodes();
+    }
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  std::size_t AABB_tree<Tr>::refit(double max_overlap)
+  {
+    CGAL_precondition(max_overlap >= 0 && max_overlap <= 1);
+
+#ifdef CGAL_HAS_THREADS
+    const bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    if(m_need_build)
+    {
+      build<ConcurrencyTag>();
+      return 0;
+    }
+
+    refit<ConcurrencyTag>();
+    if(m_primitives.size() < 2)
+      return 0;
+    const std::size_t nb_rebuilt = rebuild_overlapping_subtrees(m_nodes[0], m_primitives.begin(), m_primitives.size(),
+                                                                max_overlap, ConcurrencyTag());
+    if(nb_rebuilt > 0)
+      build_wide_nodes();
+    return nb_rebuilt;
+  }
+
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
+  template<typename ConcurrencyTag>
   bool AABB_tree<Tr>::build_kd_tree()
   {
     // iterate over primitives to get reference points on them
@@ -864,18 +1652,18 @@ public:
       points.push_back( Point_and_primitive_id( Helper::get_reference_point(p, m_traits), p.id() ) );
 
     // clears current KD tree
-    return build_kd_tree(points.begin(), points.end());
+    return build_kd_tree<ConcurrencyTag>(points.begin(), points.end());
   }
 
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
-  template<typename ConstPointIterator>
+  template<typename ConcurrencyTag, typename ConstPointIterator>
   bool AABB_tree<Tr>::build_kd_tree(ConstPointIterator first,
                                     ConstPointIterator beyond)
   {
     clear_search_tree();
-    m_p_search_tree = std::make_unique<const Search_tree>(first, beyond);
+    m_p_search_tree = std::make_unique<const Search_tree>(first, beyond, ConcurrencyTag());
 #ifdef CGAL_HAS_THREADS
       m_atomic_search_tree_constructed.store(true, std::memory_order_release); // in case build_kd_tree() is triggered by a call to best_hint()
 #else
@@ -900,6 +1688,15 @@ public:
     return build_kd_tree();
   }
 
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  bool AABB_tree<Tr>::accelerate_distance_queries()
+  {
+    m_use_default_search_tree = true;
+    if(m_primitives.empty()) return true;
+    return build_kd_tree<ConcurrencyTag>();
+  }
+
   template<typename Tr>
   template<typename Query>
   bool
@@ -908,7 +1705,7 @@ public:
     using namespace CGAL::internal::AABB_tree;
     typedef typename AABB_tree<Tr>::AABB_traits AABBTraits;
     Do_intersect_traits<AABBTraits, Query> traversal_traits(m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return traversal_traits.is_intersection_found();
   }
 #ifndef DOXYGEN_RUNNING //To avoid doxygen to consider definition and declaration as 2 different functions (size_type causes problems)
@@ -927,7 +1724,7 @@ public:
 
     Listing_primitive_traits<AABBTraits,
       Query, Counting_iterator> traversal_traits(out,m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return counter;
   }
 #endif
@@ -941,7 +1738,7 @@ public:
     typedef typename AABB_tree<Tr>::AABB_traits AABBTraits;
     Listing_primitive_traits<AABBTraits,
       Query, OutputIterator> traversal_traits(out,m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return out;
   }
 
@@ -955,7 +1752,7 @@ public:
     typedef typename AABB_tree<Tr>::AABB_traits AABBTraits;
     Listing_intersection_traits<AABBTraits,
       Query, OutputIterator> traversal_traits(out,m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return out;
   }
 
@@ -968,7 +1765,7 @@ public:
     using namespace CGAL::internal::AABB_tree;
     typedef typename AABB_tree<Tr>::AABB_traits AABBTraits;
     First_intersection_traits<AABBTraits, Query> traversal_traits(m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return traversal_traits.result();
   }
 
@@ -980,7 +1777,7 @@ public:
     using namespace CGAL::internal::AABB_tree;
     typedef typename AABB_tree<Tr>::AABB_traits AABBTraits;
     First_primitive_traits<AABBTraits, Query> traversal_traits(m_traits);
-    this->traversal(query, traversal_traits);
+    this->intersection_traversal(query, traversal_traits);
     return traversal_traits.result();
   }
 
@@ -1054,6 +1851,87 @@ public:
     return projection_traits.closest_point_and_primitive();
   }
 
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  std::vector<std::size_t>
+    AABB_tree<Tr>::hilbert_order(const std::vector<Point>& points) const
+  {
+    typedef typename Kernel_traits<Point>::Kernel K;
+    typedef typename Pointer_property_map<Point>::const_type Point_map;
+    typedef std::conditional_t<Ambient_dimension<Point>::value == 2,
+                               Spatial_sort_traits_adapter_2<K, Point_map>,
+                               Spatial_sort_traits_adapter_3<K, Point_map> > Sort_traits;
+
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    hilbert_sort<ConcurrencyTag>(order.begin(), order.end(), Sort_traits(make_property_map(points)));
+    return order;
+  }
+
+  template<typename Tr>
+  template<typename Function>
+  void AABB_tree<Tr>::for_each_block(const std::size_t n, const Function& f, const Sequential_tag&)
+  {
+    f(std::size_t(0), n);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template<typename Tr>
+  template<typename Function>
+  void AABB_tree<Tr>::for_each_block(const std::size_t n, const Function& f, const Parallel_tag&)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, batch_grain_size),
+                      [&f](const tbb::blocked_range<std::size_t>& r) { f(r.begin(), r.end()); });
+  }
+#endif
+
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  OutputIterator
+    AABB_tree<Tr>::closest_points_and_primitives(const PointRange& queries,
+                                                 OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::vector<Point> points(std::begin(queries), std::end(queries));
+    if(points.empty())
+      return out;
+    CGAL_precondition(!empty());
+
+    // triggers the lazy constructions before the (possibly concurrent) queries
+    if(size() > 1)
+      root_node();
+    const std::vector<std::size_t> order = hilbert_order<ConcurrencyTag>(points);
+
+    std::vector<Point_and_primitive_id> results(points.size());
+    for_each_block(points.size(), [&](const std::size_t first, const std::size_t beyond)
+    {
+      Point_and_primitive_id hint = best_hint(points[order[first]]);
+      for(std::size_t k=first; k<beyond; ++k)
+      {
+        const std::size_t i = order[k];
+        hint = closest_point_and_primitive(points[i], hint);
+        results[i] = hint;
+      }
+    }, ConcurrencyTag());
+
+    return std::copy(results.begin(), results.end(), out);
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  OutputIterator
+    AABB_tree<Tr>::closest_points(const PointRange& queries,
+                                  OutputIterator out) const
+  {
+    closest_points_and_primitives<ConcurrencyTag>(queries,
+      boost::make_function_output_iterator([&out](const Point_and_primitive_id& pp) { *out++ = pp.first; }));
+    return out;
+  }
+
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
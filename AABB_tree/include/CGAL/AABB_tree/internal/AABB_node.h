@@ -20,10 +20,110 @@
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/intersections.h>
 #include <CGAL/Bbox_3.h>
+#include <CGAL/tags.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace CGAL {
 
+namespace internal {
+namespace AABB_tree {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Compressed_node_bbox,Compressed_node_bbox,false)
+
+template <class AABBTraits, bool has_nested_type = Has_nested_type_Compressed_node_bbox<AABBTraits>::value>
+struct Uses_compressed_node_bbox
+  : public Tag_false
+{};
+
+template <class AABBTraits>
+struct Uses_compressed_node_bbox<AABBTraits, true>
+  : public Boolean_tag<AABBTraits::Compressed_node_bbox::value>
+{};
+
+// returns the largest float which is not larger than `d`
+// (converting a finite double outside the range of float is undefined behavior)
+inline float round_down_to_float(const double d)
+{
+  if(d > (std::numeric_limits<float>::max)())
+    return (d == std::numeric_limits<double>::infinity()) ? std::numeric_limits<float>::infinity()
+                                                          : (std::numeric_limits<float>::max)();
+  if(d < std::numeric_limits<float>::lowest())
+    return -std::numeric_limits<float>::infinity();
+  const float f = static_cast<float>(d);
+  return (f > d) ? std::nextafter(f, -std::numeric_limits<float>::infinity()) : f;
+}
+
+// returns the smallest float which is not smaller than `d`
+inline float round_up_to_float(const double d)
+{
+  if(d < std::numeric_limits<float>::lowest())
+    return (d == -std::numeric_limits<double>::infinity()) ? -std::numeric_limits<float>::infinity()
+                                                           : std::numeric_limits<float>::lowest();
+  if(d > (std::numeric_limits<float>::max)())
+    return std::numeric_limits<float>::infinity();
+  const float f = static_cast<float>(d);
+  return (f < d) ? std::nextafter(f, std::numeric_limits<float>::infinity()) : f;
+}
+
+// bounding box of a node, stored as is
+template <class Bounding_box, bool compressed>
+class Node_bbox
+{
+  Bounding_box m_bbox;
+
+public:
+  typedef const Bounding_box& result_type;
+
+  result_type get() const { return m_bbox; }
+  void set(const Bounding_box& bbox) { m_bbox = bbox; }
+};
+
+// bounding box of a node, stored with single precision coordinates rounded
+// outwards, so that the box obtained contains the input box
+template <class Bounding_box>
+class Node_bbox<Bounding_box, true>
+{
+  static constexpr int dim = Bounding_box::Ambient_dimension::value;
+
+  // the minimal coordinates followed by the maximal coordinates
+  std::array<float, 2*dim> m_coords;
+
+  static Bounding_box make_bbox(const std::array<float, 4>& c)
+  {
+    return Bounding_box(c[0], c[1], c[2], c[3]);
+  }
+
+  static Bounding_box make_bbox(const std::array<float, 6>& c)
+  {
+    return Bounding_box(c[0], c[1], c[2], c[3], c[4], c[5]);
+  }
+
+public:
+  typedef Bounding_box result_type;
+
+  Node_bbox() { set(Bounding_box()); }
+
+  result_type get() const { return make_bbox(m_coords); }
+
+  void set(const Bounding_box& bbox)
+  {
+    for(int i=0; i<dim; ++i)
+    {
+      m_coords[i] = round_down_to_float((bbox.min)(i));
+      m_coords[dim+i] = round_up_to_float((bbox.max)(i));
+    }
+  }
+};
+
+} // namespace AABB_tree
+} // namespace internal
+
 /**
  * @class AABB_node
  *
@@ -38,6 +138,13 @@ private:
 public:
   typedef typename AABBTraits::Bounding_box Bounding_box;
 
+private:
+  typedef internal::AABB_tree::Node_bbox<
+            Bounding_box,
+            internal::AABB_tree::Uses_compressed_node_bbox<AABBTraits>::value> Stored_bbox;
+
+public:
+
   /// Constructor
   AABB_node()
     : m_bbox()
@@ -50,8 +157,9 @@ public:
   AABB_node(const Self& src) = delete;
   Self& operator=(const Self& src) = delete;
 
-  /// Returns the bounding box of the node
-  const Bounding_box& bbox() const { return m_bbox; }
+  /// Returns the bounding box of the node, which is a copy
+  /// if the box is stored in a compressed form
+  typename Stored_bbox::result_type bbox() const { return m_bbox.get(); }
 
   /**
    * @brief General traversal query
@@ -106,7 +214,7 @@ public:
   }
   void set_bbox(const Bounding_box& bbox)
   {
-    m_bbox = bbox;
+    m_bbox.set(bbox);
   }
 
   Node& left_child() { return *static_cast<Node*>(m_p_left_child); }
@@ -116,7 +224,7 @@ public:
 
 private:
   /// node bounding box
-  Bounding_box m_bbox;
+  Stored_bbox m_bbox;
 
   /// children nodes, either pointing towards children (if children are not leaves),
   /// or pointing toward input primitives (if children are leaves).
@@ -133,6 +241,8 @@ AABB_node<Tr>::traversal(const Query& query,
                          Traversal_traits& traits,
                          const std::size_t nb_primitives) const
 {
+  CGAL_PROFILER("[AABB_tree] nodes visited by traversals");
+
   // Recursive traversal
   switch(nb_primitives)
   {
@@ -173,6 +283,8 @@ AABB_node<Tr>::traversal_with_priority(const Query& query,
                                        Traversal_traits& traits,
                                        const std::size_t nb_primitives) const
 {
+  CGAL_PROFILER("[AABB_tree] nodes visited by traversals with priority");
+
   // Recursive traversal
   switch(nb_primitives)
   {
@@ -245,6 +357,8 @@ AABB_node<Tr>::traversal_with_priority_and_group_traversal(const Primitive_vecto
                                                            std::size_t first_primitive_index,
                                                            const std::size_t group_traversal_bound) const
 {
+  CGAL_PROFILER("[AABB_tree] nodes visited by traversals with priority and group traversal");
+
   // Group traversal
   CGAL_assertion(group_traversal_bound >= 2);
   if ( nb_primitives <= group_traversal_bound )
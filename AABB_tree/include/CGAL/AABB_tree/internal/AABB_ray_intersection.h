@@ -17,7 +17,9 @@
 #include <CGAL/license/AABB_tree.h>
 
 
+#include <array>
 #include <functional>
+#include <limits>
 #include <type_traits>
 #include <optional>
 #  if defined(BOOST_MSVC)
@@ -30,9 +32,50 @@
 #  endif
 
 #include <CGAL/assertions.h>
+#include <CGAL/Profile_counter.h>
 
 namespace CGAL {
 
+namespace internal {
+namespace AABB_tree {
+
+// Type used to pass a ray to the functor `Intersection_distance` of the traits.
+// If the functor provides a nested type `Precomputed_ray`, the data of the ray that
+// do not depend on the box are computed only once per query, otherwise the ray itself is used.
+template <typename IntersectionDistance, typename Ray, typename = void>
+struct Ray_for_intersection_distance
+{
+  typedef const Ray& type;
+};
+
+template <typename IntersectionDistance, typename Ray>
+struct Ray_for_intersection_distance<IntersectionDistance, Ray,
+                                     std::void_t<typename IntersectionDistance::Precomputed_ray> >
+{
+  typedef const typename IntersectionDistance::Precomputed_ray type;
+};
+
+// Computes the intersection distance between a fixed ray and many boxes
+template <typename IntersectionDistance, typename Ray>
+struct Ray_box_distance
+{
+  Ray_box_distance(const IntersectionDistance& intersection_distance, const Ray& ray)
+    : m_intersection_distance(intersection_distance), m_ray(ray) {}
+
+  template <typename Bounding_box>
+  decltype(auto) operator()(const Bounding_box& bbox) const
+  {
+    return m_intersection_distance(m_ray, bbox);
+  }
+
+private:
+  const IntersectionDistance& m_intersection_distance;
+  typename Ray_for_intersection_distance<IntersectionDistance, Ray>::type m_ray;
+};
+
+} // namespace AABB_tree
+} // namespace internal
+
 template<typename AABBTree, typename SkipFunctor>
 class AABB_ray_intersection {
   typedef typename AABBTree::AABB_traits AABB_traits;
@@ -48,6 +91,9 @@ public:
 
   std::optional< Ray_intersection_and_primitive_id >
   ray_intersection(const Ray& query, SkipFunctor skip) const {
+    if constexpr(AABBTree::uses_wide_nodes)
+      return wide_ray_intersection(query, skip);
+
     // We hit the root, now continue on the children. Keep track of
     // nb_primitives through a variable in each Node on the stack. In
     // BVH_node::traversal this is done through the function parameter
@@ -61,6 +107,8 @@ public:
     //   do_intersect_obj = tree_.traits().do_intersect_object();
     typename AABB_traits::Intersection_distance
       intersection_distance_obj = tree_.traits().intersection_distance_object();
+    internal::AABB_tree::Ray_box_distance<typename AABB_traits::Intersection_distance, Ray>
+      ray_box_distance(intersection_distance_obj, query);
     as_ray_param_visitor param_visitor = as_ray_param_visitor(&query);
 
     Heap_type pq;
@@ -78,6 +126,7 @@ public:
     while(!pq.empty() && pq.top().value < t) {
       Node_ptr_with_ft current = pq.top();
       pq.pop();
+      CGAL_PROFILER("[AABB_tree] nodes visited by ray queries");
 
       switch(current.nb_primitives) { // almost copy-paste from BVH_node::traversal
       case 2: // Left & right child both leaves
@@ -123,7 +172,7 @@ public:
 
         // right child
         const Node* child = &(current.node->right_child());
-        std::optional< FT > dist = intersection_distance_obj(query, child->bbox());
+        std::optional< FT > dist = ray_box_distance(child->bbox());
         if(dist)
           pq.push(Node_ptr_with_ft(child, *dist, 2));
 
@@ -132,12 +181,12 @@ public:
       default: // Children both inner nodes
       {
         const Node* child = &(current.node->left_child());
-        std::optional<FT> dist = intersection_distance_obj(query, child->bbox());
+        std::optional<FT> dist = ray_box_distance(child->bbox());
         if(dist)
           pq.push(Node_ptr_with_ft(child, *dist, current.nb_primitives/2));
 
         child = &(current.node->right_child());
-        dist = intersection_distance_obj(query, child->bbox());
+        dist = ray_box_distance(child->bbox());
         if(dist)
           pq.push(Node_ptr_with_ft(child, *dist, current.nb_primitives - current.nb_primitives/2));
 
@@ -148,6 +197,61 @@ public:
 
     return p;
   }
+
+  // same as `ray_intersection()`, the wide hierarchy being traversed
+  std::optional< Ray_intersection_and_primitive_id >
+  wide_ray_intersection(const Ray& query, SkipFunctor skip) const {
+    typedef typename AABBTree::Wide_node Wide_node;
+    typedef boost::heap::priority_queue< Wide_node_with_ft, boost::heap::compare< std::greater<Wide_node_with_ft> > >
+          Heap_type;
+
+    typename AABB_traits::Intersection
+      intersection_obj = tree_.traits().intersection_object();
+    const typename AABB_traits::Intersection_distance::Precomputed_ray ray(query);
+    as_ray_param_visitor param_visitor = as_ray_param_visitor(&query);
+
+    Heap_type pq;
+    std::optional< Ray_intersection_and_primitive_id >
+      intersection, /* the temporary for calculating the result */
+      p; /* the current best intersection */
+
+    FT t = (std::numeric_limits<double>::max)();
+    std::array<double, AABBTree::wide_node_arity> t_entry;
+    pq.push(Wide_node_with_ft(0, 0));
+
+    while(!pq.empty() && pq.top().value < t) {
+      const Wide_node& node = tree_.m_wide_nodes[pq.top().index];
+      pq.pop();
+      CGAL_PROFILER("[AABB_tree] wide nodes visited by ray queries");
+
+      // the boxes of all the children are tested at once, and the exact
+      // intersections are only computed with the primitives
+      const unsigned int hits = node.intersect(ray, t_entry);
+      for(int c=0; c<node.number_of_children(); ++c) {
+        if((hits & (1u << c)) == 0 || !(t_entry[c] < t))
+          continue;
+
+        if(node.is_leaf(c)) {
+          const typename AABB_traits::Primitive& primitive = tree_.m_primitives[node.child(c)];
+          if(!skip(primitive.id())) {
+            intersection = intersection_obj(query, primitive);
+            if(intersection) {
+              FT ray_distance = std::visit(param_visitor, intersection->first);
+              if(ray_distance < t) {
+                t = ray_distance;
+                p = intersection;
+              }
+            }
+          }
+        } else {
+          pq.push(Wide_node_with_ft(node.child(c), t_entry[c]));
+        }
+      }
+    }
+
+    return p;
+  }
+
 private:
   const AABBTree& tree_;
   typedef typename AABBTree::Point Point;
@@ -165,6 +269,15 @@ private:
     bool operator>(const Node_ptr_with_ft& other) const { return value > other.value; }
   };
 
+  struct Wide_node_with_ft {
+    Wide_node_with_ft(std::size_t index, const FT& value)
+      : index(index), value(value) {}
+    std::size_t index;
+    FT value;
+    bool operator<(const Wide_node_with_ft& other) const { return value < other.value; }
+    bool operator>(const Wide_node_with_ft& other) const { return value > other.value; }
+  };
+
   struct as_ray_param_visitor {
     typedef FT result_type;
     as_ray_param_visitor(const Ray* ray)
@@ -213,6 +326,7 @@ AABB_tree<AABBTraits>::first_intersection(const Ray& query,
   case 1: // Tree has 1 node, intersect directly
     return traits().intersection_object()(query, singleton_data());
   default: // Tree has >= 2 nodes
+    CGAL_PROFILER("[AABB_tree] ray queries");
     if(traits().do_intersect_object()(query, root_node()->bbox())) {
       AABB_ray_intersection< AABB_tree<AABBTraits>, SkipFunctor > ri(*this);
       return ri.ray_intersection(query, skip);
@@ -239,6 +353,59 @@ AABB_tree<AABBTraits>::first_intersected_primitive(const Ray& query,
   return std::nullopt;
 }
 
+template<typename AABBTraits>
+template<typename ConcurrencyTag, typename RayRange, typename OutputIterator>
+OutputIterator
+AABB_tree<AABBTraits>::first_intersections(const RayRange& rays,
+                                           OutputIterator out) const
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  typedef typename AABBTraits::Ray Ray;
+  typedef std::optional< typename Intersection_and_primitive_id<Ray>::Type > Result;
+
+  const std::vector<Ray> queries(std::begin(rays), std::end(rays));
+  if(queries.empty())
+    return out;
+
+  // triggers the lazy construction before the (possibly concurrent) queries
+  if(size() > 1)
+    root_node();
+
+  // Rays are not reordered: sorting the sources does not make rays with
+  // different directions visit the same nodes, and costs more than it saves.
+  std::vector<Result> results(queries.size());
+  for_each_block(queries.size(), [&](const std::size_t first, const std::size_t beyond)
+  {
+    for(std::size_t i=first; i<beyond; ++i)
+      results[i] = first_intersection(queries[i]);
+  }, ConcurrencyTag());
+
+  return std::copy(results.begin(), results.end(), out);
+}
+
+template<typename AABBTraits>
+template<typename ConcurrencyTag, typename RayRange, typename OutputIterator>
+OutputIterator
+AABB_tree<AABBTraits>::first_intersected_primitives(const RayRange& rays,
+                                                    OutputIterator out) const
+{
+  typedef typename AABBTraits::Ray Ray;
+  typedef std::optional< typename Intersection_and_primitive_id<Ray>::Type > Result;
+
+  first_intersections<ConcurrencyTag>(rays,
+    boost::make_function_output_iterator([&out](const Result& res)
+    {
+      if(res)
+        *out++ = std::make_optional(res->second);
+      else
+        *out++ = std::optional<Primitive_id>();
+    }));
+  return out;
+}
+
 }
 
 #endif /* CGAL_AABB_RAY_INTERSECTION_H */
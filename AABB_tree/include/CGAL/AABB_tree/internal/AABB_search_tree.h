@@ -18,6 +18,11 @@
 #include <CGAL/Orthogonal_k_neighbor_search.h>
 #include <CGAL/Search_traits_adapter.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <istream>
+#include <ostream>
+#include <vector>
 
 namespace CGAL
 {
@@ -47,8 +52,11 @@ private:
   }
 
 public:
-  template <class ConstPointIterator>
-  AABB_search_tree(ConstPointIterator begin, ConstPointIterator beyond)
+  AABB_search_tree() = default;
+
+  template <class ConstPointIterator, class ConcurrencyTag = Sequential_tag>
+  AABB_search_tree(ConstPointIterator begin, ConstPointIterator beyond,
+                   const ConcurrencyTag& = ConcurrencyTag())
       : m_tree{}
   {
     std::vector<Point_and_primitive_id> points;
@@ -58,7 +66,26 @@ public:
       ++begin;
     }
     m_tree.insert(points.begin(), points.end());
-    m_tree.build();
+    m_tree.template build<ConcurrencyTag>();
+  }
+
+  // inserts the points and uses the structure read from `is` instead of building the tree
+  template <class ConstPointIterator>
+  bool read_structure(ConstPointIterator begin, ConstPointIterator beyond, std::istream& is)
+  {
+    std::vector<Point_and_primitive_id> points;
+    while (begin != beyond) {
+      points.emplace_back(get_p_and_p(*begin));
+      ++begin;
+    }
+    m_tree.insert(points.begin(), points.end());
+    return m_tree.read_structure(is);
+  }
+
+  template <class IndexMap>
+  std::ostream& write_structure(std::ostream& os, IndexMap index_map) const
+  {
+    return m_tree.write_structure(os, index_map);
   }
 
   template <typename Point>
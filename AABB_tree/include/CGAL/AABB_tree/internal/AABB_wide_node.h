@@ -0,0 +1,267 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_AABB_WIDE_NODE_H
+#define CGAL_AABB_WIDE_NODE_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/AABB_tree/internal/AABB_node.h>
+#include <CGAL/assertions.h>
+#include <CGAL/FPU.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <array>
+#include <cfloat>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Wide_node_arity,Wide_node_arity,false)
+
+// maximal number of children of the nodes of the wide hierarchy used by the ray queries,
+// 0 if the tree has no such hierarchy
+template <class AABBTraits, bool has_nested_type = Has_nested_type_Wide_node_arity<AABBTraits>::value>
+struct Wide_node_arity
+  : public std::integral_constant<int, 0>
+{};
+
+template <class AABBTraits>
+struct Wide_node_arity<AABBTraits, true>
+  : public std::integral_constant<int, AABBTraits::Wide_node_arity::value>
+{};
+
+// Node of the wide hierarchy of `AABB_tree`, obtained by collapsing levels of
+// the binary hierarchy. Each child is either a node or a primitive, given by its index.
+// The bounding boxes of the children are stored together, axis by axis, with single
+// precision coordinates rounded outwards, so that a ray is tested against all
+// of them at once, with AVX or SSE2 instructions when they are available.
+template <int dim, int arity>
+class AABB_wide_node
+{
+  static_assert(arity >= 2 && arity <= 8);
+
+public:
+  typedef std::uint32_t Index;
+
+  AABB_wide_node()
+    : m_leaf_mask(0)
+    , m_nb_children(0)
+  {
+    for(int i=0; i<dim; ++i)
+    {
+      m_min[i].fill(0.f);
+      m_max[i].fill(0.f);
+    }
+    m_children.fill(0);
+  }
+
+  int number_of_children() const { return m_nb_children; }
+
+  // returns whether the child `c` is a primitive
+  bool is_leaf(const int c) const { return (m_leaf_mask & (1u << c)) != 0; }
+
+  // returns the index of the node or of the primitive which is the child `c`
+  Index child(const int c) const { return m_children[c]; }
+
+  template <class Bounding_box>
+  void add_child(const Bounding_box& bbox, const std::size_t index, const bool is_leaf)
+  {
+    CGAL_precondition(m_nb_children < arity);
+    CGAL_precondition(index <= (std::numeric_limits<Index>::max)());
+    const int c = m_nb_children++;
+    for(int i=0; i<dim; ++i)
+    {
+      m_min[i][c] = round_down_to_float((bbox.min)(i));
+      m_max[i][c] = round_up_to_float((bbox.max)(i));
+    }
+    m_children[c] = static_cast<Index>(index);
+    if(is_leaf)
+      m_leaf_mask |= static_cast<std::uint8_t>(1u << c);
+  }
+
+  // Returns the mask of the children whose box is intersected by `ray`, and puts
+  // in `t_entry` the smallest parameter of the points of the ray in each of these boxes.
+  // The slab tests are done with the precision of the ray, which must have double
+  // coordinates, as described in `Precomputed_ray`. As the parameters are computed
+  // with at most three rounding errors, the parameters of entry are decreased and
+  // the ones of exit are increased by a few ulps: a box hit by the ray is never discarded.
+  template <class PrecomputedRay>
+  unsigned int intersect(const PrecomputedRay& ray, std::array<double, arity>& t_entry) const
+  {
+    const double shrink = 1. - 4. * std::numeric_limits<double>::epsilon();
+    const double expand = 1. + 4. * std::numeric_limits<double>::epsilon();
+
+    std::array<double, arity> t_exit;
+    t_entry.fill(0.);
+    t_exit.fill(std::numeric_limits<double>::infinity());
+
+    for(int i=0; i<dim; ++i)
+      clip(ray, i, t_entry, t_exit);
+
+    unsigned int hits = 0;
+    for(int c=0; c<m_nb_children; ++c)
+    {
+      t_entry[c] *= shrink;
+      if(t_entry[c] <= t_exit[c] * expand)
+        hits |= (1u << c);
+    }
+    return hits;
+  }
+
+private:
+  // Restricts the intervals of parameters [t_entry, t_exit] of all the children
+  // to the slabs of their boxes along the axis `i`. The box of a child is missed
+  // along an axis parallel to the ray if its exit parameter becomes -infinity.
+  template <class PrecomputedRay>
+  void clip(const PrecomputedRay& ray, const int i,
+            std::array<double, arity>& t_entry, std::array<double, arity>& t_exit) const
+  {
+    const double s = ray.source(i);
+#if defined(__AVX__)
+    if constexpr(arity % 4 == 0)
+    {
+      const __m256d vs = _mm256_set1_pd(s);
+      const __m256d v = _mm256_set1_pd(ray.has_inverse_direction(i) ? ray.inverse_direction(i)
+                                                                     : ray.direction(i));
+      const __m256d minus_inf = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+      const __m256d plus_inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+      for(int c=0; c<arity; c+=4)
+      {
+        const __m256d lo = _mm256_cvtps_pd(_mm_loadu_ps(&m_min[i][c]));
+        const __m256d hi = _mm256_cvtps_pd(_mm_loadu_ps(&m_max[i][c]));
+        __m256d entry = _mm256_loadu_pd(&t_entry[c]);
+        __m256d exit = _mm256_loadu_pd(&t_exit[c]);
+        if(ray.is_parallel(i))
+        {
+          const __m256d outside = _mm256_or_pd(_mm256_cmp_pd(vs, lo, _CMP_LT_OQ),
+                                               _mm256_cmp_pd(hi, vs, _CMP_LT_OQ));
+          exit = _mm256_blendv_pd(exit, minus_inf, outside);
+        }
+        else
+        {
+          __m256d t1 = _mm256_sub_pd(lo, vs);
+          __m256d t2 = _mm256_sub_pd(hi, vs);
+          if(ray.has_inverse_direction(i))
+          {
+            t1 = _mm256_mul_pd(t1, v);
+            t2 = _mm256_mul_pd(t2, v);
+          }
+          else
+          {
+            t1 = _mm256_div_pd(t1, v);
+            t2 = _mm256_div_pd(t2, v);
+          }
+          const __m256d nan = _mm256_cmp_pd(t1, t2, _CMP_UNORD_Q);
+          entry = _mm256_max_pd(entry, _mm256_blendv_pd(_mm256_min_pd(t1, t2), minus_inf, nan));
+          exit = _mm256_min_pd(exit, _mm256_blendv_pd(_mm256_max_pd(t1, t2), plus_inf, nan));
+        }
+        _mm256_storeu_pd(&t_entry[c], entry);
+        _mm256_storeu_pd(&t_exit[c], exit);
+      }
+      return;
+    }
+#elif defined(CGAL_HAS_SSE2)
+    if constexpr(arity % 2 == 0)
+    {
+      const __m128d vs = _mm_set1_pd(s);
+      const __m128d v = _mm_set1_pd(ray.has_inverse_direction(i) ? ray.inverse_direction(i)
+                                                                 : ray.direction(i));
+      const __m128d minus_inf = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+      const __m128d plus_inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+      // no blend instruction in SSE2
+      auto select = [](const __m128d mask, const __m128d a, const __m128d b)
+                    { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); };
+      for(int c=0; c<arity; c+=2)
+      {
+        const __m128d lo = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&m_min[i][c]))));
+        const __m128d hi = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&m_max[i][c]))));
+        __m128d entry = _mm_loadu_pd(&t_entry[c]);
+        __m128d exit = _mm_loadu_pd(&t_exit[c]);
+        if(ray.is_parallel(i))
+        {
+          const __m128d outside = _mm_or_pd(_mm_cmplt_pd(vs, lo), _mm_cmplt_pd(hi, vs));
+          exit = select(outside, minus_inf, exit);
+        }
+        else
+        {
+          __m128d t1 = _mm_sub_pd(lo, vs);
+          __m128d t2 = _mm_sub_pd(hi, vs);
+          if(ray.has_inverse_direction(i))
+          {
+            t1 = _mm_mul_pd(t1, v);
+            t2 = _mm_mul_pd(t2, v);
+          }
+          else
+          {
+            t1 = _mm_div_pd(t1, v);
+            t2 = _mm_div_pd(t2, v);
+          }
+          const __m128d nan = _mm_cmpunord_pd(t1, t2);
+          entry = _mm_max_pd(entry, select(nan, minus_inf, _mm_min_pd(t1, t2)));
+          exit = _mm_min_pd(exit, select(nan, plus_inf, _mm_max_pd(t1, t2)));
+        }
+        _mm_storeu_pd(&t_entry[c], entry);
+        _mm_storeu_pd(&t_exit[c], exit);
+      }
+      return;
+    }
+#endif
+    if(ray.is_parallel(i))
+    {
+      for(int c=0; c<arity; ++c)
+        if(s < double(m_min[i][c]) || double(m_max[i][c]) < s)
+          t_exit[c] = -std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+      for(int c=0; c<arity; ++c)
+      {
+        double t1 = double(m_min[i][c]) - s;
+        double t2 = double(m_max[i][c]) - s;
+        if(ray.has_inverse_direction(i))
+        {
+          t1 *= ray.inverse_direction(i);
+          t2 *= ray.inverse_direction(i);
+        }
+        else
+        {
+          t1 /= ray.direction(i);
+          t2 /= ray.direction(i);
+        }
+        if(PrecomputedRay::is_nan(t1) || PrecomputedRay::is_nan(t2))
+          continue;
+        t_entry[c] = (std::max)(t_entry[c], (std::min)(t1, t2));
+        t_exit[c] = (std::min)(t_exit[c], (std::max)(t1, t2));
+      }
+    }
+  }
+
+  // bounds of the children, axis by axis
+  std::array<std::array<float, arity>, dim> m_min;
+  std::array<std::array<float, arity>, dim> m_max;
+  std::array<Index, arity> m_children;
+  std::uint8_t m_leaf_mask;
+  std::uint8_t m_nb_children;
+};
+
+} // namespace AABB_tree
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_AABB_WIDE_NODE_H
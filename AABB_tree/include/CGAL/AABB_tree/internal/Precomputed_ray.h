@@ -0,0 +1,158 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_AABB_TREE_INTERNAL_PRECOMPUTED_RAY_H
+#define CGAL_AABB_TREE_INTERNAL_PRECOMPUTED_RAY_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Dimension.h>
+#include <CGAL/number_utils.h>
+
+#include <array>
+#include <cfloat>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+// Coordinates of the source, direction and inverse of the direction of a ray of dimension `dim`,
+// computed once per query rather than once per box by the ray traversals.
+//
+// The slab tests follow the robust formulation: along an axis where the direction is zero,
+// the source is compared with the box; along an axis where the inverse of the direction
+// is not a finite normalized number (the component being denormalized or too large),
+// the parameters are obtained by dividing by the direction, so that they are not
+// spoiled by an infinite or inaccurate inverse; otherwise they are obtained by multiplying
+// by the inverse. A parameter that is not a number, which only comes from coordinates that
+// are not numbers, does not constrain the ray: such a slab test never discards a box.
+template <typename GeomTraits, int dim>
+class Precomputed_ray
+{
+  typedef typename GeomTraits::FT FT;
+
+public:
+  template <typename Ray>
+  explicit Precomputed_ray(const Ray& ray)
+  {
+    init(ray, Dimension_tag<dim>());
+  }
+
+  const FT& source(int i) const { return m_source[i]; }
+  const FT& direction(int i) const { return m_direction[i]; }
+  const FT& inverse_direction(int i) const { return m_inv_direction[i]; }
+  bool is_parallel(int i) const { return m_is_parallel[i]; }
+  // returns whether the parameters along the axis `i` are computed with the inverse of the direction
+  bool has_inverse_direction(int i) const { return m_has_inverse_direction[i]; }
+
+  // returns whether `t` is not a number
+  static bool is_nan(const FT& t)
+  {
+    if constexpr(std::is_floating_point<FT>::value)
+      return t != t;
+    else
+      return false;
+  }
+
+  // returns the smallest non-negative parameter of the points of the ray in `bbox`
+  template <typename Bounding_box>
+  std::optional<FT> intersection_distance(const Bounding_box& bbox) const
+  {
+    FT t_near = -DBL_MAX; // std::numeric_limits<FT>::lowest(); C++1903
+    FT t_far = DBL_MAX;
+
+    for(int i = 0; i < dim; ++i) {
+      if(m_is_parallel[i]) {
+        if((m_source[i] < (bbox.min)(i)) || (m_source[i] > (bbox.max)(i))) {
+          return std::nullopt;
+        }
+      } else {
+        FT t1, t2;
+        if(m_has_inverse_direction[i]) {
+          t1 = ((bbox.min)(i) - m_source[i]) * m_inv_direction[i];
+          t2 = ((bbox.max)(i) - m_source[i]) * m_inv_direction[i];
+        } else {
+          t1 = ((bbox.min)(i) - m_source[i]) / m_direction[i];
+          t2 = ((bbox.max)(i) - m_source[i]) / m_direction[i];
+        }
+        if(is_nan(t1) || is_nan(t2))
+          continue;
+
+        t_near = (std::max)(t_near, (std::min)(t1, t2));
+        t_far = (std::min)(t_far, (std::max)(t1, t2));
+
+        if(t_near > t_far || t_far < FT(0.))
+          return std::nullopt;
+      }
+    }
+
+    if(t_near < FT(0.))
+      return FT(0.);
+    else
+      return t_near;
+  }
+
+private:
+  template <typename Ray>
+  void init(const Ray& ray, Dimension_tag<2>)
+  {
+    const GeomTraits gt;
+    set(gt.construct_cartesian_const_iterator_2_object()(gt.construct_source_2_object()(ray)),
+        gt.construct_cartesian_const_iterator_2_object()(gt.construct_vector_2_object()(ray)));
+  }
+
+  template <typename Ray>
+  void init(const Ray& ray, Dimension_tag<3>)
+  {
+    const GeomTraits gt;
+    set(gt.construct_cartesian_const_iterator_3_object()(gt.construct_source_3_object()(ray)),
+        gt.construct_cartesian_const_iterator_3_object()(gt.construct_vector_3_object()(ray)));
+  }
+
+  template <typename Cartesian_const_iterator>
+  void set(Cartesian_const_iterator source_iter, Cartesian_const_iterator direction_iter)
+  {
+    for(int i = 0; i < dim; ++i, ++source_iter, ++direction_iter) {
+      m_source[i] = *source_iter;
+      m_direction[i] = *direction_iter;
+      m_inv_direction[i] = FT(0.);
+      m_is_parallel[i] = (m_direction[i] == 0);
+      m_has_inverse_direction[i] = false;
+      if(!m_is_parallel[i]) {
+        const FT inv_direction = FT(1.) / m_direction[i];
+        if constexpr(std::is_floating_point<FT>::value)
+          m_has_inverse_direction[i] = CGAL::is_finite(inv_direction) &&
+                                       CGAL::abs(inv_direction) >= (std::numeric_limits<FT>::min)();
+        else
+          m_has_inverse_direction[i] = true;
+        if(m_has_inverse_direction[i])
+          m_inv_direction[i] = inv_direction;
+      }
+    }
+  }
+
+  std::array<FT, dim> m_source;
+  std::array<FT, dim> m_direction;
+  std::array<FT, dim> m_inv_direction;
+  std::array<bool, dim> m_is_parallel;
+  std::array<bool, dim> m_has_inverse_direction;
+};
+
+} // namespace AABB_tree
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_AABB_TREE_INTERNAL_PRECOMPUTED_RAY_H
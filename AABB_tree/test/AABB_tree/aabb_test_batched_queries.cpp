@@ -0,0 +1,122 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef Tree::Intersection_and_primitive_id<Ray>::Type Ray_intersection;
+
+template <typename ConcurrencyTag>
+void test(const Tree& tree,
+          const std::vector<Point>& points,
+          const std::vector<Ray>& rays)
+{
+  std::vector<Tree::Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives<ConcurrencyTag>(points, std::back_inserter(closest));
+  assert(closest.size() == points.size());
+
+  std::vector<Point> closest_points;
+  tree.closest_points<ConcurrencyTag>(points, std::back_inserter(closest_points));
+  assert(closest_points.size() == points.size());
+
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    const double sq_dist = CGAL::squared_distance(points[i], tree.closest_point(points[i]));
+    assert(CGAL::squared_distance(points[i], closest[i].first) == sq_dist);
+    assert(CGAL::squared_distance(points[i], closest_points[i]) == sq_dist);
+    CGAL_USE(sq_dist);
+  }
+
+  std::vector<std::optional<Ray_intersection> > intersections;
+  tree.first_intersections<ConcurrencyTag>(rays, std::back_inserter(intersections));
+  assert(intersections.size() == rays.size());
+
+  std::vector<std::optional<Tree::Primitive_id> > primitives;
+  tree.first_intersected_primitives<ConcurrencyTag>(rays, std::back_inserter(primitives));
+  assert(primitives.size() == rays.size());
+
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    const std::optional<Tree::Primitive_id> fid = tree.first_intersected_primitive(rays[i]);
+    assert(fid.has_value() == intersections[i].has_value());
+    assert(fid == primitives[i]);
+    if(fid)
+      assert(intersections[i]->second == *fid);
+  }
+}
+
+// the result of the previous query is used as hint for the next one,
+// even when it is far away from the closest point
+void test_2()
+{
+  typedef K::Point_2 Point_2;
+  typedef K::Segment_2 Segment_2;
+  typedef std::vector<Segment_2>::const_iterator Iterator;
+  typedef CGAL::AABB_segment_primitive_2<K, Iterator> Primitive_2;
+  typedef CGAL::AABB_tree<CGAL::AABB_traits_2<K, Primitive_2> > Tree_2;
+
+  std::vector<Segment_2> segments;
+  for(int i=0; i<100; ++i)
+    segments.emplace_back(Point_2(i, 0), Point_2(i, 1));
+  Tree_2 tree(segments.begin(), segments.end());
+
+  const std::vector<Point_2> points = { Point_2(0.2, 3), Point_2(50.6, -1), Point_2(98.9, 0.5) };
+  std::vector<Point_2> closest;
+  tree.closest_points(points, std::back_inserter(closest));
+  assert(closest.size() == 3);
+  assert(closest[0] == Point_2(0, 1));
+  assert(closest[1] == Point_2(51, 0));
+  assert(closest[2] == Point_2(99, 0.5));
+}
+
+int main()
+{
+  test_2();
+
+  Mesh m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  in >> m;
+  assert(!is_empty(m));
+
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(m.points().begin(), m.points().end());
+  CGAL::Random rng(0);
+  std::vector<Point> points;
+  std::vector<Ray> rays;
+  for(std::size_t i=0; i<2000; ++i)
+  {
+    const Point p(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    points.push_back(p);
+    rays.emplace_back(p, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+  }
+
+  Tree tree(faces(m).begin(), faces(m).end(), m);
+  test<CGAL::Sequential_tag>(tree, points, rays);
+  test<CGAL::Parallel_if_available_tag>(tree, points, rays);
+
+  // empty query ranges
+  std::vector<Point> no_points;
+  std::vector<Point> out;
+  tree.closest_points(no_points, std::back_inserter(out));
+  assert(out.empty());
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_traits_with_compressed_nodes.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <limits>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_traits_with_compressed_nodes<Traits> Compressed_traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_tree<Compressed_traits> Compressed_tree;
+
+bool contains(const CGAL::Bbox_3& b, const CGAL::Bbox_3& inner)
+{
+  return b.xmin() <= inner.xmin() && b.ymin() <= inner.ymin() && b.zmin() <= inner.zmin() &&
+         b.xmax() >= inner.xmax() && b.ymax() >= inner.ymax() && b.zmax() >= inner.zmax();
+}
+
+void test_3(const Mesh& m)
+{
+  static_assert(sizeof(CGAL::AABB_node<Compressed_traits>) < sizeof(CGAL::AABB_node<Traits>));
+
+  Tree tree(faces(m).begin(), faces(m).end(), m);
+  Compressed_tree compressed_tree(faces(m).begin(), faces(m).end(), m);
+  compressed_tree.build<CGAL::Parallel_if_available_tag>();
+  assert(contains(compressed_tree.bbox(), tree.bbox()));
+
+  // the enlarged boxes do not change the answers to queries
+  const CGAL::Bbox_3 bb = tree.bbox();
+  CGAL::Random rng(0);
+  for(std::size_t i=0; i<1000; ++i)
+  {
+    const Point p(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    assert(tree.squared_distance(p) == compressed_tree.squared_distance(p));
+
+    const Ray r(p, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    assert(tree.number_of_intersected_primitives(r) == compressed_tree.number_of_intersected_primitives(r));
+    const auto inter = tree.first_intersection(r);
+    const auto compressed_inter = compressed_tree.first_intersection(r);
+    assert(inter.has_value() == compressed_inter.has_value());
+    assert(!inter || inter->second == compressed_inter->second);
+    CGAL_USE(inter);
+    CGAL_USE(compressed_inter);
+
+    const Segment s(p, Point(rng.get_double(bb.xmin(), bb.xmax()), bb.ymin(), bb.zmin()));
+    assert(tree.do_intersect(s) == compressed_tree.do_intersect(s));
+  }
+
+  // coordinates that are not representable as floats
+  const double eps = 1e-12;
+  Mesh tiny;
+  CGAL::make_triangle(Point(1+eps, 1+eps, 1+eps), Point(1+2*eps, 1+eps, 1+eps), Point(1+eps, 1+2*eps, 1+eps), tiny);
+  CGAL::make_triangle(Point(1+eps, 1+eps, 1+2*eps), Point(1+2*eps, 1+eps, 1+2*eps), Point(1+eps, 1+2*eps, 1+2*eps), tiny);
+  Compressed_tree tiny_tree(faces(tiny).begin(), faces(tiny).end(), tiny);
+  assert(contains(tiny_tree.bbox(), Tree(faces(tiny).begin(), faces(tiny).end(), tiny).bbox()));
+  assert(tiny_tree.do_intersect(Segment(Point(1+1.5*eps, 1+1.2*eps, 0), Point(1+1.5*eps, 1+1.2*eps, 2))));
+  assert(tiny_tree.number_of_intersected_primitives(Segment(Point(1+1.5*eps, 1+1.2*eps, 0), Point(1+1.5*eps, 1+1.2*eps, 2))) == 2);
+  assert(!tiny_tree.do_intersect(Segment(Point(1+3*eps, 1+3*eps, 0), Point(1+3*eps, 1+3*eps, 2))));
+
+  // coordinates beyond the range of floats
+  Mesh huge;
+  CGAL::make_triangle(Point(-1e300, 0, 0), Point(1e300, 0, 0), Point(0, 1e300, 1e-300), huge);
+  CGAL::make_triangle(Point(0, 0, 1), Point(1, 0, 1), Point(0, 1, 1), huge);
+  Compressed_tree huge_tree(faces(huge).begin(), faces(huge).end(), huge);
+  assert(contains(huge_tree.bbox(), Tree(faces(huge).begin(), faces(huge).end(), huge).bbox()));
+  assert(huge_tree.bbox().xmin() == -std::numeric_limits<double>::infinity());
+  assert(huge_tree.bbox().xmax() == std::numeric_limits<double>::infinity());
+  assert(huge_tree.number_of_intersected_primitives(Segment(Point(0.1, 0.1, -1), Point(0.1, 0.1, 2))) == 2);
+}
+
+void test_2()
+{
+  typedef K::Point_2 Point_2;
+  typedef K::Segment_2 Segment_2;
+  typedef std::vector<Segment_2>::const_iterator Iterator;
+  typedef CGAL::AABB_segment_primitive_2<K, Iterator> Primitive_2;
+  typedef CGAL::AABB_traits_with_compressed_nodes<CGAL::AABB_traits_2<K, Primitive_2> > Traits_2;
+  typedef CGAL::AABB_tree<Traits_2> Tree_2;
+
+  std::vector<Segment_2> segments;
+  for(int i=0; i<100; ++i)
+    segments.emplace_back(Point_2(0.1 * i, 0), Point_2(0.1 * i, 1));
+  Tree_2 tree(segments.begin(), segments.end());
+
+  assert(tree.closest_point(Point_2(5.06, -1)) == Point_2(0.1 * 51, 0));
+  assert(tree.number_of_intersected_primitives(Segment_2(Point_2(-1, 0.5), Point_2(20, 0.5))) == 100);
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  in >> m;
+  assert(!is_empty(m));
+
+  test_3(m);
+  test_2();
+
+  return EXIT_SUCCESS;
+}
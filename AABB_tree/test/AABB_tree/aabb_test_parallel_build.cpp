@@ -0,0 +1,83 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_triangle_primitive_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive_3<K, Iterator> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+int main()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rng);
+
+  std::vector<Triangle> triangles;
+  for(std::size_t i=0; i<50000; ++i)
+  {
+    const Point p = *gen++;
+    const Vector u(rng.get_double(-0.01, 0.01), rng.get_double(-0.01, 0.01), rng.get_double(-0.01, 0.01));
+    const Vector v(rng.get_double(-0.01, 0.01), rng.get_double(-0.01, 0.01), rng.get_double(-0.01, 0.01));
+    triangles.emplace_back(p, p + u, p + v);
+  }
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Tree seq_tree(triangles.begin(), triangles.end());
+  seq_tree.build();
+  seq_tree.accelerate_distance_queries();
+  std::cout << "Sequential build: " << timer.time() << " sec." << std::endl;
+
+  timer.reset();
+  Tree par_tree(triangles.begin(), triangles.end());
+  par_tree.build<CGAL::Parallel_if_available_tag>();
+  par_tree.accelerate_distance_queries<CGAL::Parallel_if_available_tag>();
+  std::cout << "Parallel build: " << timer.time() << " sec." << std::endl;
+
+  assert(seq_tree.bbox() == par_tree.bbox());
+
+  // the parallel construction gives the same tree as the sequential one
+  for(std::size_t i=0; i<1000; ++i)
+  {
+    const Point q = *gen++;
+    const Tree::Point_and_primitive_id pp_seq = seq_tree.closest_point_and_primitive(q);
+    const Tree::Point_and_primitive_id pp_par = par_tree.closest_point_and_primitive(q);
+    assert(pp_seq.second == pp_par.second);
+    assert(pp_seq.first == pp_par.first);
+    CGAL_USE(pp_seq);
+    CGAL_USE(pp_par);
+
+    const Ray r(q, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    assert(seq_tree.number_of_intersected_primitives(r) == par_tree.number_of_intersected_primitives(r));
+    const auto inter_seq = seq_tree.first_intersected_primitive(r);
+    const auto inter_par = par_tree.first_intersected_primitive(r);
+    assert(inter_seq.has_value() == inter_par.has_value());
+    assert(!inter_seq || *inter_seq == *inter_par);
+    CGAL_USE(inter_seq);
+    CGAL_USE(inter_par);
+  }
+
+  // rebuilding an existing tree in parallel
+  par_tree.clear();
+  par_tree.insert(triangles.begin(), triangles.begin() + 3);
+  par_tree.build<CGAL::Parallel_if_available_tag>();
+  assert(par_tree.size() == 3);
+  assert(par_tree.do_intersect(triangles[1]));
+
+  return EXIT_SUCCESS;
+}
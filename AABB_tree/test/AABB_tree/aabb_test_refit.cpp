@@ -0,0 +1,120 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// the refitted tree must answer queries as a tree built from scratch
+void check_against_new_tree(const Tree& tree, const Mesh& m, CGAL::Random& rng)
+{
+  CGAL_USE(tree);
+  Tree new_tree(faces(m).begin(), faces(m).end(), m);
+  assert(tree.bbox() == new_tree.bbox());
+
+  const CGAL::Bbox_3 bb = new_tree.bbox();
+  for(std::size_t i=0; i<500; ++i)
+  {
+    const Point p(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    assert(tree.squared_distance(p) == new_tree.squared_distance(p));
+
+    const Ray r(p, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    assert(tree.number_of_intersected_primitives(r) == new_tree.number_of_intersected_primitives(r));
+    assert(tree.first_intersected_primitive(r).has_value() == new_tree.first_intersected_primitive(r).has_value());
+
+    const Segment s(p, Point(rng.get_double(bb.xmin(), bb.xmax()), bb.ymin(), bb.zmin()));
+    assert(tree.do_intersect(s) == new_tree.do_intersect(s));
+  }
+}
+
+void move_vertices(Mesh& m, CGAL::Random& rng, const double amplitude)
+{
+  for(Mesh::Vertex_index v : vertices(m))
+  {
+    const Point& p = m.point(v);
+    m.point(v) = Point(p.x() + amplitude * std::sin(3 * p.y()) + rng.get_double(-0.01, 0.01) * amplitude,
+                       p.y() + amplitude * std::cos(2 * p.z()),
+                       p.z() * (1 + amplitude));
+  }
+}
+
+template <typename ConcurrencyTag>
+void test(Mesh m)
+{
+  CGAL::Random rng(0);
+
+  Tree tree(faces(m).begin(), faces(m).end(), m);
+  tree.template build<ConcurrencyTag>();
+  tree.accelerate_distance_queries();
+
+  // small motion, the hierarchy is kept
+  move_vertices(m, rng, 0.01);
+  tree.template refit<ConcurrencyTag>();
+  check_against_new_tree(tree, m, rng);
+
+  // the KD-tree built from points given by the user is kept
+  std::vector<Tree::Point_and_primitive_id> hints;
+  for(Mesh::Face_index f : faces(m))
+  {
+    hints.emplace_back(m.point(target(halfedge(f, m), m)), f);
+    if(hints.size() == 3)
+      break;
+  }
+  tree.accelerate_distance_queries(hints.begin(), hints.end());
+  tree.template refit<ConcurrencyTag>();
+  const Point hint = tree.best_hint(Point(0, 0, 0)).first;
+  assert(std::any_of(hints.begin(), hints.end(),
+                     [&hint](const Tree::Point_and_primitive_id& h) { return h.first == hint; }));
+  CGAL_USE(hint);
+  tree.accelerate_distance_queries();
+
+  // large motion, the subtrees of poor quality are reconstructed
+  move_vertices(m, rng, 0.5);
+  const std::size_t nb_rebuilt = tree.template refit<ConcurrencyTag>(0.5);
+  std::cout << nb_rebuilt << " subtrees reconstructed" << std::endl;
+  check_against_new_tree(tree, m, rng);
+
+  // a zero overlap threshold reconstructs everything that overlaps
+  move_vertices(m, rng, 0.1);
+  tree.template refit<ConcurrencyTag>(0.);
+  check_against_new_tree(tree, m, rng);
+
+  // primitives inserted since the last construction: the tree is built
+  Tree small_tree;
+  small_tree.insert(faces(m).begin(), std::next(faces(m).begin(), 10), m);
+  small_tree.template refit<ConcurrencyTag>();
+  assert(small_tree.size() == 10);
+  assert(small_tree.bbox() == Tree(faces(m).begin(), std::next(faces(m).begin(), 10), m).bbox());
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  in >> m;
+  assert(!is_empty(m));
+
+  test<CGAL::Sequential_tag>(m);
+  test<CGAL::Parallel_if_available_tag>(m);
+
+  return EXIT_SUCCESS;
+}
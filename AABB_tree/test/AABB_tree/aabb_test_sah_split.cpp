@@ -0,0 +1,95 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_traits_with_SAH_split.h>
+#include <CGAL/AABB_triangle_primitive_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/point_generators_3.h>
+
+#include <boost/property_map/function_property_map.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive_3<K, Iterator> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_tree<CGAL::AABB_traits_with_SAH_split<Traits> > SAH_tree;
+
+int main()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rng);
+
+  // a few large triangles among many small ones
+  std::vector<Triangle> triangles;
+  for(std::size_t i=0; i<5000; ++i)
+  {
+    const double s = (i % 100 == 0) ? 1. : 0.01;
+    const Point p = *gen++;
+    const Vector u(rng.get_double(-s, s), rng.get_double(-s, s), rng.get_double(-s, s));
+    const Vector v(rng.get_double(-s, s), rng.get_double(-s, s), rng.get_double(-s, s));
+    triangles.emplace_back(p, p + u, p + v);
+  }
+
+  Tree tree(triangles.begin(), triangles.end());
+  tree.build();
+
+  Tree sah_tree(triangles.begin(), triangles.end());
+  sah_tree.custom_build(sah_tree.traits().compute_bbox_object(),
+                        sah_tree.traits().sah_split_primitives_object());
+  assert(tree.bbox() == sah_tree.bbox());
+
+  // only the shape of the tree differs, not the answers to queries
+  for(std::size_t i=0; i<1000; ++i)
+  {
+    const Point q = *gen++;
+    assert(tree.squared_distance(q) == sah_tree.squared_distance(q));
+
+    const Ray r(q, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    assert(tree.number_of_intersected_primitives(r) == sah_tree.number_of_intersected_primitives(r));
+    const auto inter = tree.first_intersection(r);
+    const auto sah_inter = sah_tree.first_intersection(r);
+    assert(inter.has_value() == sah_inter.has_value());
+    assert(!inter || inter->second == sah_inter->second);
+    CGAL_USE(inter);
+    CGAL_USE(sah_inter);
+
+    const Segment s(q, *gen++);
+    assert(tree.do_intersect(s) == sah_tree.do_intersect(s));
+  }
+
+  // the traits wrapper selects the same split in build()
+  SAH_tree wrapped_tree(triangles.begin(), triangles.end());
+  wrapped_tree.build();
+  sah_tree.accelerate_distance_queries();
+  wrapped_tree.accelerate_distance_queries();
+  const auto index_map = boost::make_function_property_map<Iterator>(
+    [&triangles](const Iterator it) { return static_cast<std::size_t>(it - triangles.begin()); });
+  std::stringstream sah_ss, wrapped_ss;
+  sah_tree.write_structure(sah_ss, index_map);
+  wrapped_tree.write_structure(wrapped_ss, index_map);
+  assert(sah_ss.str() == wrapped_ss.str());
+
+  // degenerate configuration: all primitives in a plane
+  std::vector<Triangle> flat_triangles;
+  for(std::size_t i=0; i<100; ++i)
+    flat_triangles.emplace_back(Point(i, 0, 0), Point(i+1, 0, 0), Point(i, 1, 0));
+  Tree flat_tree(flat_triangles.begin(), flat_triangles.end());
+  flat_tree.custom_build(flat_tree.traits().compute_bbox_object(),
+                         flat_tree.traits().sah_split_primitives_object());
+  assert(flat_tree.number_of_intersected_primitives(Segment(Point(-1, 0.5, 0), Point(200, 0.5, 0))) == 100);
+
+  return EXIT_SUCCESS;
+}
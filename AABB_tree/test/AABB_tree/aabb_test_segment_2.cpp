@@ -54,5 +54,13 @@ int main()
   Point_and_primitive_id id = tree.closest_point_and_primitive(Point(1.5, 3.0));
   assert(id.second->source() == b && id.second->target() == c);
 
+  // a far hint gives a circle containing the boxes of the closest segments
+  std::list<Segment> far_seg;
+  for(int i=0; i<10; ++i)
+    far_seg.push_back(Segment(Point(0.1 * i, 0.0), Point(0.1 * i + 0.05, 0.0)));
+  far_seg.push_back(Segment(Point(100.0, 0.0), Point(101.0, 0.0)));
+  Tree far_tree(far_seg.begin(), far_seg.end());
+  assert(far_tree.closest_point(Point(0.42, 0.01), Point(100.0, 0.0)) == Point(0.42, 0.0));
+
   return EXIT_SUCCESS;
 }
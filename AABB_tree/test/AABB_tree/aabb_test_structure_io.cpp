@@ -0,0 +1,125 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <boost/property_map/function_property_map.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+void compare_trees(const Tree& tree, const Tree& other, const CGAL::Bbox_3& bb,
+                   const bool same_search_tree = true)
+{
+  assert(tree.size() == other.size());
+  assert(tree.bbox() == other.bbox());
+
+  CGAL::Random rng(1);
+  for(std::size_t i=0; i<1000; ++i)
+  {
+    const Point q(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    assert(tree.squared_distance(q) == other.squared_distance(q));
+    // with another KD-tree, the hint can be another primitive with the same reference point
+    if(same_search_tree)
+      assert(tree.best_hint(q) == other.best_hint(q));
+    else
+      assert(CGAL::squared_distance(q, tree.best_hint(q).first) == CGAL::squared_distance(q, other.best_hint(q).first));
+
+    const Ray r(q, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    assert(tree.number_of_intersected_primitives(r) == other.number_of_intersected_primitives(r));
+    const auto inter = tree.first_intersected_primitive(r);
+    const auto other_inter = other.first_intersected_primitive(r);
+    assert(inter.has_value() == other_inter.has_value());
+    assert(!inter || *inter == *other_inter);
+    CGAL_USE(inter);
+    CGAL_USE(other_inter);
+  }
+}
+
+int main()
+{
+  Mesh m;
+  if(!CGAL::IO::read_polygon_mesh(CGAL::data_file_path("meshes/elephant.off"), m))
+  {
+    std::cerr << "Cannot read the input mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const CGAL::Bbox_3 bb = CGAL::bbox_3(m.points().begin(), m.points().end());
+  // faces are inserted in the order of their indices
+  const auto index_map = boost::make_function_property_map<Mesh::Face_index>(
+    [](Mesh::Face_index f) { return std::size_t(f); });
+
+  Tree tree(faces(m).begin(), faces(m).end(), m);
+  tree.accelerate_distance_queries();
+
+  std::stringstream ss;
+  tree.write_structure(ss, index_map);
+  const std::string data = ss.str();
+
+  // the tree and its internal KD-tree are reconstructed from the structure
+  {
+    Tree other(faces(m).begin(), faces(m).end(), m);
+    std::istringstream is(data);
+    assert(other.read_structure(is));
+    compare_trees(tree, other, bb);
+  }
+  {
+    Tree other(faces(m).begin(), faces(m).end(), m);
+    std::istringstream is(data);
+    assert(other.read_structure<CGAL::Parallel_if_available_tag>(is));
+    compare_trees(tree, other, bb);
+  }
+
+  // without the KD-tree, whose structure is not written
+  {
+    Tree no_kd_tree(faces(m).begin(), faces(m).end(), m);
+    no_kd_tree.do_not_accelerate_distance_queries();
+    std::stringstream no_kd_ss;
+    no_kd_tree.write_structure(no_kd_ss, index_map);
+    assert(no_kd_ss.str().size() < data.size());
+
+    Tree other(faces(m).begin(), faces(m).end(), m);
+    assert(other.read_structure(no_kd_ss));
+    compare_trees(tree, other, bb, false);
+  }
+
+  // invalid inputs leave the tree unchanged
+  {
+    Tree other(faces(m).begin(), faces(m).end() - 1, m);
+    std::istringstream is(data);
+    assert(!other.read_structure(is));
+    assert(other.size() == tree.size() - 1);
+
+    Tree truncated(faces(m).begin(), faces(m).end(), m);
+    std::istringstream truncated_is(data.substr(0, data.size() / 2));
+    assert(!truncated.read_structure(truncated_is));
+    compare_trees(tree, truncated, bb, false);
+  }
+
+  // empty tree
+  {
+    Tree empty_tree;
+    std::stringstream empty_ss;
+    empty_tree.write_structure(empty_ss, index_map);
+    Tree other;
+    assert(other.read_structure(empty_ss));
+    assert(other.empty());
+  }
+
+  return EXIT_SUCCESS;
+}
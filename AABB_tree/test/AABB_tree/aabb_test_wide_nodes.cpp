@@ -0,0 +1,179 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_2.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_traits_with_compressed_nodes.h>
+#include <CGAL/AABB_traits_with_wide_nodes.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_segment_primitive_2.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits_3<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+template <class Tree, class Wide_tree>
+void compare(const Tree& tree, const Wide_tree& wide_tree, const Ray& r)
+{
+  const auto inter = tree.first_intersection(r);
+  const auto wide_inter = wide_tree.first_intersection(r);
+  assert(inter.has_value() == wide_inter.has_value());
+  // several primitives may be hit first, for example by a ray starting on a vertex,
+  // at points constructed with rounding errors
+  auto distance = [&r](const auto& inter)
+  {
+    return std::visit([&r](const auto& o) { return CGAL::squared_distance(r.source(), o); }, inter->first);
+  };
+  assert(!inter || inter->second == wide_inter->second || CGAL::abs(distance(inter) - distance(wide_inter)) < 1e-24);
+  CGAL_USE(inter);
+  CGAL_USE(wide_inter);
+  CGAL_USE(distance);
+
+  assert(tree.do_intersect(r) == wide_tree.do_intersect(r));
+  assert(tree.any_intersected_primitive(r).has_value() == wide_tree.any_intersected_primitive(r).has_value());
+  assert(tree.number_of_intersected_primitives(r) == wide_tree.number_of_intersected_primitives(r));
+
+  std::vector<typename Tree::Primitive_id> ids, wide_ids;
+  tree.all_intersected_primitives(r, std::back_inserter(ids));
+  wide_tree.all_intersected_primitives(r, std::back_inserter(wide_ids));
+  std::sort(ids.begin(), ids.end());
+  std::sort(wide_ids.begin(), wide_ids.end());
+  assert(ids == wide_ids);
+}
+
+template <class Wide_traits>
+void test_3(Mesh m)
+{
+  typedef CGAL::AABB_tree<Wide_traits> Wide_tree;
+
+  Tree tree(faces(m).begin(), faces(m).end(), m);
+  Wide_tree wide_tree(faces(m).begin(), faces(m).end(), m);
+  wide_tree.template build<CGAL::Parallel_if_available_tag>();
+
+  const CGAL::Bbox_3 bb = tree.bbox();
+  CGAL::Random rng(0);
+  std::vector<Ray> rays;
+  for(std::size_t i=0; i<1000; ++i)
+  {
+    const Point p(rng.get_double(bb.xmin(), bb.xmax()),
+                  rng.get_double(bb.ymin(), bb.ymax()),
+                  rng.get_double(bb.zmin(), bb.zmax()));
+    rays.emplace_back(p, Vector(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1)));
+
+    // null and tiny components of the direction
+    rays.emplace_back(p, Vector(0, 0, rng.get_double(-1, 1)));
+    rays.emplace_back(p, Vector(rng.get_double(-1, 1), 1e-320, 0));
+  }
+  // sources on the faces of the bounding box and on the faces of the boxes of the primitives
+  for(std::size_t i=0; i<100; ++i)
+  {
+    const double y = rng.get_double(bb.ymin(), bb.ymax()), z = rng.get_double(bb.zmin(), bb.zmax());
+    rays.emplace_back(Point(bb.xmin(), y, z), Vector(0, rng.get_double(-1, 1), rng.get_double(-1, 1)));
+    rays.emplace_back(Point(bb.xmax(), y, z), Vector(-1e-320, rng.get_double(-1, 1), 0));
+    rays.emplace_back(Point(bb.xmin(), y, z), Vector(-1, 0, 0));
+
+    const Point v = m.point(*(vertices(m).begin() + rng.get_int(0, static_cast<int>(num_vertices(m)))));
+    rays.emplace_back(v, Vector(0, 0, rng.get_double(-1, 1)));
+    rays.emplace_back(v, Vector(1e-320, rng.get_double(-1, 1), 0));
+  }
+  // sources outside the bounding box
+  rays.emplace_back(Point(bb.xmin() - 1, 0, 0), Vector(1, 0, 0));
+  rays.emplace_back(Point(bb.xmin() - 1, bb.ymin() - 1, bb.zmin() - 1), Vector(-1, -1, -1));
+
+  for(const Ray& r : rays)
+    compare(tree, wide_tree, r);
+
+  // batched queries
+  std::vector<std::optional<Tree::Primitive_id> > ids, wide_ids;
+  tree.first_intersected_primitives(rays, std::back_inserter(ids));
+  wide_tree.template first_intersected_primitives<CGAL::Parallel_if_available_tag>(rays, std::back_inserter(wide_ids));
+  assert(ids.size() == rays.size() && wide_ids.size() == rays.size());
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    assert(ids[i].has_value() == wide_ids[i].has_value());
+    assert(wide_ids[i] == wide_tree.first_intersected_primitive(rays[i]));
+  }
+
+  // the wide hierarchy follows the primitives that have moved
+  for(Mesh::Vertex_index v : vertices(m))
+    m.point(v) = Point(m.point(v).x() + 0.1, 2 * m.point(v).y(), m.point(v).z());
+  tree.refit();
+  wide_tree.refit();
+  for(std::size_t i=0; i<100; ++i)
+    compare(tree, wide_tree, rays[i]);
+}
+
+void test_2()
+{
+  typedef K::Point_2 Point_2;
+  typedef K::Vector_2 Vector_2;
+  typedef K::Ray_2 Ray_2;
+  typedef K::Segment_2 Segment_2;
+  typedef std::vector<Segment_2>::const_iterator Iterator;
+  typedef CGAL::AABB_segment_primitive_2<K, Iterator> Primitive_2;
+  typedef CGAL::AABB_traits_with_wide_nodes<CGAL::AABB_traits_2<K, Primitive_2> > Traits_2;
+  typedef CGAL::AABB_tree<Traits_2> Tree_2;
+
+  std::vector<Segment_2> segments;
+  for(int i=0; i<100; ++i)
+    segments.emplace_back(Point_2(0.1 * i, 0), Point_2(0.1 * i, 1));
+  Tree_2 tree(segments.begin(), segments.end());
+
+  const Ray_2 horizontal(Point_2(-1, 0.5), Vector_2(1, 0));
+  assert(tree.number_of_intersected_primitives(horizontal) == 100);
+  const auto inter = tree.first_intersection(horizontal);
+  assert(inter && inter->second == segments.begin());
+  CGAL_USE(inter);
+
+  // a ray along a segment, whose direction has a null component
+  const Ray_2 vertical(Point_2(0.5, -1), Vector_2(0, 1));
+  assert(tree.number_of_intersected_primitives(vertical) == 1);
+  assert(tree.first_intersected_primitive(vertical) == segments.begin() + 5);
+  assert(!tree.do_intersect(Ray_2(Point_2(0.55, -1), Vector_2(0, 1))));
+
+  // rays starting on the faces of the boxes
+  assert(tree.number_of_intersected_primitives(Ray_2(Point_2(0.5, 0.5), Vector_2(1, 0))) == 95);
+  assert(tree.number_of_intersected_primitives(Ray_2(Point_2(0.5, 1), Vector_2(1, 0))) == 95);
+  assert(tree.number_of_intersected_primitives(Ray_2(Point_2(0.5, 0), Vector_2(1, 1e-320))) == 95);
+  assert(tree.number_of_intersected_primitives(Ray_2(Point_2(0.5, 0), Vector_2(1, -1e-320))) == 1);
+  assert(tree.number_of_intersected_primitives(Ray_2(Point_2(0.5, 0), Vector_2(-1e-320, -1))) == 1);
+
+  // a direction whose inverse is not finite, along which the ray still crosses the slab
+  std::vector<Segment_2> horizontal_segments;
+  for(int i=0; i<10; ++i)
+    horizontal_segments.emplace_back(Point_2(-1, i), Point_2(1, i));
+  Tree_2 horizontal_tree(horizontal_segments.begin(), horizontal_segments.end());
+  const Ray_2 tiny(Point_2(0, -1e-310), Vector_2(1e-300, 1e-310));
+  assert(horizontal_tree.do_intersect(tiny));
+  const auto tiny_inter = horizontal_tree.first_intersection(tiny);
+  assert(tiny_inter && tiny_inter->second == horizontal_segments.begin());
+  CGAL_USE(tiny_inter);
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  in >> m;
+  assert(!is_empty(m));
+
+  test_3<CGAL::AABB_traits_with_wide_nodes<Traits> >(m);
+  test_3<CGAL::AABB_traits_with_wide_nodes<Traits, 8> >(m);
+  test_3<CGAL::AABB_traits_with_wide_nodes<CGAL::AABB_traits_with_compressed_nodes<Traits> > >(m);
+  test_2();
+
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@
 #include <CGAL/Search_traits_3.h>
 #include <CGAL/Fuzzy_sphere.h>
 #include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Neighbor_graph.h>
 
 #include <CGAL/iterator.h>
 
@@ -91,24 +92,41 @@ private:
   Tree m_tree;
   Distance m_distance;
 
+  // if a neighbor graph is given, the tree is empty and the neighbors
+  // are read from the graph, whose indices are positions in the range
+  const Neighbor_graph* m_neighbor_graph;
+  std::vector<input_iterator> m_iterators;
+
   // Forbid copy
   Neighbor_query (const Neighbor_query&) { }
 
 public:
 
-  Neighbor_query (PointRangeRef points, PointMap point_map)
+  Neighbor_query (PointRangeRef points, PointMap point_map,
+                  const Neighbor_graph* neighbor_graph = nullptr)
     : m_points (points)
     , m_point_map (point_map)
     , m_deref_map (point_map)
     , m_traits (m_deref_map)
-    , m_tree (iterator(m_points.begin()), iterator(m_points.end()), Splitter(), m_traits)
+    , m_tree (iterator(neighbor_graph == nullptr ? m_points.begin() : m_points.end()),
+              iterator(m_points.end()), Splitter(), m_traits)
     , m_distance (m_deref_map)
+    , m_neighbor_graph (neighbor_graph)
   {
-    m_tree.build();
+    if (m_neighbor_graph == nullptr)
+      m_tree.build();
+    else
+    {
+      for (input_iterator it = m_points.begin(); it != m_points.end(); ++ it)
+        m_iterators.push_back (it);
+      CGAL_precondition (m_neighbor_graph->number_of_points() == m_iterators.size());
+    }
   }
 
   PointMap point_map() const { return m_point_map; }
 
+  bool has_neighbor_graph() const { return m_neighbor_graph != nullptr; }
+
   template <typename OutputIterator>
   void get_iterators (const Point& query, unsigned int k, FT neighbor_radius,
                       OutputIterator output, unsigned int fallback_k_if_sphere_empty = 3) const
@@ -180,6 +198,31 @@ public:
                             *(output ++) = get (m_point_map, *it);
                           }), fallback_k_if_sphere_empty);
   }
+
+  // Same as above for the point at position `query_index` in the
+  // range: if there is a neighbor graph, its neighbors are read from
+  // the graph and `k` and `neighbor_radius` are ignored.
+  template <typename OutputIterator>
+  void get_iterators (const Point& query, std::size_t query_index, unsigned int k, FT neighbor_radius,
+                      OutputIterator output, unsigned int fallback_k_if_sphere_empty = 3) const
+  {
+    if (m_neighbor_graph == nullptr)
+      return get_iterators (query, k, neighbor_radius, output, fallback_k_if_sphere_empty);
+
+    for (std::size_t n : m_neighbor_graph->neighbors(query_index))
+      *(output ++) = m_iterators[n];
+  }
+
+  template <typename OutputIterator>
+  void get_points (const Point& query, std::size_t query_index, unsigned int k, FT neighbor_radius,
+                   OutputIterator output, unsigned int fallback_k_if_sphere_empty = 3) const
+  {
+    if (m_neighbor_graph == nullptr)
+      return get_points (query, k, neighbor_radius, output, fallback_k_if_sphere_empty);
+
+    for (std::size_t n : m_neighbor_graph->neighbors(query_index))
+      *(output ++) = get (m_point_map, *m_iterators[n]);
+  }
 };
 
 } } } // namespace CGAL::Point_set_processing_3::internal
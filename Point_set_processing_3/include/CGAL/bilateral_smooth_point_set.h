@@ -28,6 +28,7 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/zip_iterator.hpp>
 
 #include <iterator>
@@ -133,6 +134,7 @@ template <typename NeighborQuery>
 typename NeighborQuery::Kernel::FT
 compute_max_spacing(
   const typename NeighborQuery::value_type& vt,
+  std::size_t query_index,                                           ///< position of the point in the range
   typename NeighborQuery::Point_map point_map,
   NeighborQuery& neighbor_query,                                     ///< KD-tree
   unsigned int k)                                 ///< number of neighbors
@@ -146,7 +148,7 @@ compute_max_spacing(
   // than number of input points
   FT max_distance = (FT)0.0;
   neighbor_query.get_iterators
-    (get(point_map, vt), k, (FT)(0.0),
+    (get(point_map, vt), query_index, k, (FT)(0.0),
      boost::make_function_output_iterator
      ([&](const typename NeighborQuery::input_iterator& it)
       {
@@ -221,6 +223,17 @@ compute_max_spacing(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{neighbor_graph}
+       \cgalParamDescription{the neighbors of the points of `points`, designated by their position in `points`}
+       \cgalParamType{`CGAL::Neighbor_graph`}
+       \cgalParamDefault{unused}
+       \cgalParamExtra{If provided, for example computed by `CGAL::compute_neighbor_graph()`, the neighbors
+                       of each point are read from the graph instead of being searched in a kd-tree, and
+                       the parameters `k` and `neighbor_radius` are ignored. The graph
+                       is used as is, even if the points were moved since its computation.}
+       \cgalParamExtra{To avoid a copy of the graph, this parameter can be passed using `std::cref`.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{sharpness_angle}
        \cgalParamDescription{controls the sharpness of the result}
        \cgalParamType{floating scalar value}
@@ -267,6 +280,7 @@ bilateral_smooth_point_set(
 {
   using parameters::choose_parameter;
   using parameters::get_parameter;
+  using parameters::get_parameter_reference;
 
   // basic geometric types
   typedef typename PointRange::iterator iterator;
@@ -285,9 +299,17 @@ bilateral_smooth_point_set(
   double sharpness_angle = choose_parameter(get_parameter(np, internal_np::sharpness_angle), 30.);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
+  typedef typename internal_np::Lookup_named_param_def<internal_np::neighbor_graph_t,
+                                                       NamedParameters,
+                                                       Neighbor_graph>::reference Neighbor_graph_ref;
+  Neighbor_graph no_neighbor_graph;
+  Neighbor_graph_ref neighbor_graph = choose_parameter(get_parameter_reference(np, internal_np::neighbor_graph),
+                                                       no_neighbor_graph);
+  const bool use_neighbor_graph = !parameters::is_default_parameter<NamedParameters,
+                                                                    internal_np::neighbor_graph_t>::value;
 
   CGAL_precondition(points.begin() != points.end());
-  CGAL_precondition(k > 1);
+  CGAL_precondition(k > 1 || use_neighbor_graph);
 
   // types for K nearest neighbors search structure
   typedef Point_set_processing_3::internal::Neighbor_query<Kernel, PointRange&, PointMap> Neighbor_query;
@@ -302,7 +324,7 @@ bilateral_smooth_point_set(
    std::cout << "Initialization and compute max spacing: " << std::endl;
 #endif
    // initiate a KD-tree search for points
-   Neighbor_query neighbor_query (points, point_map);
+   Neighbor_query neighbor_query (points, point_map, use_neighbor_graph ? &neighbor_graph : nullptr);
 
    // Guess spacing
 #ifdef CGAL_PSP3_VERBOSE
@@ -311,10 +333,11 @@ bilateral_smooth_point_set(
 #endif
    FT guess_neighbor_radius = 0.0;
 
+   std::size_t index = 0;
    for (const value_type& vt : points)
    {
      FT max_spacing = bilateral_smooth_point_set_internal::
-       compute_max_spacing (vt, point_map, neighbor_query, k);
+       compute_max_spacing (vt, index ++, point_map, neighbor_query, k);
      guess_neighbor_radius = (CGAL::max)(max_spacing, guess_neighbor_radius);
    }
 
@@ -340,17 +363,21 @@ bilateral_smooth_point_set(
    Point_set_processing_3::internal::Callback_wrapper<ConcurrencyTag>
      callback_wrapper (callback, 2 * nb_points);
 
-   typedef boost::zip_iterator<boost::tuple<iterator, typename std::vector<iterators>::iterator> > Zip_iterator;
+   typedef boost::counting_iterator<std::size_t> Index_iterator;
+   typedef boost::zip_iterator<boost::tuple<iterator, typename std::vector<iterators>::iterator,
+                                            Index_iterator> > Zip_iterator;
 
    CGAL::for_each<ConcurrencyTag>
-     (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), pwns_neighbors.begin())),
-                        boost::make_zip_iterator (boost::make_tuple (points.end(), pwns_neighbors.end()))),
+     (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), pwns_neighbors.begin(),
+                                                                     Index_iterator(0))),
+                        boost::make_zip_iterator (boost::make_tuple (points.end(), pwns_neighbors.end(),
+                                                                     Index_iterator(nb_points)))),
       [&](const typename Zip_iterator::reference& t)
       {
         if (callback_wrapper.interrupted())
           return false;
 
-        neighbor_query.get_iterators (get(point_map, get<0>(t)), k, neighbor_radius,
+        neighbor_query.get_iterators (get(point_map, get<0>(t)), get<2>(t), k, neighbor_radius,
                                       std::back_inserter (get<1>(t)));
 
         ++ callback_wrapper.advancement();
@@ -28,6 +28,7 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/zip_iterator.hpp>
 
 #include <iterator>
@@ -54,6 +55,7 @@ namespace internal {
 template <typename NeighborQuery>
 typename NeighborQuery::Kernel::FT
 compute_average_spacing(const typename NeighborQuery::Kernel::Point_3& query, ///< 3D point whose spacing we want to compute
+                        std::size_t query_index,                                  ///< position of the point in the range
                         const NeighborQuery& neighbor_query,                      ///< KD-tree
                         unsigned int k)                        ///< number of neighbors
 {
@@ -69,7 +71,7 @@ compute_average_spacing(const typename NeighborQuery::Kernel::Point_3& query, //
   FT sum_distances = (FT)0.0;
   unsigned int i = 0;
   neighbor_query.get_points
-    (query, k, 0,
+    (query, query_index, k, 0,
      boost::make_function_output_iterator
      ([&](const Point& p)
       {
@@ -114,6 +116,16 @@ compute_average_spacing(const typename NeighborQuery::Kernel::Point_3& query, //
        \cgalParamDefault{`CGAL::Identity_property_map<geom_traits::Point_3>`}
      \cgalParamNEnd
 
+     \cgalParamNBegin{neighbor_graph}
+       \cgalParamDescription{the neighbors of the points of `points`, designated by their position in `points`}
+       \cgalParamType{`CGAL::Neighbor_graph`}
+       \cgalParamDefault{unused}
+       \cgalParamExtra{If provided, for example computed by `CGAL::compute_neighbor_graph()`, the neighbors
+                       of each point are read from the graph instead of being searched in a kd-tree, and
+                       the parameter `k` is ignored.}
+       \cgalParamExtra{To avoid a copy of the graph, this parameter can be passed using `std::cref`.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{callback}
        \cgalParamDescription{a mechanism to get feedback on the advancement of the algorithm
                              while it's running and to interrupt it if needed}
@@ -158,6 +170,7 @@ compute_average_spacing(
 {
   using parameters::choose_parameter;
   using parameters::get_parameter;
+  using parameters::get_parameter_reference;
 
   // basic geometric types
   typedef typename PointRange::const_iterator iterator;
@@ -168,6 +181,14 @@ compute_average_spacing(
   PointMap point_map = NP_helper::get_const_point_map(points, np);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
+  typedef typename internal_np::Lookup_named_param_def<internal_np::neighbor_graph_t,
+                                                       CGAL_NP_CLASS,
+                                                       Neighbor_graph>::reference Neighbor_graph_ref;
+  Neighbor_graph no_neighbor_graph;
+  Neighbor_graph_ref neighbor_graph = choose_parameter(get_parameter_reference(np, internal_np::neighbor_graph),
+                                                       no_neighbor_graph);
+  const bool use_neighbor_graph = !parameters::is_default_parameter<CGAL_NP_CLASS,
+                                                                    internal_np::neighbor_graph_t>::value;
 
   // types for K nearest neighbors search structure
   typedef typename Kernel::FT FT;
@@ -179,10 +200,10 @@ compute_average_spacing(
   CGAL_precondition(points.begin() != points.end());
 
   // precondition: at least 2 nearest neighbors
-  CGAL_precondition(k >= 2);
+  CGAL_precondition(k >= 2 || use_neighbor_graph);
 
   // Instantiate a KD-tree search.
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_neighbor_graph ? &neighbor_graph : nullptr);
 
   // iterate over input points, compute and output normal
   // vectors (already normalized)
@@ -195,18 +216,19 @@ compute_average_spacing(
 
   std::vector<FT> spacings (nb_points, -1);
 
-  typedef boost::zip_iterator<boost::tuple<iterator, typename std::vector<FT>::iterator> > Zip_iterator;
+  typedef boost::counting_iterator<std::size_t> Index_iterator;
+  typedef boost::zip_iterator<boost::tuple<iterator, typename std::vector<FT>::iterator, Index_iterator> > Zip_iterator;
 
   CGAL::for_each<ConcurrencyTag>
-    (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), spacings.begin())),
-                       boost::make_zip_iterator (boost::make_tuple (points.end(), spacings.end()))),
+    (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), spacings.begin(), Index_iterator(0))),
+                       boost::make_zip_iterator (boost::make_tuple (points.end(), spacings.end(), Index_iterator(nb_points)))),
      [&](const typename Zip_iterator::reference& t)
      {
        if (callback_wrapper.interrupted())
          return false;
 
        get<1>(t) = CGAL::internal::compute_average_spacing<Neighbor_query>
-         (get(point_map, get<0>(t)), neighbor_query, k);
+         (get(point_map, get<0>(t)), get<2>(t), neighbor_query, k);
        ++ callback_wrapper.advancement();
 
        return true;
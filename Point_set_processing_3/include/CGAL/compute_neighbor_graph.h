@@ -0,0 +1,127 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s) : Simon Giraudot
+
+#ifndef CGAL_COMPUTE_NEIGHBOR_GRAPH_H
+#define CGAL_COMPUTE_NEIGHBOR_GRAPH_H
+
+#include <CGAL/license/Point_set_processing_3.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Kd_tree.h>
+#include <CGAL/Neighbor_graph.h>
+#include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/property_map.h>
+
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+/**
+   \ingroup PkgPointSetProcessing3Algorithms
+   Computes the `k` nearest neighbors of all the points of `points`, for all
+   the functions of this package that accept the named parameter `neighbor_graph`.
+
+   As in these functions, the neighbors of a point are the point itself,
+   followed by its `k` nearest neighbors, sorted by increasing distance. The points
+   are designated by their position in `points`, which must not change as long as
+   the graph is used.
+
+   All the nearest neighbor queries are answered together, in the order of the
+   leaves of the kd-tree: this is much faster than the queries done one by one in
+   each function, and the graph can then be reused by several functions.
+
+   \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+                          `Parallel_tag`, and `Parallel_if_available_tag`.
+   \tparam PointRange is a model of `ConstRange`. The value type of
+   its iterator is the key type of the named parameter `point_map`.
+
+   \param points input point range
+   \param k number of neighbors
+   \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+   \cgalNamedParamsBegin
+     \cgalParamNBegin{point_map}
+       \cgalParamDescription{a property map associating points to the elements of the point set `points`}
+       \cgalParamType{a model of `ReadablePropertyMap` whose key type is the value type
+                      of the iterator of `PointRange` and whose value type is `geom_traits::Point_3`}
+       \cgalParamDefault{`CGAL::Identity_property_map<geom_traits::Point_3>`}
+     \cgalParamNEnd
+
+     \cgalParamNBegin{geom_traits}
+       \cgalParamDescription{an instance of a geometric traits class}
+       \cgalParamType{a model of `Kernel`}
+       \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+     \cgalParamNEnd
+   \cgalNamedParamsEnd
+
+   \return the neighbor graph, with `min(k + 1, points.size())` neighbors per point.
+*/
+template <typename ConcurrencyTag,
+          typename PointRange,
+          typename CGAL_NP_TEMPLATE_PARAMETERS
+>
+Neighbor_graph
+compute_neighbor_graph(
+  const PointRange& points,
+  unsigned int k,
+  const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  typedef Point_set_processing_3_np_helper<PointRange, CGAL_NP_CLASS> NP_helper;
+  typedef typename NP_helper::Const_point_map PointMap;
+  typedef typename NP_helper::Geom_traits Kernel;
+  typedef typename boost::property_traits<PointMap>::value_type Point;
+
+  // same tree as the one of the functions of the package, on indices
+  typedef typename std::conditional<std::is_same<Point, typename Kernel::Point_2>::value,
+                                    CGAL::Search_traits_2<Kernel>,
+                                    CGAL::Search_traits_3<Kernel> >::type Tree_traits_base;
+  typedef typename Pointer_property_map<Point>::const_type Index_point_map;
+  typedef CGAL::Search_traits_adapter<std::size_t, Index_point_map, Tree_traits_base> Tree_traits;
+  typedef CGAL::Sliding_midpoint<Tree_traits> Splitter;
+  typedef CGAL::Distance_adapter<std::size_t, Index_point_map, CGAL::Euclidean_distance<Tree_traits_base> > Distance;
+  typedef CGAL::Kd_tree<Tree_traits, Splitter, CGAL::Tag_true, CGAL::Tag_true> Tree;
+
+  PointMap point_map = NP_helper::get_const_point_map(points, np);
+
+  std::vector<Point> coordinates;
+  coordinates.reserve(std::distance(points.begin(), points.end()));
+  for (typename PointRange::const_iterator it = points.begin(); it != points.end(); ++ it)
+    coordinates.push_back(get(point_map, *it));
+
+  Index_point_map index_point_map = make_property_map(std::as_const(coordinates));
+  Tree tree (boost::counting_iterator<std::size_t>(0),
+             boost::counting_iterator<std::size_t>(coordinates.size()),
+             Splitter(), Tree_traits(index_point_map));
+  if (!coordinates.empty())
+    tree.template build<ConcurrencyTag>();
+
+  Neighbor_graph graph;
+  compute_k_neighbor_graph<ConcurrencyTag>(tree, k + 1, Identity_property_map<std::size_t>(),
+                                           graph, Distance(index_point_map));
+  return graph;
+}
+
+} //namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_COMPUTE_NEIGHBOR_GRAPH_H
@@ -29,6 +29,9 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/zip_iterator.hpp>
+
 #include <iterator>
 #include <list>
 
@@ -54,6 +57,7 @@ namespace internal {
 template <typename SvdTraits, typename NeighborQuery>
 typename NeighborQuery::Kernel::Vector_3
 jet_estimate_normal(const typename NeighborQuery::Point_3& query, ///< point to compute the normal at
+                    std::size_t query_index, ///< position of the point in the range
                     const NeighborQuery& neighbor_query, ///< KD-tree
                     unsigned int k, ///< number of neighbors
                     typename NeighborQuery::FT neighbor_radius,
@@ -72,7 +76,7 @@ jet_estimate_normal(const typename NeighborQuery::Point_3& query, ///< point to
   std::vector<Point> points;
 
   // query using as fallback minimum requires nb points for jet fitting (d+1)*(d+2)/2
-  neighbor_query.get_points (query, k, neighbor_radius, std::back_inserter(points),
+  neighbor_query.get_points (query, query_index, k, neighbor_radius, std::back_inserter(points),
                              (degree_fitting + 1) * (degree_fitting + 2) / 2);
 
   // performs jet fitting
@@ -135,6 +139,16 @@ jet_estimate_normal(const typename NeighborQuery::Point_3& query, ///< point to
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{neighbor_graph}
+       \cgalParamDescription{the neighbors of the points of `points`, designated by their position in `points`}
+       \cgalParamType{`CGAL::Neighbor_graph`}
+       \cgalParamDefault{unused}
+       \cgalParamExtra{If provided, for example computed by `CGAL::compute_neighbor_graph()`, the neighbors
+                       of each point are read from the graph instead of being searched in a kd-tree, and
+                       the parameters `k` and `neighbor_radius` are ignored.}
+       \cgalParamExtra{To avoid a copy of the graph, this parameter can be passed using `std::cref`.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{degree_fitting}
        \cgalParamDescription{the degree of fitting}
        \cgalParamType{unsigned int}
@@ -183,6 +197,7 @@ jet_estimate_normals(
 {
   using parameters::choose_parameter;
   using parameters::get_parameter;
+  using parameters::get_parameter_reference;
 
   CGAL_TRACE_STREAM << "Calls jet_estimate_normals()\n";
 
@@ -208,6 +223,14 @@ jet_estimate_normals(
 
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                std::function<bool(double)>());
+  typedef typename internal_np::Lookup_named_param_def<internal_np::neighbor_graph_t,
+                                                       NamedParameters,
+                                                       Neighbor_graph>::reference Neighbor_graph_ref;
+  Neighbor_graph no_neighbor_graph;
+  Neighbor_graph_ref neighbor_graph = choose_parameter(get_parameter_reference(np, internal_np::neighbor_graph),
+                                                       no_neighbor_graph);
+  const bool use_neighbor_graph = !parameters::is_default_parameter<NamedParameters,
+                                                                    internal_np::neighbor_graph_t>::value;
 
   // types for K nearest neighbors search structure
   typedef Point_set_processing_3::internal::Neighbor_query<Kernel, PointRange&, PointMap> Neighbor_query;
@@ -218,13 +241,13 @@ jet_estimate_normals(
   CGAL_precondition(points.begin() != points.end());
 
   // precondition: at least 2 nearest neighbors
-  CGAL_precondition(k >= 2 || neighbor_radius > FT(0));
+  CGAL_precondition(k >= 2 || neighbor_radius > FT(0) || use_neighbor_graph);
 
   std::size_t memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_neighbor_graph ? &neighbor_graph : nullptr);
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
@@ -235,16 +258,21 @@ jet_estimate_normals(
   Point_set_processing_3::internal::Callback_wrapper<ConcurrencyTag>
     callback_wrapper (callback, nb_points);
 
+  typedef boost::counting_iterator<std::size_t> Index_iterator;
+  typedef boost::zip_iterator<boost::tuple<iterator, Index_iterator> > Zip_iterator;
+
   CGAL::for_each<ConcurrencyTag>
-    (points,
-     [&](value_type& vt)
+    (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), Index_iterator(0))),
+                       boost::make_zip_iterator (boost::make_tuple (points.end(), Index_iterator(nb_points)))),
+     [&](const typename Zip_iterator::reference& t)
      {
        if (callback_wrapper.interrupted())
          return false;
 
+       value_type& vt = get<0>(t);
        put (normal_map, vt,
             CGAL::internal::jet_estimate_normal<SvdTraits>
-            (get(point_map, vt), neighbor_query, k, neighbor_radius, degree_fitting));
+            (get(point_map, vt), get<1>(t), neighbor_query, k, neighbor_radius, degree_fitting));
        ++ callback_wrapper.advancement();
 
        return true;
@@ -30,6 +30,9 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/zip_iterator.hpp>
+
 #include <iterator>
 #include <list>
 
@@ -54,6 +57,7 @@ namespace internal {
 template <typename NeighborQuery>
 typename NeighborQuery::Kernel::Vector_3
 pca_estimate_normal(const typename NeighborQuery::Kernel::Point_3& query, ///< point to compute the normal at
+                    std::size_t query_index, ///< position of the point in the range
                     const NeighborQuery& neighbor_query, ///< KD-tree
                     unsigned int k, ///< number of neighbors
                     typename NeighborQuery::Kernel::FT neighbor_radius)
@@ -64,7 +68,7 @@ pca_estimate_normal(const typename NeighborQuery::Kernel::Point_3& query, ///< p
   typedef typename Kernel::Plane_3  Plane;
 
   std::vector<Point> points;
-  neighbor_query.get_points (query, k, neighbor_radius, std::back_inserter(points));
+  neighbor_query.get_points (query, query_index, k, neighbor_radius, std::back_inserter(points));
 
   // performs plane fitting by point-based PCA
   Plane plane;
@@ -124,6 +128,16 @@ pca_estimate_normal(const typename NeighborQuery::Kernel::Point_3& query, ///< p
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{neighbor_graph}
+       \cgalParamDescription{the neighbors of the points of `points`, designated by their position in `points`}
+       \cgalParamType{`CGAL::Neighbor_graph`}
+       \cgalParamDefault{unused}
+       \cgalParamExtra{If provided, for example computed by `CGAL::compute_neighbor_graph()`, the neighbors
+                       of each point are read from the graph instead of being searched in a kd-tree, and
+                       the parameters `k` and `neighbor_radius` are ignored.}
+       \cgalParamExtra{To avoid a copy of the graph, this parameter can be passed using `std::cref`.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{callback}
        \cgalParamDescription{a mechanism to get feedback on the advancement of the algorithm
                              while it's running and to interrupt it if needed}
@@ -158,6 +172,7 @@ pca_estimate_normals(
 {
   using parameters::choose_parameter;
   using parameters::get_parameter;
+  using parameters::get_parameter_reference;
 
   CGAL_TRACE_STREAM << "Calls pca_estimate_normals()\n";
 
@@ -175,6 +190,14 @@ pca_estimate_normals(
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
+  typedef typename internal_np::Lookup_named_param_def<internal_np::neighbor_graph_t,
+                                                       NamedParameters,
+                                                       Neighbor_graph>::reference Neighbor_graph_ref;
+  Neighbor_graph no_neighbor_graph;
+  Neighbor_graph_ref neighbor_graph = choose_parameter(get_parameter_reference(np, internal_np::neighbor_graph),
+                                                       no_neighbor_graph);
+  const bool use_neighbor_graph = !parameters::is_default_parameter<NamedParameters,
+                                                                    internal_np::neighbor_graph_t>::value;
 
   // Input points types
   typedef typename PointRange::iterator iterator;
@@ -189,13 +212,13 @@ pca_estimate_normals(
   CGAL_precondition(points.begin() != points.end());
 
   // precondition: at least 2 nearest neighbors
-  CGAL_precondition(k >= 2);
+  CGAL_precondition(k >= 2 || use_neighbor_graph);
 
   std::size_t memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_neighbor_graph ? &neighbor_graph : nullptr);
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
@@ -206,16 +229,21 @@ pca_estimate_normals(
   Point_set_processing_3::internal::Callback_wrapper<ConcurrencyTag>
     callback_wrapper (callback, nb_points);
 
+  typedef boost::counting_iterator<std::size_t> Index_iterator;
+  typedef boost::zip_iterator<boost::tuple<iterator, Index_iterator> > Zip_iterator;
+
   CGAL::for_each<ConcurrencyTag>
-    (points,
-     [&](value_type& vt)
+    (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (points.begin(), Index_iterator(0))),
+                       boost::make_zip_iterator (boost::make_tuple (points.end(), Index_iterator(nb_points)))),
+     [&](const typename Zip_iterator::reference& t)
      {
        if (callback_wrapper.interrupted())
          return false;
 
+       value_type& vt = get<0>(t);
        put (normal_map, vt,
             CGAL::internal::pca_estimate_normal
-            (get(point_map, vt), neighbor_query, k, neighbor_radius));
+            (get(point_map, vt), get<1>(t), neighbor_query, k, neighbor_radius));
 
        ++ callback_wrapper.advancement();
 
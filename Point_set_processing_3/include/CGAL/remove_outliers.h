@@ -26,6 +26,7 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/zip_iterator.hpp>
 
 #include <iterator>
@@ -55,6 +56,7 @@ template <typename NeighborQuery>
 typename NeighborQuery::Kernel::FT
 compute_avg_knn_sq_distance_3(
   const typename NeighborQuery::Kernel::Point_3& query, ///< 3D point to project
+    std::size_t query_index,                                  ///< position of the point in the range
     NeighborQuery& neighbor_query,                            ///< KD-tree
     unsigned int k,                        ///< number of neighbors
     typename NeighborQuery::Kernel::FT neighbor_radius)
@@ -65,7 +67,7 @@ compute_avg_knn_sq_distance_3(
     typedef typename Kernel::Point_3 Point;
 
     std::vector<Point> points;
-    neighbor_query.get_points (query, k, neighbor_radius, std::back_inserter(points));
+    neighbor_query.get_points (query, query_index, k, neighbor_radius, std::back_inserter(points));
 
     // compute average squared distance
     typename Kernel::Compute_squared_distance_3 sqd;
@@ -125,6 +127,16 @@ compute_avg_knn_sq_distance_3(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{neighbor_graph}
+       \cgalParamDescription{the neighbors of the points of `points`, designated by their position in `points`}
+       \cgalParamType{`CGAL::Neighbor_graph`}
+       \cgalParamDefault{unused}
+       \cgalParamExtra{If provided, for example computed by `CGAL::compute_neighbor_graph()`, the neighbors
+                       of each point are read from the graph instead of being searched in a kd-tree, and
+                       the parameters `k` and `neighbor_radius` are ignored.}
+       \cgalParamExtra{To avoid a copy of the graph, this parameter can be passed using `std::cref`.}
+     \cgalParamNEnd
+
      \cgalParamNBegin{threshold_percent}
        \cgalParamDescription{the maximum percentage of points to remove}
        \cgalParamType{double}
@@ -180,6 +192,7 @@ remove_outliers(
 {
   using parameters::choose_parameter;
   using parameters::get_parameter;
+  using parameters::get_parameter_reference;
 
   // geometric types
   typedef Point_set_processing_3_np_helper<PointRange, NamedParameters> NP_helper;
@@ -193,6 +206,14 @@ remove_outliers(
   double threshold_distance = choose_parameter(get_parameter(np, internal_np::threshold_distance), 0.);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
+  typedef typename internal_np::Lookup_named_param_def<internal_np::neighbor_graph_t,
+                                                       NamedParameters,
+                                                       Neighbor_graph>::reference Neighbor_graph_ref;
+  Neighbor_graph no_neighbor_graph;
+  Neighbor_graph_ref neighbor_graph = choose_parameter(get_parameter_reference(np, internal_np::neighbor_graph),
+                                                       no_neighbor_graph);
+  const bool use_neighbor_graph = !parameters::is_default_parameter<NamedParameters,
+                                                                    internal_np::neighbor_graph_t>::value;
 
   typedef typename Kernel::FT FT;
 
@@ -209,11 +230,11 @@ remove_outliers(
   CGAL_precondition(points.begin() != points.end());
 
   // precondition: at least 2 nearest neighbors
-  CGAL_precondition(k >= 2);
+  CGAL_precondition(k >= 2 || use_neighbor_graph);
 
   CGAL_precondition(threshold_percent >= 0 && threshold_percent <= 100);
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_neighbor_graph ? &neighbor_graph : nullptr);
 
   std::size_t nb_points = points.size();
 
@@ -226,15 +247,21 @@ remove_outliers(
   Point_set_processing_3::internal::Callback_wrapper<ConcurrencyTag>
     callback_wrapper (callback, nb_points);
 
+  typedef boost::counting_iterator<std::size_t> Index_iterator;
+  typedef boost::zip_iterator<boost::tuple<typename std::vector<std::pair<FT, value_type> >::iterator,
+                                           Index_iterator> > Zip_iterator;
+
   CGAL::for_each<ConcurrencyTag>
-    (sorted_points,
-     [&](std::pair<FT, value_type>& p) -> bool
+    (CGAL::make_range (boost::make_zip_iterator (boost::make_tuple (sorted_points.begin(), Index_iterator(0))),
+                       boost::make_zip_iterator (boost::make_tuple (sorted_points.end(), Index_iterator(nb_points)))),
+     [&](const typename Zip_iterator::reference& t) -> bool
      {
        if (callback_wrapper.interrupted())
          return false;
 
+       std::pair<FT, value_type>& p = get<0>(t);
        p.first = internal::compute_avg_knn_sq_distance_3(
-         get(point_map, p.second),
+         get(point_map, p.second), get<1>(t),
          neighbor_query, k, neighbor_radius);
 
        ++ callback_wrapper.advancement();
@@ -0,0 +1,131 @@
+// neighbor_graph_test.cpp
+
+//----------------------------------------------------------
+// Test the functions of this package with a precomputed
+// neighbor graph: they must give the same results as with
+// their own neighbor searches.
+// No input file.
+//----------------------------------------------------------
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/compute_neighbor_graph.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/pca_estimate_normals.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/bilateral_smooth_point_set.h>
+
+#include <cassert>
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+const unsigned int k = 12;
+
+template <typename PointRange>
+bool same_points_and_normals(const PointRange& a, const PointRange& b)
+{
+  return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+template <typename PointRange>
+void test_normals(const PointRange& input, const CGAL::Neighbor_graph& graph)
+{
+  PointRange points = input, points_with_graph = input;
+
+  CGAL::jet_estimate_normals<CGAL::Sequential_tag>
+    (points, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map()));
+  CGAL::jet_estimate_normals<Concurrency_tag>
+    (points_with_graph, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map())
+                                            .neighbor_graph(std::cref(graph)));
+  assert(same_points_and_normals(points, points_with_graph));
+
+  CGAL::pca_estimate_normals<CGAL::Sequential_tag>
+    (points, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map()));
+  CGAL::pca_estimate_normals<Concurrency_tag>
+    (points_with_graph, 0, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map())
+                                            .neighbor_graph(graph));
+  assert(same_points_and_normals(points, points_with_graph));
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+  CGAL::Random_points_on_sphere_3<Point> generator(1., rng);
+
+  std::vector<Point_with_normal> points;
+  for(std::size_t i=0; i<3000; ++i)
+  {
+    const Point& p = *generator++;
+    points.emplace_back(p + 0.01 * Vector(rng.get_double(), rng.get_double(), rng.get_double()),
+                        CGAL::NULL_VECTOR);
+  }
+
+  // the neighbors of a point start with the point itself
+  const CGAL::Neighbor_graph graph
+    = CGAL::compute_neighbor_graph<Concurrency_tag>(points, k, CGAL::parameters::point_map(Point_map()));
+  assert(graph.number_of_points() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    assert(graph.number_of_neighbors(i) == k + 1);
+    assert(*graph.neighbors(i).begin() == i);
+  }
+
+  test_normals(points, graph);
+  test_normals(std::list<Point_with_normal>(points.begin(), points.end()), graph);
+
+  // average spacing
+  const double spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag>
+    (points, k, CGAL::parameters::point_map(Point_map()));
+  const double spacing_with_graph = CGAL::compute_average_spacing<Concurrency_tag>
+    (points, k, CGAL::parameters::point_map(Point_map()).neighbor_graph(std::cref(graph)));
+  assert(spacing == spacing_with_graph);
+
+  // outliers
+  {
+    std::vector<Point_with_normal> copy = points, copy_with_graph = points;
+    auto first_to_remove = CGAL::remove_outliers<CGAL::Sequential_tag>
+      (copy, k, CGAL::parameters::point_map(Point_map()).threshold_percent(5.));
+    auto first_to_remove_with_graph = CGAL::remove_outliers<Concurrency_tag>
+      (copy_with_graph, k, CGAL::parameters::point_map(Point_map()).threshold_percent(5.)
+                                                                    .neighbor_graph(std::cref(graph)));
+    assert(first_to_remove - copy.begin() == first_to_remove_with_graph - copy_with_graph.begin());
+    assert(copy == copy_with_graph);
+  }
+
+  // smoothing, which needs normals
+  {
+    std::vector<Point_with_normal> copy = points;
+    CGAL::jet_estimate_normals<Concurrency_tag>
+      (copy, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map())
+                                                        .neighbor_graph(std::cref(graph)));
+    std::vector<Point_with_normal> copy_with_graph = copy;
+
+    const double error = CGAL::bilateral_smooth_point_set<CGAL::Sequential_tag>
+      (copy, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map()));
+    const double error_with_graph = CGAL::bilateral_smooth_point_set<Concurrency_tag>
+      (copy_with_graph, k, CGAL::parameters::point_map(Point_map()).normal_map(Normal_map())
+                                                                   .neighbor_graph(std::cref(graph)));
+    assert(error == error_with_graph);
+    assert(copy == copy_with_graph);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -20,7 +20,9 @@
 #include <functional>
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 
+#include <cstdlib>
 #include <fstream>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 typedef K::Point_3 Point_3;
@@ -37,7 +39,7 @@ typedef CGAL::AABB_halfedge_graph_segment_primitive<Mesh> HGSP;
 typedef CGAL::AABB_traits_3<K, HGSP>    AABB_traits;
 typedef CGAL::AABB_tree<AABB_traits>  AABB_tree;
 typedef std::vector<K::Point_3> Polyline;
-typedef std::list< Polyline > Polylines;
+typedef std::vector< Polyline > Polylines;
 
 typedef CGAL::Timer Timer;
 
@@ -92,7 +94,7 @@ int main(int argc, char* argv[])
 {
   std::ifstream input(argv[1]);
   Mesh m;
-  int N = 100;
+  int N = (argc > 2) ? std::atoi(argv[2]) : 100;
   if (!input || !(input >> m)){
     std::cerr << "Error: can not read file.\n";
     return 1;
@@ -134,5 +136,24 @@ int main(int argc, char* argv[])
   std::cerr << N << " layers in a model with " << num_faces(m) << " triangles"<< std::endl;
   std::cerr << polycount << " polylines with in total " << vertex_count << " vertices computed in "<< t.time() << " sec." << std::endl;
 
+  // all the layers at once
+  std::vector<K::Plane_3> planes;
+  for(int i=0; i < N; i++)
+    planes.push_back(K::Plane_3(Point_3(0,0,zmin+delta*i), Vector_3(0,0,1)));
+
+  std::vector<Polylines> layers;
+  t.reset();
+  t.start();
+  slicer.slice<CGAL::Sequential_tag>(planes, std::back_inserter(layers));
+  t.stop();
+  std::cerr << "batched slicing computed in " << t.time() << " sec." << std::endl;
+
+  layers.clear();
+  t.reset();
+  t.start();
+  slicer.slice<CGAL::Parallel_if_available_tag>(planes, std::back_inserter(layers));
+  t.stop();
+  std::cerr << "parallel batched slicing computed in " << t.time() << " sec." << std::endl;
+
   return 0;
 }
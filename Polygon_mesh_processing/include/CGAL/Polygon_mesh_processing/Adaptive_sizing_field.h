@@ -23,6 +23,10 @@
 
 #include <CGAL/number_utils.h>
 
+#include <iterator>
+#include <optional>
+#include <vector>
+
 namespace CGAL
 {
 namespace Polygon_mesh_processing
@@ -60,6 +64,12 @@ private:
   typedef typename CGAL::dynamic_vertex_property_t<typename Base::FT> Vertex_property_tag;
   typedef typename boost::property_map<PolygonMesh,
                                        Vertex_property_tag>::type VertexSizingMap;
+  typedef Principal_curvatures_and_directions<typename Base::K> Principal_curvatures;
+  typedef typename CGAL::dynamic_vertex_property_t<Principal_curvatures> Vertex_curvature_tag;
+  typedef typename boost::property_map<PolygonMesh,
+                                       Vertex_curvature_tag>::type VertexCurvatureMap;
+  typedef typename boost::property_map<PolygonMesh,
+                                       CGAL::dynamic_face_property_t<bool> >::type FaceSelectionMap;
 
 public:
   typedef typename Base::K          K;
@@ -102,6 +112,13 @@ public:
   *   \cgalParamNBegin{ball_radius}
   *     \cgalParamDescription{`ball_radius` parameter passed to `interpolated_corrected_curvatures()`}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{average_edge_length}
+  *     \cgalParamDescription{`average_edge_length` parameter passed to `interpolated_corrected_curvatures()`
+  *                           and `update_interpolated_corrected_curvatures()`}
+  *     \cgalParamDefault{the average length of the edges of the faces used to compute the curvatures,
+  *                       computed once by the constructor}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   */
   template <typename FaceRange
@@ -118,44 +135,75 @@ public:
                 parameters::get_parameter(np, internal_np::vertex_point),
                 get_property_map(vertex_point, pmesh)))
     , m_vertex_sizing_map(get(Vertex_property_tag(), pmesh))
+    , m_vertex_curvature_map(get(Vertex_curvature_tag(), pmesh))
+    , m_ball_radius(parameters::choose_parameter(
+                      parameters::get_parameter(np, internal_np::ball_radius), -1))
+    , m_average_edge_length(parameters::choose_parameter(
+                              parameters::get_parameter(np, internal_np::average_edge_length), -1))
   {
     if (face_range.size() == faces(pmesh).size())
     {
       // calculate curvature from the whole mesh
-      calc_sizing_map(pmesh, np);
+      calc_sizing_map(pmesh);
     }
     else
     {
       // expand face selection and calculate curvature from it
       std::vector<face_descriptor> selection(face_range.begin(), face_range.end());
-      auto is_selected = get(CGAL::dynamic_face_property_t<bool>(), pmesh);
+      FaceSelectionMap is_selected = get(CGAL::dynamic_face_property_t<bool>(), pmesh, false);
       for (face_descriptor f : faces(pmesh)) put(is_selected, f, false);
       for (face_descriptor f : face_range)  put(is_selected, f, true);
       expand_face_selection(selection, pmesh, 1,
                             is_selected, std::back_inserter(selection));
       Face_filtered_graph<PolygonMesh> ffg(pmesh, selection);
 
-      calc_sizing_map(ffg, np);
+      calc_sizing_map(ffg);
+
+      // the selection is kept for the updates
+      m_face_selection = is_selected;
     }
   }
 
   ///@}
 
-private:
-  template <typename FaceGraph
-          , typename NamedParameters = parameters::Default_named_parameters>
-  void calc_sizing_map(FaceGraph& face_graph
-                     , const NamedParameters& np)
+  /// \name Update
+  /// @{
+  /*!
+  * updates the sizing field after a modification of `pmesh`, for example between two calls
+  * to `isotropic_remeshing()`. The curvatures are recomputed only around the faces of `changed_faces`,
+  * using `update_interpolated_corrected_curvatures()` with the average edge length of the initial computation,
+  * and the sizing field is updated at the vertices whose curvatures have been recomputed.
+  * If the sizing field was created from a subset of the faces of `pmesh`, the faces of `changed_faces`
+  * are added to this subset, and the curvatures are computed using the faces of this subset only.
+  *
+  * @tparam FaceRange range of `boost::graph_traits<PolygonMesh>::%face_descriptor`,
+  *         model of `Range`. Its iterator type is `ForwardIterator`.
+  *
+  * @param changed_faces the faces of `pmesh` that have been created or whose vertices have been moved
+  *        since the sizing field was computed or last updated. If some faces have been removed,
+  *        the faces incident to the vertices of the removed faces must also be part of this range.
+  * @param pmesh the polygon mesh the sizing field was created with.
+  */
+  template <typename FaceRange>
+  void update(const FaceRange& changed_faces, PolygonMesh& pmesh)
   {
-    typedef Principal_curvatures_and_directions<K> Principal_curvatures;
-    typedef typename CGAL::dynamic_vertex_property_t<Principal_curvatures> Vertex_curvature_tag;
-    typedef typename boost::property_map<FaceGraph,
-      Vertex_curvature_tag>::type Vertex_curvature_map;
+    if (m_face_selection)
+    {
+      for (face_descriptor f : changed_faces)
+        put(*m_face_selection, f, true);
+      Face_filtered_graph<PolygonMesh> ffg(pmesh, true, *m_face_selection);
 
-    using parameters::choose_parameter;
-    using parameters::get_parameter;
-    typename Base::FT radius = choose_parameter(get_parameter(np, internal_np::ball_radius), -1);
+      update_sizing_map(changed_faces, ffg);
+    }
+    else
+      update_sizing_map(changed_faces, pmesh);
+  }
+  ///@}
 
+private:
+  template <typename FaceGraph>
+  void calc_sizing_map(FaceGraph& face_graph)
+  {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     int oversize  = 0;
     int undersize = 0;
@@ -163,38 +211,25 @@ private:
     std::cout << "Calculating sizing field..." << std::endl;
 #endif
 
-    Vertex_curvature_map vertex_curvature_map = get(Vertex_curvature_tag(), face_graph);
+    if (m_average_edge_length < 0)
+      m_average_edge_length = average_edge_length(face_graph);
     interpolated_corrected_curvatures(face_graph,
-                                      parameters::vertex_principal_curvatures_and_directions_map(vertex_curvature_map)
-                                                 .ball_radius(radius));
+                                      parameters::vertex_principal_curvatures_and_directions_map(m_vertex_curvature_map)
+                                                 .ball_radius(m_ball_radius)
+                                                 .average_edge_length(m_average_edge_length));
     // calculate vertex sizing field L(x_i) from the curvature field
     for(vertex_descriptor v : vertices(face_graph))
     {
-      auto vertex_curv = get(vertex_curvature_map, v);
-      const FT max_absolute_curv = (CGAL::max)(CGAL::abs(vertex_curv.max_curvature),
-                                               CGAL::abs(vertex_curv.min_curvature));
-      const FT vertex_size_sq = 6 * tol / max_absolute_curv - 3 * CGAL::square(tol);
-      if (vertex_size_sq > CGAL::square(m_long))
-      {
-        put(m_vertex_sizing_map, v, m_long);
+      const FT vertex_size = sizing_from_curvatures(v);
+      put(m_vertex_sizing_map, v, vertex_size);
 #ifdef CGAL_PMP_REMESHING_VERBOSE
+      if (vertex_size == m_long)
         ++oversize;
-#endif
-      }
-      else if (vertex_size_sq < CGAL::square(m_short))
-      {
-        put(m_vertex_sizing_map, v, m_short);
-#ifdef CGAL_PMP_REMESHING_VERBOSE
+      else if (vertex_size == m_short)
         ++undersize;
-#endif
-      }
       else
-      {
-        put(m_vertex_sizing_map, v, CGAL::approximate_sqrt(vertex_size_sq));
-#ifdef CGAL_PMP_REMESHING_VERBOSE
         ++insize;
 #endif
-      }
     }
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << " done (" << insize << " from curvature, "
@@ -203,6 +238,35 @@ private:
 #endif
   }
 
+  template <typename FaceRange, typename FaceGraph>
+  void update_sizing_map(const FaceRange& changed_faces, FaceGraph& face_graph)
+  {
+    std::vector<vertex_descriptor> updated_vertices;
+    update_interpolated_corrected_curvatures(changed_faces,
+                                             face_graph,
+                                             parameters::vertex_principal_curvatures_and_directions_map(m_vertex_curvature_map)
+                                                        .ball_radius(m_ball_radius)
+                                                        .average_edge_length(m_average_edge_length)
+                                                        .vertex_output_iterator(std::back_inserter(updated_vertices)));
+
+    for (vertex_descriptor v : updated_vertices)
+      put(m_vertex_sizing_map, v, sizing_from_curvatures(v));
+  }
+
+  FT sizing_from_curvatures(const vertex_descriptor v) const
+  {
+    auto vertex_curv = get(m_vertex_curvature_map, v);
+    const FT max_absolute_curv = (CGAL::max)(CGAL::abs(vertex_curv.max_curvature),
+                                             CGAL::abs(vertex_curv.min_curvature));
+    const FT vertex_size_sq = 6 * tol / max_absolute_curv - 3 * CGAL::square(tol);
+    if (vertex_size_sq > CGAL::square(m_long))
+      return m_long;
+    else if (vertex_size_sq < CGAL::square(m_short))
+      return m_short;
+    else
+      return CGAL::approximate_sqrt(vertex_size_sq);
+  }
+
   FT sqlength(const vertex_descriptor va,
               const vertex_descriptor vb) const
   {
@@ -274,6 +338,10 @@ private:
   const FT m_long;
   const VPMap m_vpmap;
   VertexSizingMap m_vertex_sizing_map;
+  VertexCurvatureMap m_vertex_curvature_map;
+  const FT m_ball_radius;
+  FT m_average_edge_length;
+  std::optional<FaceSelectionMap> m_face_selection;
 };
 
 }//end namespace Polygon_mesh_processing
@@ -0,0 +1,523 @@
+// Copyright (c) 2025 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+//
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_AUTOREFINE_AND_COMPUTE_BOOLEAN_OPERATIONS_H
+#define CGAL_POLYGON_MESH_PROCESSING_AUTOREFINE_AND_COMPUTE_BOOLEAN_OPERATIONS_H
+
+#include <CGAL/license/Polygon_mesh_processing/autorefinement.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#include <CGAL/Polygon_mesh_processing/polygon_mesh_to_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup_extension.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_triangle_primitive_3.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+namespace internal {
+
+// keeps track of the input triangle each output triangle of the autorefinement comes from
+struct Triangle_source_visitor
+  : public Autorefinement::Default_visitor
+{
+  std::vector<std::size_t>* sources;
+
+  Triangle_source_visitor(std::vector<std::size_t>& sources) : sources(&sources) {}
+
+  void number_of_output_triangles(std::size_t nbt) { sources->resize(nbt); }
+  void verbatim_triangle_copy(std::size_t tgt_id, std::size_t src_id) { (*sources)[tgt_id] = src_id; }
+  void new_subtriangle(std::size_t tgt_id, std::size_t src_id) { (*sources)[tgt_id] = src_id; }
+};
+
+// Computes the triangles bounding the region of the points whose winding number with respect
+// to the meshes of an autorefined soup is at least `min_winding_number`.
+// `mesh_ids[t]` is the index of the mesh the triangle `t` comes from.
+// The triangles are grouped into patches, which are not crossed by any other triangle,
+// and each patch is classified at once using the winding numbers on both of its sides.
+// Returns `false` without modifying `tm_out` if a patch cannot be classified.
+template <class Concurrency_tag, class GT, class TriangleMesh, class NamedParametersOut>
+bool compute_boolean_operation_in_refined_soup(std::vector<typename GT::Point_3>& points,
+                                               std::vector<std::array<std::size_t, 3> >& triangles,
+                                               const std::vector<std::size_t>& mesh_ids,
+                                               const std::size_t min_winding_number,
+                                               TriangleMesh& tm_out,
+                                               const GT& gt,
+                                               const NamedParametersOut& np_out)
+{
+  typedef typename GT::Point_3                                             Point_3;
+  typedef typename GT::Vector_3                                            Vector_3;
+  typedef typename GT::Segment_3                                           Segment_3;
+  typedef typename GT::Triangle_3                                          Triangle_3;
+  typedef std::array<std::size_t, 3>                                       Triangle;
+
+  const std::size_t nb_triangles = triangles.size();
+
+  // 1) identical input points are kept by the autorefinement: use a unique id per point,
+  // so that the triangles of different meshes can be compared
+  {
+    std::map<Point_3, std::size_t, typename GT::Less_xyz_3> unique_ids(gt.less_xyz_3_object());
+    std::vector<std::size_t> point_ids(points.size());
+    for(std::size_t i=0; i<points.size(); ++i)
+      point_ids[i] = unique_ids.emplace(points[i], i).first->second;
+    for(Triangle& t : triangles)
+      for(std::size_t& i : t)
+        i = point_ids[i];
+  }
+
+  // 2) group identical triangles (coplanar parts of different meshes), whatever their orientation
+  std::vector<std::size_t> group_ids(nb_triangles);
+  std::vector<std::size_t> group_representatives;
+  {
+    std::map<Triangle, std::size_t> groups;
+    for(std::size_t t=0; t<nb_triangles; ++t)
+    {
+      Triangle key = triangles[t];
+      std::sort(key.begin(), key.end());
+      auto res = groups.emplace(key, group_representatives.size());
+      if(res.second)
+        group_representatives.push_back(t);
+      group_ids[t] = res.first->second;
+    }
+  }
+
+  // the number of triangles of each group with the same orientation as the representative,
+  // minus the number of triangles with the opposite orientation
+  std::vector<int> orientation_balances(group_representatives.size(), 0);
+  std::vector<std::size_t> group_sizes(group_representatives.size(), 0);
+  for(std::size_t t=0; t<nb_triangles; ++t)
+  {
+    const std::size_t g = group_ids[t];
+    const Triangle& ref = triangles[group_representatives[g]];
+    const Triangle& tr = triangles[t];
+    const std::size_t i = std::find(ref.begin(), ref.end(), tr[0]) - ref.begin();
+    orientation_balances[g] += (ref[(i+1)%3] == tr[1]) ? 1 : -1;
+    ++group_sizes[g];
+  }
+
+  // 3) patches: triangles from the same mesh connected by edges with no other incident triangle
+  std::vector<std::size_t> patch_ids(nb_triangles);
+  for(std::size_t t=0; t<nb_triangles; ++t)
+    patch_ids[t] = t;
+  auto find_patch = [&patch_ids](std::size_t t)
+  {
+    while(patch_ids[t] != t)
+      t = patch_ids[t] = patch_ids[patch_ids[t]];
+    return t;
+  };
+
+  {
+    std::map<std::pair<std::size_t, std::size_t>, std::vector<std::size_t> > edge_to_triangles;
+    for(std::size_t t=0; t<nb_triangles; ++t)
+    {
+      for(int i=0; i<3; ++i)
+      {
+        std::size_t v0 = triangles[t][i], v1 = triangles[t][(i+1)%3];
+        if(v0 > v1)
+          std::swap(v0, v1);
+        edge_to_triangles[std::make_pair(v0, v1)].push_back(t);
+      }
+    }
+
+    for(const auto& e_and_triangles : edge_to_triangles)
+    {
+      const std::vector<std::size_t>& incident_triangles = e_and_triangles.second;
+      if(incident_triangles.size() != 2)
+        continue;
+      const std::size_t t0 = incident_triangles[0], t1 = incident_triangles[1];
+      if(group_sizes[group_ids[t0]] != 1 || group_sizes[group_ids[t1]] != 1 ||
+         mesh_ids[t0] != mesh_ids[t1])
+        continue;
+      patch_ids[find_patch(t0)] = find_patch(t1);
+    }
+  }
+
+  // the triangles of each patch, sorted by patch, among which one is picked to classify the patch
+  std::vector<std::size_t> patch_offsets(1, 0);
+  std::vector<std::size_t> patch_triangles(nb_triangles);
+  std::vector<std::size_t> triangle_patches(nb_triangles);
+  {
+    std::vector<std::size_t> root_to_patch(nb_triangles, nb_triangles);
+    for(std::size_t t=0; t<nb_triangles; ++t)
+    {
+      std::size_t& p = root_to_patch[find_patch(t)];
+      if(p == nb_triangles)
+      {
+        p = patch_offsets.size() - 1;
+        patch_offsets.push_back(0);
+      }
+      triangle_patches[t] = p;
+      ++patch_offsets[p+1];
+    }
+    for(std::size_t p=1; p<patch_offsets.size(); ++p)
+      patch_offsets[p] += patch_offsets[p-1];
+    std::vector<std::size_t> next(patch_offsets.begin(), patch_offsets.end() - 1);
+    for(std::size_t t=0; t<nb_triangles; ++t)
+      patch_triangles[next[triangle_patches[t]]++] = t;
+  }
+  const std::size_t nb_patches = patch_offsets.size() - 1;
+
+  // 4) winding numbers on both sides of each patch, using the signed number of crossings
+  //    of a segment going out of the bounding box of the soup
+  typename GT::Orientation_3 orientation = gt.orientation_3_object();
+  typename GT::Collinear_3 collinear = gt.collinear_3_object();
+
+  std::vector<Triangle_3> geometric_triangles;
+  std::vector<bool> is_degenerate(nb_triangles);
+  geometric_triangles.reserve(nb_triangles);
+  for(std::size_t t=0; t<nb_triangles; ++t)
+  {
+    const Triangle& tr = triangles[t];
+    geometric_triangles.emplace_back(points[tr[0]], points[tr[1]], points[tr[2]]);
+    is_degenerate[t] = collinear(points[tr[0]], points[tr[1]], points[tr[2]]);
+  }
+
+  typedef typename std::vector<Triangle_3>::const_iterator                 Triangle_iterator;
+  typedef AABB_triangle_primitive_3<GT, Triangle_iterator>                 Primitive;
+  typedef AABB_traits_3<GT, Primitive>                                     AABB_traits;
+  typedef AABB_tree<AABB_traits>                                           Tree;
+
+  // degenerate triangles have no area and do not change the winding numbers
+  Tree tree;
+  for(Triangle_iterator it=geometric_triangles.begin(); it!=geometric_triangles.end(); ++it)
+    if(!is_degenerate[it - geometric_triangles.cbegin()])
+      tree.insert(Primitive(it));
+  tree.build();
+
+  Bbox_3 bb;
+  for(const Point_3& p : points)
+    bb += p.bbox();
+  const double diagonal = std::sqrt(CGAL::square(bb.xmax() - bb.xmin()) +
+                                    CGAL::square(bb.ymax() - bb.ymin()) +
+                                    CGAL::square(bb.zmax() - bb.zmin()));
+
+  enum Patch_status { DISCARDED = 0, KEPT, REVERSED, UNCLASSIFIED };
+  std::vector<Patch_status> patch_status(nb_patches, UNCLASSIFIED);
+
+  // Shoots segments from the centroid of the triangle `rep` to classify its patch.
+  // A shot is discarded if the segment is in the plane of `rep`, or goes through an edge
+  // or a vertex of another triangle. Returns `false` if all the shots are discarded.
+  const int max_number_of_shots = 20;
+  auto classify = [&](const std::size_t rep, CGAL::Random& rng, Patch_status& status) -> bool
+  {
+    const std::size_t g = group_ids[rep];
+    const Triangle_3& tr = geometric_triangles[rep];
+    const Point_3 c = gt.construct_centroid_3_object()(tr[0], tr[1], tr[2]);
+
+    std::vector<Triangle_iterator> hits;
+    for(int shot=0; shot<max_number_of_shots; ++shot)
+    {
+      const Vector_3 d(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+      const double l = std::sqrt(CGAL::to_double(d.squared_length()));
+      if(l < 0.1)
+        continue;
+      const Point_3 q = c + d * (2 * diagonal / l);
+
+      // the side of the patch the segment goes to
+      const Orientation side = orientation(tr[0], tr[1], tr[2], q);
+      if(side == COPLANAR)
+        continue;
+
+      hits.clear();
+      tree.all_intersected_primitives(Segment_3(c, q), std::back_inserter(hits));
+
+      int winding_number = 0;
+      bool degenerate = false;
+      for(const Triangle_iterator& it : hits)
+      {
+        const std::size_t t = it - geometric_triangles.cbegin();
+        if(group_ids[t] == g)
+          continue;
+
+        const Triangle_3& ot = *it;
+        const Orientation oc = orientation(ot[0], ot[1], ot[2], c),
+                          oq = orientation(ot[0], ot[1], ot[2], q);
+        if(oc == COPLANAR || oq == COPLANAR)
+        {
+          degenerate = true;
+          break;
+        }
+        if(oc == oq)
+          continue;
+
+        const Orientation o0 = orientation(c, q, ot[0], ot[1]),
+                          o1 = orientation(c, q, ot[1], ot[2]),
+                          o2 = orientation(c, q, ot[2], ot[0]);
+        if(o0 == COPLANAR || o1 == COPLANAR || o2 == COPLANAR)
+        {
+          // the segment goes through an edge or a vertex of `ot`
+          if((o0 == POSITIVE || o1 == POSITIVE || o2 == POSITIVE) !=
+             (o0 == NEGATIVE || o1 == NEGATIVE || o2 == NEGATIVE))
+          {
+            degenerate = true;
+            break;
+          }
+          continue;
+        }
+        if(o0 != o1 || o1 != o2)
+          continue;
+
+        // leaving the volume bounded by a mesh increases the winding number of the origin
+        winding_number += (oc == NEGATIVE) ? 1 : -1;
+      }
+
+      if(degenerate)
+        continue;
+
+      // the winding numbers on the positive (normal) and negative sides of the representative
+      const int positive_side = (side == POSITIVE) ? winding_number
+                                                   : winding_number - orientation_balances[g];
+      const int negative_side = positive_side + orientation_balances[g];
+
+      const int k = static_cast<int>(min_winding_number);
+      if(negative_side >= k && positive_side < k)
+        status = KEPT;
+      else if(positive_side >= k && negative_side < k)
+        status = REVERSED;
+      else
+        status = DISCARDED;
+      return true;
+    }
+    return false;
+  };
+
+  std::vector<std::size_t> patch_range(nb_patches);
+  for(std::size_t p=0; p<nb_patches; ++p)
+    patch_range[p] = p;
+
+  CGAL::for_each<Concurrency_tag>(patch_range, [&](const std::size_t p)
+  {
+    // the random directions only depend on the patch, so that the result does not
+    // depend on the number of threads
+    CGAL::Random rng(static_cast<unsigned int>(p));
+
+    // the triangles of a patch are on the same side of the other triangles: if the shots
+    // from a triangle all fail (e.g. it is degenerate after the rounding of the autorefinement),
+    // another one is used
+    for(std::size_t i=patch_offsets[p]; i<patch_offsets[p+1]; ++i)
+    {
+      const std::size_t rep = group_representatives[group_ids[patch_triangles[i]]];
+      if(!is_degenerate[rep] && classify(rep, rng, patch_status[p]))
+        break;
+    }
+    return true;
+  });
+
+  if(std::find(patch_status.begin(), patch_status.end(), UNCLASSIFIED) != patch_status.end())
+    return false;
+
+  // 5) extraction of the kept triangles, once per group
+  std::vector<Triangle> out_triangles;
+  for(std::size_t t=0; t<nb_triangles; ++t)
+  {
+    if(group_representatives[group_ids[t]] != t)
+      continue;
+    const Patch_status status = patch_status[triangle_patches[t]];
+    if(status == DISCARDED)
+      continue;
+    out_triangles.push_back(triangles[t]);
+    if(status == REVERSED)
+      std::swap(out_triangles.back()[1], out_triangles.back()[2]);
+  }
+
+  remove_isolated_points_in_polygon_soup(points, out_triangles);
+  const bool is_manifold = duplicate_non_manifold_edges_in_polygon_soup(points, out_triangles);
+  polygon_soup_to_polygon_mesh(points, out_triangles, tm_out, parameters::default_values(), np_out);
+
+  return is_manifold;
+}
+
+// Autorefines all the input meshes together, and computes the triangles bounding the region
+// of the points whose winding number with respect to the input meshes is at least `min_winding_number`.
+template <class TriangleMeshRange, class TriangleMesh, class NamedParametersIn, class NamedParametersOut>
+bool autorefine_and_compute_boolean_operation(const TriangleMeshRange& meshes,
+                                              const std::size_t min_winding_number,
+                                              TriangleMesh& tm_out,
+                                              const NamedParametersIn& np_in,
+                                              const NamedParametersOut& np_out)
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename GetGeomTraits<TriangleMesh, NamedParametersIn>::type     GT;
+  typedef typename GT::Point_3                                             Point_3;
+  typedef std::array<std::size_t, 3>                                       Triangle;
+
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParametersIn,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
+  GT gt = choose_parameter<GT>(get_parameter(np_in, internal_np::geom_traits));
+
+  // put all the meshes in a single soup, and autorefine it
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  std::vector<std::size_t> triangle_mesh_ids;
+  std::size_t nb_meshes = 0;
+  for(const TriangleMesh& tm : meshes)
+  {
+    CGAL_precondition(is_triangle_mesh(tm));
+    polygon_mesh_to_polygon_soup(tm, points, triangles, np_in);
+    triangle_mesh_ids.resize(triangles.size(), nb_meshes++);
+  }
+
+  if(nb_meshes == 0)
+    return true;
+
+  std::vector<std::size_t> sources;
+  autorefine_triangle_soup(points, triangles,
+                           parameters::visitor(Triangle_source_visitor(sources))
+                                      .concurrency_tag(Concurrency_tag())
+                                      .geom_traits(gt));
+
+  std::vector<std::size_t> mesh_ids(triangles.size());
+  for(std::size_t t=0; t<triangles.size(); ++t)
+    mesh_ids[t] = triangle_mesh_ids[sources[t]];
+
+  return compute_boolean_operation_in_refined_soup<Concurrency_tag>(points, triangles, mesh_ids,
+                                                                    min_winding_number, tm_out, gt, np_out);
+}
+
+} // namespace internal
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * puts in `tm_out` a triangulated surface mesh \link coref_def_subsec bounding \endlink the union
+ * of the volumes bounded by the meshes in `meshes`.
+ * All the input meshes are autorefined together, using `autorefine_triangle_soup()`.
+ * The resulting triangles are then classified by patches, using the winding number of the input meshes on both sides
+ * of each patch, and the output is extracted once. Contrary to successive calls to `corefine_and_compute_union()`,
+ * no intermediate result is computed. The result is inserted into `tm_out` without clearing it first.
+ *
+ * \pre Each mesh in `meshes` bounds a volume and is outward oriented.
+ *
+ * @tparam TriangleMeshRange a model of `ConstRange` whose value type is `TriangleMesh`
+ * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`
+ * @tparam NamedParametersIn a sequence of \ref bgl_namedparameters "Named Parameters"
+ * @tparam NamedParametersOut a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param meshes the input triangulated surface meshes
+ * @param tm_out output surface mesh
+ * @param np_in an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below,
+ *        used for all the input meshes
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{vertex_point_map}
+ *     \cgalParamDescription{a property map associating points to the vertices of the input meshes}
+ *     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+ *                    as key type and `%Point_3` as value type}
+ *     \cgalParamDefault{`boost::get(CGAL::vertex_point, tm)`}
+ *     \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+ *                     must be available in `TriangleMesh`.}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a class model of `Kernel` with exact predicates}
+ *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+ *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{The autorefinement and the classification of the patches are done concurrently.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{vertex_point_map}
+ *     \cgalParamDescription{a property map associating points to the vertices of `tm_out`}
+ *     \cgalParamType{a class model of `WritablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+ *                    as key type and `%Point_3` as value type}
+ *     \cgalParamDefault{`boost::get(CGAL::vertex_point, tm_out)`}
+ *     \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+ *                     must be available in `TriangleMesh`.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * @return `true` if the output surface mesh is manifold. If `false` is returned, the vertices on
+ *         non-manifold edges were duplicated to build `tm_out`, or a patch of the refined meshes
+ *         could not be classified, in which case `tm_out` is not modified. The latter only happens
+ *         if all the triangles of the patch are degenerate after the rounding of the intersection points.
+ *
+ * @note The points of the intersections are rounded to the point type of the input meshes.
+ *
+ * @sa `autorefine_and_compute_intersection()`
+ * @sa `corefine_and_compute_union()`
+ */
+template <class TriangleMeshRange,
+          class TriangleMesh,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+autorefine_and_compute_union(const TriangleMeshRange& meshes,
+                                   TriangleMesh& tm_out,
+                             const NamedParametersIn& np_in = parameters::default_values(),
+                             const NamedParametersOut& np_out = parameters::default_values())
+{
+  return internal::autorefine_and_compute_boolean_operation(meshes, 1, tm_out, np_in, np_out);
+}
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * puts in `tm_out` a triangulated surface mesh \link coref_def_subsec bounding \endlink the intersection
+ * of the volumes bounded by the meshes in `meshes`.
+ * All the input meshes are autorefined together, using `autorefine_triangle_soup()`.
+ * The resulting triangles are then classified by patches, using the winding number of the input meshes on both sides
+ * of each patch, and the output is extracted once. The result is inserted into `tm_out` without clearing it first.
+ *
+ * \pre Each mesh in `meshes` bounds a volume and is outward oriented.
+ *
+ * See `autorefine_and_compute_union()` for the description of the parameters.
+ *
+ * @sa `corefine_and_compute_intersection()`
+ */
+template <class TriangleMeshRange,
+          class TriangleMesh,
+          class NamedParametersIn = parameters::Default_named_parameters,
+          class NamedParametersOut = parameters::Default_named_parameters>
+bool
+autorefine_and_compute_intersection(const TriangleMeshRange& meshes,
+                                          TriangleMesh& tm_out,
+                                    const NamedParametersIn& np_in = parameters::default_values(),
+                                    const NamedParametersOut& np_out = parameters::default_values())
+{
+  const std::size_t nb_meshes = std::distance(std::begin(meshes), std::end(meshes));
+  return internal::autorefine_and_compute_boolean_operation(meshes, nb_meshes, tm_out, np_in, np_out);
+}
+
+} } // end of CGAL::Polygon_mesh_processing
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_AUTOREFINE_AND_COMPUTE_BOOLEAN_OPERATIONS_H
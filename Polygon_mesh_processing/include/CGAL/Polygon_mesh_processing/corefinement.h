@@ -232,6 +232,15 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the intersections of the edges of each mesh with
+  *                     the faces of the other mesh, and the triangulations of the intersected faces are computed
+  *                     concurrently. The output does not depend on this tag nor on the number of threads.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param nps_out an optional tuple of sequences of \ref bgl_namedparameters "Named Parameters" each among the ones listed below
@@ -459,6 +468,12 @@ corefine_and_compute_boolean_operations(
   > ::type User_visitor;
   User_visitor uv(choose_parameter<User_visitor>(get_parameter(np1, internal_np::visitor)));
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NPIn1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   // surface intersection algorithm call
   typedef Corefinement::Face_graph_output_builder<TriangleMesh,
                                                   VPM1,
@@ -472,7 +487,8 @@ corefine_and_compute_boolean_operations(
                                                   User_visitor> Ob;
 
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor> Algo_visitor;
+            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor,
+            false, false, Concurrency_tag> Algo_visitor;
 
   Ecm_in ecm_in(tm1,tm2,ecm1,ecm2);
   Edge_mark_map_tuple ecms_out(ecm_out_0, ecm_out_1, ecm_out_2, ecm_out_3);
@@ -490,7 +506,7 @@ corefine_and_compute_boolean_operations(
     ob.setup_for_clipping_a_surface(use_compact_clipper);
   }
 
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor >
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm_in));
   functor(CGAL::Emptyset_iterator(), throw_on_self_intersection, true);
 
@@ -571,6 +587,15 @@ corefine_and_compute_boolean_operations(
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the intersections of the edges of each mesh with
+  *                     the faces of the other mesh, and the triangulations of the intersected faces are computed
+  *                     concurrently. The output does not depend on this tag nor on the number of threads.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -738,6 +763,16 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  *     \cgalParamDefault{`false`}
  *     \cgalParamExtra{`np1` only}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the intersections of the edges of each mesh with
+ *                     the faces of the other mesh, and the triangulations of the intersected faces are computed
+ *                     concurrently. The output does not depend on this tag nor on the number of threads.}
+ *   \cgalParamNEnd
+ *
  *   \cgalParamNBegin{do_not_modify}
  *     \cgalParamDescription{if `true`, the corresponding mesh will not be updated.}
  *     \cgalParamType{Boolean}
@@ -827,14 +862,20 @@ corefine(      TriangleMesh& tm1,
     !parameters::is_default_parameter<NamedParameters1, internal_np::non_manifold_feature_map_t>::value ||
     !parameters::is_default_parameter<NamedParameters2, internal_np::non_manifold_feature_map_t>::value;
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
 // surface intersection algorithm call
   typedef Corefinement::No_extra_output_from_corefinement<TriangleMesh> Ob;
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features> Algo_visitor;
+  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features, Concurrency_tag> Algo_visitor;
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor>
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm,const_mesh_ptr), const_mesh_ptr);
 
   // Fill non-manifold feature maps if provided
@@ -21,6 +21,7 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/face_graph_utils.h>
 #include <CGAL/utility.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Projection_traits_3.h>
@@ -29,6 +30,13 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 
+#include <memory>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 namespace CGAL{
 namespace Polygon_mesh_processing {
 namespace Corefinement{
@@ -440,7 +448,8 @@ template< class TriangleMesh,
           class EdgeMarkMapBind_ = Default,
           class UserVisitor_ = Default,
           bool doing_autorefinement = false,
-          bool handle_non_manifold_features = false >
+          bool handle_non_manifold_features = false,
+          class ConcurrencyTag = Sequential_tag >
 class Surface_intersection_visitor_for_corefinement{
 //default template parameters
   typedef typename Default::Get<EdgeMarkMapBind_,
@@ -1188,349 +1197,516 @@ public:
     }
   }
 
-  template <class OnFaceMapIterator, class VPM>
-  void triangulate_intersected_faces(OnFaceMapIterator it,
-                                     const VPM& vpm,
-                                     INodes& nodes,
-                                     std::map<TriangleMesh*, Face_boundaries>& mesh_to_face_boundaries)
-  {
-    TriangleMesh& tm=*it->first;
-    CGAL_assertion(&tm!=const_mesh_ptr);
+  // the constrained triangulation of an intersected face, built before the face is
+  // retriangulated in the mesh
+  struct Face_triangulation
+  {
+    std::unique_ptr<CDT> cdt;
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    bool is_degenerate;
+  };
 
-    On_face_map& on_face_map=it->second;
-    Face_boundaries& face_boundaries=mesh_to_face_boundaries[&tm];
-    Node_id_to_vertex& node_id_to_vertex=mesh_to_node_id_to_vertex[&tm];
-    Vertex_to_node_id& vertex_to_node_id=mesh_to_vertex_to_node_id[&tm];
+  template <class VPM>
+  void init_face_triangulation(face_descriptor f,
+                               TriangleMesh& tm,
+                               typename Face_boundaries::iterator it_fb,
+                               const Face_boundaries& face_boundaries,
+                               Vertex_to_node_id& vertex_to_node_id,
+                               const VPM& vpm,
+                               const Node_id nb_nodes,
+                               Face_triangulation& ft)
+  {
+    std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    std::array<Node_id,3>& f_indices = ft.f_indices;
+    f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
+      f_vertices[0]=it_fb->second.vertices[0];
+      f_vertices[1]=it_fb->second.vertices[1];
+      f_vertices[2]=it_fb->second.vertices[2];
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      f_vertices[0]=target(h0,tm); //nb_nodes
+      f_vertices[1]=target(h1,tm); //nb_nodes+1
+      f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+      ft.edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
+      ft.edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
+      ft.edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+    }
 
-    const Node_id nb_nodes = nodes.size();
+    // handle possible presence of degenerate faces
+    ft.is_degenerate = const_mesh_ptr &&
+      collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) );
+  }
 
-    for (typename On_face_map::iterator it=on_face_map.begin();
-          it!=on_face_map.end();++it)
-    {
-      user_visitor.triangulating_faces_step();
-      face_descriptor f = it->first; //the face to be triangulated
-      Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
-      typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+  // returns `true` if the triangulation of the face uses the constraints collected
+  // from coplanar faces already triangulated (XSL_TAG_CPL_VERT)
+  bool depends_on_coplanar_constraints(const Node_ids& node_ids,
+                                       typename Face_boundaries::iterator it_fb,
+                                       const Face_boundaries& face_boundaries,
+                                       const Face_triangulation& ft) const
+  {
+    if (number_coplanar_vertices == 0)
+      return false;
+    for (int i=0;i<3;++i)
+      if (ft.f_indices[i] < number_coplanar_vertices)
+        return true;
+    for(Node_id id : node_ids)
+      if (id < number_coplanar_vertices)
+        return true;
+    if (it_fb!=face_boundaries.end())
+      for (int i=0;i<3;++i)
+        for(Node_id id : it_fb->second.node_ids_array[i])
+          if (id < number_coplanar_vertices)
+            return true;
+    return false;
+  }
 
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
+  // builds the constrained triangulation of `f`. It does not modify `tm`, and reads
+  // `coplanar_constraints` only if `depends_on_coplanar_constraints()` is `true`.
+  void build_face_triangulation(TriangleMesh& tm,
+                                Node_ids& node_ids,
+                                typename Face_boundaries::iterator it_fb,
+                                const Face_boundaries& face_boundaries,
+                                const INodes& nodes,
+                                const Node_id nb_nodes,
+                                const typename EK::Point_3& p,
+                                const typename EK::Point_3& q,
+                                const typename EK::Point_3& r,
+                                Face_triangulation& ft)
+  {
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = ft.id_to_CDT_vh;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    ft.cdt = std::make_unique<CDT>(traits);
+    CDT& cdt = *ft.cdt;
+
+    // insert triangle points
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=f_indices[0];
+    triangle_vertices[1]->info()=f_indices[1];
+    triangle_vertices[2]->info()=f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (it_fb!=face_boundaries.end()) //if f not a triangle?
+    {
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
       }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      const Face_boundary& f_boundary=it_fb->second;
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary.halfedges[i]);
+        edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
+          it_fb->second.halfedges[i];
       }
+    }
 
-      // handle possible presence of degenerate faces
-      if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,ft.constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
       {
-        Node_ids face_vertex_nids;
+        Node_ids& ids=it_fb->second.node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,ft.constrained_edges,1);
+      }
+    }
 
-        //check if one of the triangle input vertex is also a node
-        for (int ik=0;ik<3;++ik)
-          if ( f_indices[ik]<nb_nodes )
-            face_vertex_nids.push_back(f_indices[ik]);
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
 
-        // collect nodes on edges (if any)
-        if (it_fb != face_boundaries.end())
-        {
-          Face_boundary& f_boundary=it_fb->second;
-          for (int i=0;i<3;++i)
-            std::copy(f_boundary.node_ids_array[i].begin(),
-                      f_boundary.node_ids_array[i].end(),
-                      std::back_inserter(face_vertex_nids));
-        }
+  // triangulates the degenerate face `f` using only the edges of the intersection
+  void triangulate_degenerate_face(face_descriptor f,
+                                   TriangleMesh& tm,
+                                   typename Face_boundaries::iterator it_fb,
+                                   const Face_boundaries& face_boundaries,
+                                   Node_id_to_vertex& node_id_to_vertex,
+                                   const Node_id nb_nodes,
+                                   const Face_triangulation& ft)
+  {
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+    Node_ids face_vertex_nids;
 
-        std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
-        std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
-        for(Node_id id : face_vertex_nids)
+    //check if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik)
+      if ( f_indices[ik]<nb_nodes )
+        face_vertex_nids.push_back(f_indices[ik]);
+
+    // collect nodes on edges (if any)
+    if (it_fb != face_boundaries.end())
+    {
+      Face_boundary& f_boundary=it_fb->second;
+      for (int i=0;i<3;++i)
+        std::copy(f_boundary.node_ids_array[i].begin(),
+                  f_boundary.node_ids_array[i].end(),
+                  std::back_inserter(face_vertex_nids));
+    }
+
+    std::sort(face_vertex_nids.begin(), face_vertex_nids.end());
+    std::vector<std::array<std::pair<halfedge_descriptor,Node_id>,2>> constraints;
+    for(Node_id id : face_vertex_nids)
+    {
+      CGAL_assertion(id < graph_of_constraints.size());
+      const std::vector<Node_id>& neighbors=graph_of_constraints[id];
+      if (!neighbors.empty())
+      {
+        for(Node_id id_n :neighbors)
         {
-          CGAL_assertion(id < graph_of_constraints.size());
-          const std::vector<Node_id>& neighbors=graph_of_constraints[id];
-          if (!neighbors.empty())
+          if (id_n<id) continue;
+          if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
           {
-            for(Node_id id_n :neighbors)
-            {
-              if (id_n<id) continue;
-              if (std::binary_search(face_vertex_nids.begin(), face_vertex_nids.end(), id_n))
-              {
-                vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
-                                  vn = node_id_to_vertex.get_vertex(id_n);
-                bool is_face_border = false;
-                halfedge_descriptor h;
+            vertex_descriptor vi = node_id_to_vertex.get_vertex(id),
+                              vn = node_id_to_vertex.get_vertex(id_n);
+            bool is_face_border = false;
+            halfedge_descriptor h;
 
-                std::tie(h, is_face_border) = halfedge(vi,vn, tm);
-                if (is_face_border)
-                {
-                  call_put(marks_on_edges,tm,edge(h,tm),true);
-                  output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
-                }
-                else
-                {
-                  halfedge_descriptor hi=halfedge(vi, tm);
-                  while(face(hi, tm) != f)
-                    hi=opposite(next(hi, tm), tm);
-
-                  halfedge_descriptor hn=halfedge(vn, tm);
-                  while(face(hn, tm) != f)
-                    hn=opposite(next(hn, tm), tm);
-                  constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
-                }
-              }
+            std::tie(h, is_face_border) = halfedge(vi,vn, tm);
+            if (is_face_border)
+            {
+              call_put(marks_on_edges,tm,edge(h,tm),true);
+              output_builder.set_edge_per_polyline(tm,std::make_pair(id, id_n),h);
+            }
+            else
+            {
+              halfedge_descriptor hi=halfedge(vi, tm);
+              while(face(hi, tm) != f)
+                hi=opposite(next(hi, tm), tm);
+
+              halfedge_descriptor hn=halfedge(vn, tm);
+              while(face(hn, tm) != f)
+                hn=opposite(next(hn, tm), tm);
+              constraints.emplace_back(make_array(std::make_pair(hi,id),std::make_pair(hn, id_n)));
             }
           }
-          #ifdef CGAL_COREFINEMENT_DEBUG
-          else
-            std::cout << "X0bis: Found an isolated point" << std::endl;
-          #endif
         }
+      }
+      #ifdef CGAL_COREFINEMENT_DEBUG
+      else
+        std::cout << "X0bis: Found an isolated point" << std::endl;
+      #endif
+    }
 
-        CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
-        std::vector<face_descriptor> new_faces;
-        for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
-        {
-          halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
-          new_faces.push_back(face(opposite(nh, tm), tm));
-
-          call_put(marks_on_edges,tm,edge(nh,tm),true);
-          output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
-        }
+    CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
+    std::vector<face_descriptor> new_faces;
+    for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
+    {
+      halfedge_descriptor nh = Euler::split_face(a[0].first, a[1].first, tm);
+      new_faces.push_back(face(opposite(nh, tm), tm));
 
-        // now triangulate new faces
-        if (!new_faces.empty())
-        {
-          new_faces.push_back(f);
-          for(face_descriptor nf : new_faces)
-          {
-            halfedge_descriptor h = halfedge(nf, tm),
-                                nh = next(next(h,tm),tm);
-            while(next(nh, tm)!=h)
-              nh=next(Euler::split_face(h, nh, tm), tm);
-          }
-        }
+      call_put(marks_on_edges,tm,edge(nh,tm),true);
+      output_builder.set_edge_per_polyline(tm,std::make_pair(a[0].second, a[1].second),nh);
+    }
 
-        continue;
+    // now triangulate new faces
+    if (!new_faces.empty())
+    {
+      new_faces.push_back(f);
+      for(face_descriptor nf : new_faces)
+      {
+        halfedge_descriptor h = halfedge(nf, tm),
+                            nh = next(next(h,tm),tm);
+        while(next(nh, tm)!=h)
+          nh=next(Euler::split_face(h, nh, tm), tm);
       }
+    }
+  }
 
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
-
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
-
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
-
-      //if one of the triangle input vertex is also a node
+  // retriangulates `f` in `tm`. The triangulation of `f` is built first if it
+  // was not built beforehand.
+  template <class VPM>
+  void triangulate_intersected_face(face_descriptor f,
+                                    TriangleMesh& tm,
+                                    Node_ids& node_ids,
+                                    typename Face_boundaries::iterator it_fb,
+                                    const Face_boundaries& face_boundaries,
+                                    Node_id_to_vertex& node_id_to_vertex,
+                                    const VPM& vpm,
+                                    INodes& nodes,
+                                    const Node_id nb_nodes,
+                                    Face_triangulation& ft)
+  {
+    const std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+
+    if (it_fb!=face_boundaries.end() && (doing_autorefinement || handle_non_manifold_features))
+      it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
+
+    if (ft.is_degenerate)
+    {
+      triangulate_degenerate_face(f, tm, it_fb, face_boundaries, node_id_to_vertex, nb_nodes, ft);
+      return;
+    }
+
+    if (ft.cdt == nullptr)
+      build_face_triangulation(tm, node_ids, it_fb, face_boundaries, nodes, nb_nodes,
+                               nodes.to_exact(get(vpm,f_vertices[0])),
+                               nodes.to_exact(get(vpm,f_vertices[1])),
+                               nodes.to_exact(get(vpm,f_vertices[2])), ft);
+    CDT& cdt = *ft.cdt;
+
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
+
+    //if one of the triangle input vertex is also a node
+    if (doing_autorefinement || handle_non_manifold_features)
+    {
       for (int ik=0;ik<3;++ik){
         if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
-            // update the current vertex in node_id_to_vertex
-            // to match the one of the face
-            node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
-            // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
-            // it is OK not to store all vertices corresponding to this id as the approximate version
-            // is already tight and the call in Intersection_nodes::finalize() will not fix anything
-        }
+          // update the current vertex in node_id_to_vertex
+          // to match the one of the face
+          node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
+          // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
+          // it is OK not to store all vertices corresponding to this id as the approximate version
+          // is already tight and the call in Intersection_nodes::finalize() will not fix anything
       }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
+    }
 
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
+    //XSL_TAG_CPL_VERT
+    //collect edges incident to a point that is the intersection of two
+    // coplanar faces. This ensure that triangulations are compatible.
+    if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+    {
+      for (typename CDT::Finite_vertices_iterator
+            vit=cdt.finite_vertices_begin(),
+            vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
+      {
+        //skip original vertices (that are not nodes) and non-coplanar face
+        // issued vertices (this is working because intersection points
+        // between coplanar facets are the first inserted)
+        if (vit->info() >= nb_nodes ||
+            vit->info() >= number_coplanar_vertices) continue;
+        // \todo no need to insert constrained edges (they also are constrained
+        // in the other mesh)!!
+        typename std::map< Node_id,std::set<Node_id> >::iterator res =
+            coplanar_constraints.insert(
+                std::make_pair(vit->info(),std::set<Node_id>())).first;
+        //turn around the vertex and get incident edge
+        typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
+        typename CDT::Edge_circulator  curr=start;
+        do{
+          if (cdt.is_infinite(*curr) ) continue;
+          typename CDT::Edge mirror=cdt.mirror_edge(*curr);
+          if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
+               cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
+            continue; // skip edges that are on the boundary of the triangle
+                      // (these are already constrained)
+          //insert edges in the set of constraints
+          CDT_Vertex_handle vh=vit;
+          int nindex = curr->first->vertex((curr->second+1)%3)==vh
+                         ? (curr->second+2)%3
+                         : (curr->second+1)%3;
+          CDT_Vertex_handle vn=curr->first->vertex(nindex);
+          if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
+            continue; //take only one out of the two edges + skip input
+          CGAL_assertion(vn->info()<nb_nodes);
+          res->second.insert( vn->info() );
+        }while(start!=++curr);
       }
+    }
 
-      //insert point inside face
-      for(Node_id node_id : node_ids)
-      {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    // import the triangle in `cdt` in the face `f` of `tm`
+    triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
+      ft.edge_to_hedge, cdt, vpm, output_builder, user_visitor);
+
+    // TODO Here we do the update only for internal edges.
+    // Update for border halfedges could be done during the split
+
+    //3) mark halfedges that are common to two polyhedral surfaces
+    //recover halfedges inserted that are on the intersection
+    typedef std::pair<Node_id,Node_id> Node_id_pair;
+    for(const Node_id_pair& node_id_pair : ft.constrained_edges)
+    {
+      typename std::map<Node_id_pair,halfedge_descriptor>
+        ::iterator it_poly_hedge=ft.edge_to_hedge.find(node_id_pair);
+      //we cannot have an assertion here in case an edge or part of an edge is a constraints.
+      //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
+      //is defined as one of them defines an adjacent face
+      //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
+      if( it_poly_hedge!=ft.edge_to_hedge.end() ){
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
+      }
+      else{
+        //WARNING: in few case this is needed if the marked edge is on the border
+        //to optimize it might be better to only use sorted pair. TAG_SLXX1
+        Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
+        it_poly_hedge=ft.edge_to_hedge.find(opposite_pair);
+        CGAL_assertion( it_poly_hedge!=ft.edge_to_hedge.end() );
+
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
       }
+    }
+  }
 
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+  template <class OnFaceMapIterator, class VPM>
+  void triangulate_intersected_faces(OnFaceMapIterator it,
+                                     const VPM& vpm,
+                                     INodes& nodes,
+                                     std::map<TriangleMesh*, Face_boundaries>& mesh_to_face_boundaries)
+  {
+    TriangleMesh& tm=*it->first;
+    CGAL_assertion(&tm!=const_mesh_ptr);
 
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
+    On_face_map& on_face_map=it->second;
+    Face_boundaries& face_boundaries=mesh_to_face_boundaries[&tm];
+    Node_id_to_vertex& node_id_to_vertex=mesh_to_node_id_to_vertex[&tm];
+    Vertex_to_node_id& vertex_to_node_id=mesh_to_vertex_to_node_id[&tm];
+
+    const Node_id nb_nodes = nodes.size();
 
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_same_v<ConcurrencyTag, Parallel_tag>,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+    {
+      // The triangulations of a batch of faces are built concurrently, and then imported
+      // in the mesh sequentially, in the same order as in the sequential version.
+      // The triangulations of faces that depend on the constraints collected from coplanar
+      // faces are built during the import, so that the output is the same.
+      const std::size_t batch_size = 10000;
+      std::vector<typename On_face_map::iterator> batch;
+      batch.reserve(batch_size);
+
+      typename On_face_map::iterator it_f=on_face_map.begin();
+      while (it_f!=on_face_map.end())
       {
-        for (int i=0;i<3;++i)
+        batch.clear();
+        for(; it_f!=on_face_map.end() && batch.size()<batch_size; ++it_f)
+          batch.push_back(it_f);
+
+        std::vector<Face_triangulation> triangulations(batch.size());
+        std::vector<typename Face_boundaries::iterator> it_fbs(batch.size());
+        for (std::size_t i=0; i<batch.size(); ++i)
         {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
+          it_fbs[i]=face_boundaries.find(batch[i]->first);
+          init_face_triangulation(batch[i]->first, tm, it_fbs[i], face_boundaries,
+                                  vertex_to_node_id, vpm, nb_nodes, triangulations[i]);
         }
-      }
 
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
-      }
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          for (std::size_t i=r.begin(); i!=r.end(); ++i)
+          {
+            Face_triangulation& ft=triangulations[i];
+            if (ft.is_degenerate ||
+                depends_on_coplanar_constraints(batch[i]->second, it_fbs[i], face_boundaries, ft))
+              continue;
+            build_face_triangulation(tm, batch[i]->second, it_fbs[i], face_boundaries, nodes, nb_nodes,
+                                     nodes.to_exact(get(vpm,ft.f_vertices[0])),
+                                     nodes.to_exact(get(vpm,ft.f_vertices[1])),
+                                     nodes.to_exact(get(vpm,ft.f_vertices[2])), ft);
+          }
+        });
 
-      //XSL_TAG_CPL_VERT
-      //collect edges incident to a point that is the intersection of two
-      // coplanar faces. This ensure that triangulations are compatible.
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (typename CDT::Finite_vertices_iterator
-              vit=cdt.finite_vertices_begin(),
-              vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
+        for (std::size_t i=0; i<batch.size(); ++i)
         {
-          //skip original vertices (that are not nodes) and non-coplanar face
-          // issued vertices (this is working because intersection points
-          // between coplanar facets are the first inserted)
-          if (vit->info() >= nb_nodes ||
-              vit->info() >= number_coplanar_vertices) continue;
-          // \todo no need to insert constrained edges (they also are constrained
-          // in the other mesh)!!
-          typename std::map< Node_id,std::set<Node_id> >::iterator res =
-              coplanar_constraints.insert(
-                  std::make_pair(vit->info(),std::set<Node_id>())).first;
-          //turn around the vertex and get incident edge
-          typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
-          typename CDT::Edge_circulator  curr=start;
-          do{
-            if (cdt.is_infinite(*curr) ) continue;
-            typename CDT::Edge mirror=cdt.mirror_edge(*curr);
-            if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
-                 cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
-              continue; // skip edges that are on the boundary of the triangle
-                        // (these are already constrained)
-            //insert edges in the set of constraints
-            CDT_Vertex_handle vh=vit;
-            int nindex = curr->first->vertex((curr->second+1)%3)==vh
-                           ? (curr->second+2)%3
-                           : (curr->second+1)%3;
-            CDT_Vertex_handle vn=curr->first->vertex(nindex);
-            if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
-              continue; //take only one out of the two edges + skip input
-            CGAL_assertion(vn->info()<nb_nodes);
-            res->second.insert( vn->info() );
-          }while(start!=++curr);
+          user_visitor.triangulating_faces_step();
+          triangulate_intersected_face(batch[i]->first, tm, batch[i]->second, it_fbs[i], face_boundaries,
+                                       node_id_to_vertex, vpm, nodes, nb_nodes, triangulations[i]);
+          triangulations[i].cdt.reset();
         }
       }
+      return;
+    }
+#endif
 
-      // import the triangle in `cdt` in the face `f` of `tm`
-      triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
-        edge_to_hedge, cdt, vpm, output_builder, user_visitor);
-
-      // TODO Here we do the update only for internal edges.
-      // Update for border halfedges could be done during the split
+    for (typename On_face_map::iterator it=on_face_map.begin();
+          it!=on_face_map.end();++it)
+    {
+      user_visitor.triangulating_faces_step();
+      face_descriptor f = it->first; //the face to be triangulated
+      Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
+      typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
 
-      //3) mark halfedges that are common to two polyhedral surfaces
-      //recover halfedges inserted that are on the intersection
-      typedef std::pair<Node_id,Node_id> Node_id_pair;
-      for(const Node_id_pair& node_id_pair : constrained_edges)
-      {
-        typename std::map<Node_id_pair,halfedge_descriptor>
-          ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
-        //we cannot have an assertion here in case an edge or part of an edge is a constraints.
-        //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
-        //is defined as one of them defines an adjacent face
-        //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
-        if( it_poly_hedge!=edge_to_hedge.end() ){
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
-        }
-        else{
-          //WARNING: in few case this is needed if the marked edge is on the border
-          //to optimize it might be better to only use sorted pair. TAG_SLXX1
-          Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
-          it_poly_hedge=edge_to_hedge.find(opposite_pair);
-          CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
-
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
-        }
-      }
+      Face_triangulation ft;
+      init_face_triangulation(f, tm, it_fb, face_boundaries, vertex_to_node_id, vpm, nb_nodes, ft);
+      triangulate_intersected_face(f, tm, node_ids, it_fb, face_boundaries,
+                                   node_id_to_vertex, vpm, nodes, nb_nodes, ft);
     }
   }
 
@@ -26,6 +26,7 @@
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
 #include <CGAL/utility.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
@@ -34,6 +35,12 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
 
 namespace CGAL{
 namespace Polygon_mesh_processing {
@@ -194,7 +201,8 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
@@ -938,6 +946,41 @@ class Intersection_of_triangle_meshes
     }
   }
 
+  // computes concurrently the intersection type of each edge of `tm1` with the faces
+  // of `tm2` in its entry of `tm1_edge_to_tm2_faces`, in the order of the entries
+  template <typename VPM1, typename VPM2, typename Inter_type>
+  void compute_intersection_types(Edge_to_faces& tm1_edge_to_tm2_faces,
+                                  const TriangleMesh& tm1,
+                                  const TriangleMesh& tm2,
+                                  const VPM1& vpm1,
+                                  const VPM2& vpm2,
+                                  std::vector<std::vector<std::pair<face_descriptor, Inter_type> > >& inter_types)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_USE(tm1_edge_to_tm2_faces); CGAL_USE(tm1); CGAL_USE(tm2);
+    CGAL_USE(vpm1); CGAL_USE(vpm2); CGAL_USE(inter_types);
+#else
+    std::vector<typename Edge_to_faces::iterator> entries;
+    entries.reserve(tm1_edge_to_tm2_faces.size());
+    for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
+                                         it!=tm1_edge_to_tm2_faces.end();++it)
+      entries.push_back(it);
+
+    inter_types.resize(entries.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, entries.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+      {
+        halfedge_descriptor h_1=halfedge(entries[i]->first,tm1);
+        inter_types[i].reserve(entries[i]->second.size());
+        for(face_descriptor f_2 : entries[i]->second)
+          inter_types[i].emplace_back(f_2, intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2));
+      }
+    });
+#endif
+  }
+
   template <typename VPM1, typename VPM2>
   void compute_intersection_points(Edge_to_faces& tm1_edge_to_tm2_faces,
                                    const TriangleMesh& tm1,
@@ -950,20 +993,49 @@ class Intersection_of_triangle_meshes
   {
     typedef std::tuple<Intersection_type, halfedge_descriptor, bool,bool>  Inter_type;
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_same_v<ConcurrencyTag, Parallel_tag>,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    constexpr bool parallel_execution = std::is_same_v<ConcurrencyTag, Parallel_tag>;
+
+    // The intersection types are computed beforehand in parallel mode. Faces are only
+    // removed from the sets in the loop below, so all the pairs tested are available,
+    // and the nodes are created in the same order as in the sequential version.
+    std::vector<std::vector<std::pair<face_descriptor, Inter_type> > > inter_types;
+    if constexpr (parallel_execution)
+      compute_intersection_types(tm1_edge_to_tm2_faces, tm1, tm2, vpm1, vpm2, inter_types);
+
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    std::size_t entry_id=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++entry_id)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
 
       halfedge_descriptor h_1=halfedge(e_1,tm1);
       Face_set& fset=it->second;
+      std::size_t type_id=0;
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        Inter_type res;
+        if constexpr (parallel_execution)
+        {
+          // Erasing from an unordered set keeps the order of the other faces, so the faces
+          // are taken in the order in which their types were computed, and `type_id` only moves forward.
+          const std::vector<std::pair<face_descriptor, Inter_type> >& entry_types = inter_types[entry_id];
+          while(entry_types[type_id].first != f_2)
+          {
+            ++type_id;
+            CGAL_assertion(type_id < entry_types.size());
+          }
+          res=entry_types[type_id].second;
+        }
+        else
+          res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
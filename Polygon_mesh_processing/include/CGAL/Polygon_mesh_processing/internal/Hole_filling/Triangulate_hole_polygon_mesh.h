@@ -22,7 +22,12 @@
 #endif
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
+#include <mutex>
+#include <tuple>
+#include <unordered_set>
 #include <vector>
 
 namespace CGAL {
@@ -94,12 +99,14 @@ struct Tracer_polyhedron
   std::vector<halfedge_descriptor>& P;
 };
 
-// This function is used in test cases (since it returns not just OutputIterator but also Weight)
-template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
-std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
-triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+// Computes the triangulation of the hole and passes it to `tracer`, which is called at most once.
+// `P_edges` is filled with the border halfedges of the hole, the mesh is not modified by this function.
+template<class ConcurrencyTag, class PolygonMesh, class Tracer, class VertexPointMap, class Kernel, class Visitor>
+CGAL::internal::Weight_min_max_dihedral_and_area
+triangulate_hole_polygon_mesh_with_tracer(const PolygonMesh& pmesh,
             typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
-            OutputIterator out,
+            std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& P_edges,
+            Tracer& tracer,
             VertexPointMap vpmap,
             bool use_delaunay_triangulation,
             const Kernel& k,
@@ -115,7 +122,6 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 
   typedef Halfedge_around_face_circulator<PolygonMesh>   Hedge_around_face_circulator;
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
-  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
   typedef typename Kernel::Point_3 Point_3;
 
   typedef std::map<vertex_descriptor, int>    Vertex_map;
@@ -126,7 +132,6 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #endif
 
   std::vector<Point_3> P, Q;
-  std::vector<halfedge_descriptor> P_edges;
   Vertex_map vertex_map;
 
   int id = 0;
@@ -143,7 +148,7 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #else
       std::cerr << "W: Returning no output. Non-manifold vertex is found on boundary!\n";
 #endif
-      return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+      return CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID();
     }
   } while (++circ != done);
 
@@ -189,28 +194,175 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 
   CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
 
-  // fill hole using polyline function, with custom tracer for PolygonMesh
-  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
-
+  // fill hole using polyline function
 #ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   if(use_cdt && triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k, max_squared_distance))
-    return std::make_pair(tracer.out, CGAL::internal::Weight_min_max_dihedral_and_area(0,0));
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 #endif
   CGAL::internal::Weight_min_max_dihedral_and_area weight =
 #ifndef CGAL_USE_WEIGHT_INCOMPLETE
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
+  CGAL::internal::triangulate_hole_polyline<ConcurrencyTag>(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k);
 #else
   // get actual weight in Weight_incomplete
-  triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
+  CGAL::internal::triangulate_hole_polyline<ConcurrencyTag>(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
 #endif
 
 #ifdef CGAL_PMP_HOLE_FILLING_DEBUG
   std::cerr << "Hole filling: " << timer.time() << " sc." << std::endl; timer.reset();
 #endif
 
+  return weight;
+}
+
+// This function is used in test cases (since it returns not just OutputIterator but also Weight)
+template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor,
+         class ConcurrencyTag = Sequential_tag>
+std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
+triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const typename Kernel::FT max_squared_distance,
+            const ConcurrencyTag& = ConcurrencyTag())
+{
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+  // custom tracer for PolygonMesh
+  std::vector<halfedge_descriptor> P_edges;
+  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+
+  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+    triangulate_hole_polygon_mesh_with_tracer<ConcurrencyTag>(pmesh, border_halfedge, P_edges, tracer, vpmap,
+                                                              use_delaunay_triangulation, k, use_cdt,
+                                                              skip_cubic_algorithm, visitor, max_squared_distance);
+
   return std::make_pair(tracer.out, weight);
 }
 
+// Forwards the calls made while triangulating a hole to `visitor`, one at a time,
+// as the holes may be triangulated concurrently
+template <class Visitor>
+struct Serialized_visitor
+{
+  Serialized_visitor(Visitor& visitor, std::mutex& mutex) : m_visitor(visitor), m_mutex(mutex) { }
+
+  void start_planar_phase() const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.start_planar_phase(); }
+  void end_planar_phase(bool success) const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.end_planar_phase(success); }
+  void start_quadratic_phase(std::size_t n) const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.start_quadratic_phase(n); }
+  void quadratic_step() const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.quadratic_step(); }
+  void end_quadratic_phase(bool success) const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.end_quadratic_phase(success); }
+  void start_cubic_phase(int n) const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.start_cubic_phase(n); }
+  void cubic_step() const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.cubic_step(); }
+  void end_cubic_phase() const { std::lock_guard<std::mutex> lock(m_mutex); m_visitor.end_cubic_phase(); }
+
+private:
+  Visitor& m_visitor;
+  std::mutex& m_mutex;
+};
+
+// Triangulates several holes. The triangulations of the holes are first computed without modifying
+// the mesh (concurrently if `ConcurrencyTag` is `Parallel_tag`), and the patches are then added
+// to the mesh in the order of `border_halfedges`. A hole that shares a vertex with a previous hole
+// is triangulated once all the other holes are filled, as its triangulation might depend on the
+// previous holes. The calls to `visitor` are serialized.
+// `max_squared_distance(h)` is the parameter of the 2D constrained Delaunay triangulation for the hole of `h`.
+template<class ConcurrencyTag, class PolygonMesh, class HalfedgeRange, class OutputIterator,
+         class VertexPointMap, class Kernel, class Visitor, class MaxSquaredDistance>
+OutputIterator
+triangulate_holes_polygon_mesh(PolygonMesh& pmesh,
+            const HalfedgeRange& border_halfedges,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const MaxSquaredDistance& max_squared_distance)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+  typedef std::tuple<int, int, int> Triangle;
+  typedef CGAL::internal::Tracer_polyline_incomplete<Triangle,
+                                                     std::back_insert_iterator<std::vector<Triangle> >,
+                                                     Emptyset_iterator>         Recording_tracer;
+
+  // the triangulation of a hole, as computed by the polyline functions
+  struct Hole_triangulation
+  {
+    halfedge_descriptor border_halfedge;
+    std::vector<halfedge_descriptor> P_edges;
+    std::vector<Triangle> triangles;
+    bool is_valid = false;
+  };
+
+  std::vector<Hole_triangulation> independent_holes;
+  std::vector<halfedge_descriptor> dependent_holes;
+  std::unordered_set<vertex_descriptor> hole_vertices;
+  for(halfedge_descriptor h : border_halfedges)
+  {
+    CGAL_precondition(is_border(h, pmesh));
+    bool is_independent = true;
+    for(halfedge_descriptor hh : halfedges_around_face(h, pmesh))
+      if(!hole_vertices.insert(target(hh, pmesh)).second)
+        is_independent = false;
+
+    if(is_independent)
+    {
+      independent_holes.emplace_back();
+      independent_holes.back().border_halfedge = h;
+    }
+    else
+      dependent_holes.push_back(h);
+  }
+
+  const PolygonMesh& cpmesh = pmesh;
+  std::mutex visitor_mutex;
+  Serialized_visitor<Visitor> serialized_visitor(visitor, visitor_mutex);
+  CGAL::for_each<ConcurrencyTag>(independent_holes, [&](Hole_triangulation& ht)
+  {
+    Recording_tracer tracer(std::back_inserter(ht.triangles), Emptyset_iterator());
+    ht.is_valid = triangulate_hole_polygon_mesh_with_tracer<ConcurrencyTag>(
+                    cpmesh, ht.border_halfedge, ht.P_edges, tracer, vpmap, use_delaunay_triangulation, k,
+                    use_cdt, skip_cubic_algorithm, serialized_visitor, max_squared_distance(ht.border_halfedge))
+                  != CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID();
+    return true;
+  });
+
+  for(const Hole_triangulation& ht : independent_holes)
+  {
+    if(!ht.is_valid)
+      continue;
+
+    const int n = static_cast<int>(ht.P_edges.size());
+    CGAL::internal::Lookup_table_map<int> lambda(n, -1);
+    for(const Triangle& t : ht.triangles)
+      lambda.put(std::get<0>(t), std::get<2>(t), std::get<1>(t));
+
+    std::vector<halfedge_descriptor> P_edges = ht.P_edges;
+    Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+    tracer(lambda, 0, n-1);
+    out = tracer.out;
+  }
+
+  for(halfedge_descriptor h : dependent_holes)
+  {
+    // the hole might have been closed by the triangulation of another hole
+    if(!is_border(h, pmesh))
+      continue;
+    out = triangulate_hole_polygon_mesh(pmesh, h, out, vpmap, use_delaunay_triangulation, k, use_cdt,
+                                        skip_cubic_algorithm, visitor, max_squared_distance(h),
+                                        ConcurrencyTag()).first;
+  }
+
+  return out;
+}
+
 } // namespace internal
 } // namespace Polygon_mesh_processing
 } // namespace CGAL
@@ -38,6 +38,7 @@
 #include <CGAL/Polygon_2_algorithms.h>
 #endif
 
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 #include <CGAL/iterator.h>
 #include <CGAL/use.h>
@@ -51,6 +52,11 @@
 
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 namespace CGAL {
 namespace internal {
 
@@ -738,7 +744,8 @@ template<
   class Tracer,
   class WeightCalculator,
   class Visitor,
-  template <class> class LookupTable = Lookup_table
+  template <class> class LookupTable = Lookup_table,
+  class ConcurrencyTag = Sequential_tag
 >
 class Triangulate_hole_polyline;
 
@@ -1163,7 +1170,8 @@ template<
   class Tracer,
   class WeightCalculator,
   class Visitor,
-  template <class> class LookupTable
+  template <class> class LookupTable,
+  class ConcurrencyTag
 >
 class Triangulate_hole_polyline {
 public:
@@ -1216,35 +1224,69 @@ public:
 
     visitor.start_cubic_phase(N);
     for(int j = 2; j<= range.second; ++j) {              // determines range (2 - 3 - 4 )
+#ifdef CGAL_LINKED_WITH_TBB
+      // the ranges of length j only depend on shorter ranges, they can be processed concurrently
+      if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+      {
+        const int nb_steps = (range.second - j - range.first + 1) * (j - 1);
+        if(nb_steps >= parallel_threshold)
+        {
+          tbb::parallel_for(tbb::blocked_range<int>(range.first, range.second-j+1),
+                            [&](const tbb::blocked_range<int>& r)
+                            {
+                              for(int i=r.begin(); i!=r.end(); ++i)
+                                triangulate_range(P, Q, WC, [](){}, i, i+j, W, lambda);
+                            });
+          for(int step=0; step<nb_steps; ++step)
+            visitor.cubic_step();
+          continue;
+        }
+      }
+#endif
       for(int i=range.first; i<= range.second-j; ++i) {  // iterates over ranges and find min triangulation in those ranges
         int k = i+j;                                     // like [0-2, 1-3, 2-4, ...], [0-3, 1-4, 2-5, ...]
+        triangulate_range(P, Q, WC, [&visitor](){ visitor.cubic_step(); }, i, k, W, lambda);
+      }
+    }
+    visitor.end_cubic_phase();
+  }
 
-        int m_min = -1;
-        Weight w_min = Weight::NOT_VALID();
-        // i is the range start (e.g. 1) k is the range end (e.g. 5) -> [1-5]. Now subdivide the region [1-5] with m -> 2,3,4
-        for(int m = i+1; m<k; ++m) {
-          visitor.cubic_step();
-          // now the regions i-m and m-k might be valid(constructed) patches,
-          if( W.get(i,m) == Weight::NOT_VALID() || W.get(m,k) == Weight::NOT_VALID() )
-          { continue; }
-
-          const Weight& w_imk = WC(P,Q,i,m,k, lambda);
-          if(w_imk == Weight::NOT_VALID())
-          { continue; }
-
-          const Weight& w = W.get(i,m) + W.get(m,k) + w_imk;
-          if(m_min == -1 || w < w_min) {
-            w_min = w;
-            m_min = m;
-          }
-        }
+private:
+  // minimum number of weight evaluations for a length of range to be processed in parallel
+  static constexpr int parallel_threshold = 1000;
+
+  template <class CubicStep>
+  void triangulate_range(const Polyline_3& P,
+                         const Polyline_3& Q,
+                         const WeightCalculator& WC,
+                         const CubicStep& cubic_step,
+                         int i, int k,
+                         LookupTable<Weight>& W,
+                         LookupTable<int>& lambda) const
+  {
+    int m_min = -1;
+    Weight w_min = Weight::NOT_VALID();
+    // i is the range start (e.g. 1) k is the range end (e.g. 5) -> [1-5]. Now subdivide the region [1-5] with m -> 2,3,4
+    for(int m = i+1; m<k; ++m) {
+      cubic_step();
+      // now the regions i-m and m-k might be valid(constructed) patches,
+      if( W.get(i,m) == Weight::NOT_VALID() || W.get(m,k) == Weight::NOT_VALID() )
+      { continue; }
 
-        // can be m_min = -1 and w_min = NOT_VALID which means no possible triangulation between i-k
-        W.put(i,k,w_min);
-        lambda.put(i,k, m_min);
+      const Weight& w_imk = WC(P,Q,i,m,k, lambda);
+      if(w_imk == Weight::NOT_VALID())
+      { continue; }
+
+      const Weight& w = W.get(i,m) + W.get(m,k) + w_imk;
+      if(m_min == -1 || w < w_min) {
+        w_min = w;
+        m_min = m;
       }
     }
-    visitor.end_cubic_phase();
+
+    // can be m_min = -1 and w_min = NOT_VALID which means no possible triangulation between i-k
+    W.put(i,k,w_min);
+    lambda.put(i,k, m_min);
   }
 };
 
@@ -1525,6 +1567,7 @@ triangulate_hole_polyline_with_cdt(const PointRange& points,
  * Internal entry point for both polyline and Polyhedron_3 triangulation functions
  ***********************************************************************************/
 template <
+  typename ConcurrencyTag = Sequential_tag,
   typename PointRange1,
   typename PointRange2,
   typename Tracer,
@@ -1553,7 +1596,8 @@ triangulate_hole_polyline(const PointRange1& points,
 #else
   CGAL_USE(use_delaunay_triangulation);
 #endif
-  typedef CGAL::internal::Triangulate_hole_polyline<K, Tracer, WeightCalculator, Visitor>    Fill;
+  typedef CGAL::internal::Triangulate_hole_polyline<K, Tracer, WeightCalculator, Visitor,
+                                                    Lookup_table, ConcurrencyTag>            Fill;
 
   std::vector<Point_3> P(std::begin(points), std::end(points));
   std::vector<Point_3> Q(std::begin(third_points), std::end(third_points));
@@ -54,6 +54,13 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <atomic>
+#include <cmath>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
 
 #ifdef CGAL_PMP_REMESHING_DEBUG
 #include <CGAL/Polygon_mesh_processing/self_intersections.h>
@@ -842,6 +849,7 @@ namespace internal {
     // The target valence is 6 and 4 for interior and boundary vertices, resp.
     // The algo. tentatively flips each edge `e` and checks whether the deviation
     // to the target valences decreases. If not, the edge is flipped back"
+    template <typename ConcurrencyTag = Sequential_tag>
     void flip_edges_for_valence_and_shape()
     {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -865,69 +873,10 @@ namespace internal {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       unsigned int nb_flips = 0;
 #endif
-      for(edge_descriptor e : edges(mesh_))
+      auto flip = [&](const edge_descriptor e)
       {
-        //only the patch edges are allowed to be flipped
-        if (!is_flip_allowed(e))
-          continue;
-        //add geometric test to avoid axe cuts
-        if (!internal::should_flip(e, mesh_, vpmap_, gt_))
-          continue;
-
-        halfedge_descriptor he = halfedge(e, mesh_);
-
-        std::array<halfedge_descriptor, 2> r1 = internal::is_badly_shaped(
-            face(he, mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_,
-            4, // bound on shortest/longest edge above 4 => needle
-            cap_threshold, // bound on the angle: above 160 deg => cap
-            0,// collapse length threshold : not needed here
-            0); // flip triangle height threshold
-
-        std::array<halfedge_descriptor, 2> r2 = internal::is_badly_shaped(
-            face(opposite(he, mesh_), mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_, 4, cap_threshold, 0, 0);
-
-        const bool badly_shaped = (r1[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r1[1] != boost::graph_traits<PolygonMesh>::null_halfedge()//cap
-                                || r2[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r2[1] != boost::graph_traits<PolygonMesh>::null_halfedge());//cap
-
-        vertex_descriptor va = source(he, mesh_);
-        vertex_descriptor vb = target(he, mesh_);
-        vertex_descriptor vc = target(next(he, mesh_), mesh_);
-        vertex_descriptor vd = target(next(opposite(he, mesh_), mesh_), mesh_);
-
-        int vva = get(degree,va), tvva = target_valence(va);
-        int vvb = get(degree, vb), tvvb = target_valence(vb);
-        int vvc = get(degree,vc), tvvc = target_valence(vc);
-        int vvd = get(degree,vd), tvvd = target_valence(vd);
-
-        int deviation_pre = CGAL::abs(vva - tvva)
-                          + CGAL::abs(vvb - tvvb)
-                          + CGAL::abs(vvc - tvvc)
-                          + CGAL::abs(vvd - tvvd);
-
-        CGAL_assertion_code(Halfedge_status s1 = status(he));
-        CGAL_assertion_code(Halfedge_status s1o = status(opposite(he, mesh_)));
-
-        CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
-        CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
-        CGAL::Euler::flip_edge(he, mesh_);
-
-        if (!badly_shaped)
-        {
-          vva -= 1;
-          vvb -= 1;
-          vvc += 1;
-          vvd += 1;
-        }
-
-        put(degree, va, vva);
-        put(degree, vb, vvb);
-        put(degree, vc, vvc);
-        put(degree, vd, vvd);
-
+        if(!flip_for_valence_and_shape(e, degree, cap_threshold))
+          return;
 #ifdef CGAL_PMP_REMESHING_VERBOSE
         ++nb_flips;
 #endif
@@ -935,64 +884,94 @@ namespace internal {
         std::cout << "\r\t(" << nb_flips << " flips)";
         std::cout.flush();
 #endif
-        CGAL_assertion_code(Halfedge_status s2 = status(he));
-        CGAL_assertion_code(Halfedge_status s2o = status(opposite(he, mesh_)));
-        CGAL_assertion(s1 == s2   && s1 == PATCH);
-        CGAL_assertion(s1o == s2o && s1o == PATCH);
-        CGAL_assertion(!is_border(he, mesh_));
-
-        CGAL_assertion(
-             (vc == target(he, mesh_) && vd == source(he, mesh_))
-          || (vd == target(he, mesh_) && vc == source(he, mesh_)));
+      };
 
-        int deviation_post;
-        if(!badly_shaped)
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_same_v<ConcurrencyTag, Parallel_tag>,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#else
+      if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+      {
+        // The faces are partitioned into the cells of a regular grid. The edges whose flip
+        // only involves the faces of one cell are flipped concurrently, one task per cell,
+        // and the other edges are then flipped sequentially.
+        typedef typename boost::property_map<PM, CGAL::dynamic_face_property_t<std::size_t> >::type Face_cell_map;
+        Face_cell_map face_cell = get(CGAL::dynamic_face_property_t<std::size_t>(), mesh_);
+
+        Bbox_3 bbox;
+        for(vertex_descriptor v : vertices(mesh_))
+          bbox += get(vpmap_, v).bbox();
+
+        // a surface meets about n^2 of the n^3 cells, hence about 4096 faces per non-empty cell
+        const std::size_t n = (std::max)(std::size_t(1),
+          static_cast<std::size_t>(std::sqrt(static_cast<double>(faces(mesh_).size()) / 4096.)));
+        auto cell_coordinate = [n](const double x, const double xmin, const double xmax)
         {
-          deviation_post = CGAL::abs(vva - tvva)
-                           + CGAL::abs(vvb - tvvb)
-                           + CGAL::abs(vvc - tvvc)
-                           + CGAL::abs(vvd - tvvd);
+          if(!(xmax > xmin))
+            return std::size_t(0);
+          return (std::min)(n - 1, static_cast<std::size_t>(n * (x - xmin) / (xmax - xmin)));
+        };
+        // the non-empty cells are numbered in the order of the faces
+        std::unordered_map<std::size_t, std::size_t> cell_indices;
+        for(face_descriptor f : faces(mesh_))
+        {
+          const Bbox_3 b = get(vpmap_, target(halfedge(f, mesh_), mesh_)).bbox();
+          const std::size_t cell = (cell_coordinate(b.xmin(), bbox.xmin(), bbox.xmax()) * n
+                                    + cell_coordinate(b.ymin(), bbox.ymin(), bbox.ymax())) * n
+                                    + cell_coordinate(b.zmin(), bbox.zmin(), bbox.zmax());
+          put(face_cell, f, cell_indices.emplace(cell, cell_indices.size()).first->second);
         }
 
-        //check that mesh does not become non-triangle,
-        //nor has inverted faces
-        if ((!badly_shaped && deviation_pre <= deviation_post)
-          || !check_normals(he)
-          || incident_to_degenerate(he)
-          || incident_to_degenerate(opposite(he, mesh_))
-          || !is_on_triangle(he)
-          || !is_on_triangle(opposite(he, mesh_))
-          || !check_normals(target(he, mesh_))
-          || !check_normals(source(he, mesh_)))
+        std::vector<std::vector<edge_descriptor> > edges_per_cell(cell_indices.size());
+        std::vector<edge_descriptor> sequential_edges;
+        for(edge_descriptor e : edges(mesh_))
         {
-          CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
-          CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
-          CGAL::Euler::flip_edge(he, mesh_);
-
-          vva += 1;
-          vvb += 1;
-          vvc -= 1;
-          vvd -= 1;
-
-          put(degree, va, vva);
-          put(degree, vb, vvb);
-          put(degree, vc, vvc);
-          put(degree, vd, vvd);
+          const halfedge_descriptor h = halfedge(e, mesh_);
+          if(is_border_edge(h, mesh_))
+            sequential_edges.push_back(e);
+          else if(get(face_cell, face(h, mesh_)) == get(face_cell, face(opposite(h, mesh_), mesh_)))
+            edges_per_cell[get(face_cell, face(h, mesh_))].push_back(e);
+          else
+            sequential_edges.push_back(e);
+        }
 
+        // a flip keeps the two faces of the edge, so the edges of a cell remain in the cell
+        std::vector<std::vector<edge_descriptor> > deferred_edges(edges_per_cell.size());
 #ifdef CGAL_PMP_REMESHING_VERBOSE
-          --nb_flips;
+        std::atomic<unsigned int> nb_concurrent_flips(0);
+#endif
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, edges_per_cell.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          for(std::size_t c = r.begin(); c != r.end(); ++c)
+            for(edge_descriptor e : edges_per_cell[c])
+            {
+              if(!is_interior_to_cell(e, c, face_cell))
+                deferred_edges[c].push_back(e);
+#ifdef CGAL_PMP_REMESHING_VERBOSE
+              else if(flip_for_valence_and_shape(e, degree, cap_threshold))
+                ++nb_concurrent_flips;
+#else
+              else
+                flip_for_valence_and_shape(e, degree, cap_threshold);
+#endif
+            }
+        });
+#ifdef CGAL_PMP_REMESHING_VERBOSE
+        nb_flips += nb_concurrent_flips;
 #endif
-          CGAL_assertion_code(Halfedge_status s3 = status(he));
-          CGAL_assertion(s1 == s3);
-          CGAL_assertion(!is_border(he, mesh_));
-          CGAL_assertion(
-               (va == source(he, mesh_) && vb == target(he, mesh_))
-            || (vb == source(he, mesh_) && va == target(he, mesh_)));
-        }
 
-        Patch_id pid = get_patch_id(face(he, mesh_));
-        set_patch_id(face(he, mesh_), pid);
-        set_patch_id(face(opposite(he, mesh_), mesh_), pid);
+        for(const std::vector<edge_descriptor>& cell_edges : deferred_edges)
+          for(edge_descriptor e : cell_edges)
+            flip(e);
+        for(edge_descriptor e : sequential_edges)
+          flip(e);
+      }
+      else
+#endif
+      {
+        for(edge_descriptor e : edges(mesh_))
+          flip(e);
       }
 
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -1010,11 +989,159 @@ namespace internal {
 #endif
     }
 
+    // tentatively flips `e` (see `flip_edges_for_valence_and_shape()`),
+    // and returns `true` if the flip is kept
+    template <typename VertexDegreeMap>
+    bool flip_for_valence_and_shape(const edge_descriptor e,
+                                    const VertexDegreeMap& degree,
+                                    const double cap_threshold)
+    {
+      //only the patch edges are allowed to be flipped
+      if (!is_flip_allowed(e))
+        return false;
+      //add geometric test to avoid axe cuts
+      if (!internal::should_flip(e, mesh_, vpmap_, gt_))
+        return false;
+
+      halfedge_descriptor he = halfedge(e, mesh_);
+
+      std::array<halfedge_descriptor, 2> r1 = internal::is_badly_shaped(
+          face(he, mesh_),
+          mesh_, vpmap_, vcmap_, ecmap_, gt_,
+          4, // bound on shortest/longest edge above 4 => needle
+          cap_threshold, // bound on the angle: above 160 deg => cap
+          0,// collapse length threshold : not needed here
+          0); // flip triangle height threshold
+
+      std::array<halfedge_descriptor, 2> r2 = internal::is_badly_shaped(
+          face(opposite(he, mesh_), mesh_),
+          mesh_, vpmap_, vcmap_, ecmap_, gt_, 4, cap_threshold, 0, 0);
+
+      const bool badly_shaped = (r1[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
+                              || r1[1] != boost::graph_traits<PolygonMesh>::null_halfedge()//cap
+                              || r2[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
+                              || r2[1] != boost::graph_traits<PolygonMesh>::null_halfedge());//cap
+
+      vertex_descriptor va = source(he, mesh_);
+      vertex_descriptor vb = target(he, mesh_);
+      vertex_descriptor vc = target(next(he, mesh_), mesh_);
+      vertex_descriptor vd = target(next(opposite(he, mesh_), mesh_), mesh_);
+
+      int vva = get(degree,va), tvva = target_valence(va);
+      int vvb = get(degree, vb), tvvb = target_valence(vb);
+      int vvc = get(degree,vc), tvvc = target_valence(vc);
+      int vvd = get(degree,vd), tvvd = target_valence(vd);
+
+      int deviation_pre = CGAL::abs(vva - tvva)
+                        + CGAL::abs(vvb - tvvb)
+                        + CGAL::abs(vvc - tvvc)
+                        + CGAL::abs(vvd - tvvd);
+
+      CGAL_assertion_code(Halfedge_status s1 = status(he));
+      CGAL_assertion_code(Halfedge_status s1o = status(opposite(he, mesh_)));
+
+      CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
+      CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
+      CGAL::Euler::flip_edge(he, mesh_);
+
+      if (!badly_shaped)
+      {
+        vva -= 1;
+        vvb -= 1;
+        vvc += 1;
+        vvd += 1;
+      }
+
+      put(degree, va, vva);
+      put(degree, vb, vvb);
+      put(degree, vc, vvc);
+      put(degree, vd, vvd);
+
+      CGAL_assertion_code(Halfedge_status s2 = status(he));
+      CGAL_assertion_code(Halfedge_status s2o = status(opposite(he, mesh_)));
+      CGAL_assertion(s1 == s2   && s1 == PATCH);
+      CGAL_assertion(s1o == s2o && s1o == PATCH);
+      CGAL_assertion(!is_border(he, mesh_));
+
+      CGAL_assertion(
+           (vc == target(he, mesh_) && vd == source(he, mesh_))
+        || (vd == target(he, mesh_) && vc == source(he, mesh_)));
+
+      int deviation_post;
+      if(!badly_shaped)
+      {
+        deviation_post = CGAL::abs(vva - tvva)
+                         + CGAL::abs(vvb - tvvb)
+                         + CGAL::abs(vvc - tvvc)
+                         + CGAL::abs(vvd - tvvd);
+      }
+
+      bool kept = true;
+      //check that mesh does not become non-triangle,
+      //nor has inverted faces
+      if ((!badly_shaped && deviation_pre <= deviation_post)
+        || !check_normals(he)
+        || incident_to_degenerate(he)
+        || incident_to_degenerate(opposite(he, mesh_))
+        || !is_on_triangle(he)
+        || !is_on_triangle(opposite(he, mesh_))
+        || !check_normals(target(he, mesh_))
+        || !check_normals(source(he, mesh_)))
+      {
+        CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
+        CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
+        CGAL::Euler::flip_edge(he, mesh_);
+
+        vva += 1;
+        vvb += 1;
+        vvc -= 1;
+        vvd -= 1;
+
+        put(degree, va, vva);
+        put(degree, vb, vvb);
+        put(degree, vc, vvc);
+        put(degree, vd, vvd);
+
+        kept = false;
+        CGAL_assertion_code(Halfedge_status s3 = status(he));
+        CGAL_assertion(s1 == s3);
+        CGAL_assertion(!is_border(he, mesh_));
+        CGAL_assertion(
+             (va == source(he, mesh_) && vb == target(he, mesh_))
+          || (vb == source(he, mesh_) && va == target(he, mesh_)));
+      }
+
+      Patch_id pid = get_patch_id(face(he, mesh_));
+      set_patch_id(face(he, mesh_), pid);
+      set_patch_id(face(opposite(he, mesh_), mesh_), pid);
+
+      return kept;
+    }
+
+    // returns `true` if all the faces incident to the vertices of the two faces of `e`
+    // are in the cell `c` of `face_cell`. Tentatively flipping `e` then only reads and writes
+    // mesh elements that the flips of the edges of the other cells do not touch.
+    template <typename FaceCellMap>
+    bool is_interior_to_cell(const edge_descriptor e,
+                             const std::size_t c,
+                             const FaceCellMap& face_cell) const
+    {
+      const halfedge_descriptor h = halfedge(e, mesh_);
+      const std::array<vertex_descriptor, 4> vs = { source(h, mesh_), target(h, mesh_),
+                                                    target(next(h, mesh_), mesh_),
+                                                    target(next(opposite(h, mesh_), mesh_), mesh_) };
+      for(vertex_descriptor v : vs)
+        for(halfedge_descriptor hv : halfedges_around_target(v, mesh_))
+          if(is_border(hv, mesh_) || get(face_cell, face(hv, mesh_)) != c)
+            return false;
+      return true;
+    }
+
     // PMP book :
     // "applies an iterative smoothing filter to the mesh.
     // The vertex movement has to be constrained to the vertex tangent plane [...]
     // smoothing algorithm with uniform Laplacian weights"
-    template <class SizingFunction, typename AllowMoveFunctor>
+    template <typename ConcurrencyTag = Sequential_tag, class SizingFunction, typename AllowMoveFunctor>
     void tangential_relaxation_impl(const bool relax_constraints/*1d smoothing*/
                                   , const unsigned int nb_iterations
                                   , const SizingFunction& sizing
@@ -1057,6 +1184,7 @@ namespace internal {
             .vertex_is_constrained_map(constrained_vertices_pmap)
             .relax_constraints(relax_constraints)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
       else
@@ -1076,6 +1204,7 @@ namespace internal {
             .relax_constraints(relax_constraints)
             .sizing_function(sizing)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
 
@@ -1094,6 +1223,7 @@ namespace internal {
 
     // PMP book :
     // "maps the vertices back to the surface"
+    template <typename ConcurrencyTag = Sequential_tag>
     void project_to_surface(internal_np::Param_not_found)
     {
       //todo : handle the case of boundary vertices
@@ -1102,15 +1232,14 @@ namespace internal {
       std::cout.flush();
 #endif
 
-      for(vertex_descriptor v : vertices(mesh_))
+      project_vertices<ConcurrencyTag>([&](const vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
-        //note if v is constrained, it has not moved
-
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
-        put(vpmap_, v, proj);
-      }
+        // the map is not modified as it may be read concurrently
+        typename Patch_id_to_index_map::const_iterator it
+          = patch_id_to_index_map.find(get_patch_id(face(halfedge(v, mesh_), mesh_)));
+        const std::size_t tree_id = (it == patch_id_to_index_map.end()) ? 0 : it->second;
+        return trees[tree_id]->closest_point(get(vpmap_, v));
+      });
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1124,7 +1253,7 @@ namespace internal {
 #endif
     }
 
-    template <class ProjectionFunctor>
+    template <typename ConcurrencyTag = Sequential_tag, class ProjectionFunctor>
     void project_to_surface(const ProjectionFunctor& proj)
     {
       //todo : handle the case of boundary vertices
@@ -1132,13 +1261,7 @@ namespace internal {
       std::cout << "Project to surface...";
       std::cout.flush();
 #endif
-      for(vertex_descriptor v : vertices(mesh_))
-      {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
-        //note if v is constrained, it has not moved
-        put(vpmap_, v,  proj(v));
-      }
+      project_vertices<ConcurrencyTag>(proj);
       CGAL_assertion(is_valid(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1153,6 +1276,40 @@ namespace internal {
     }
 
 private:
+  // moves the vertices which are not constrained, isolated or out of the patches to `projection(v)`
+  template <typename ConcurrencyTag, typename Projection>
+  void project_vertices(const Projection& projection)
+  {
+    auto shall_project = [&](const vertex_descriptor v)
+    {
+      //note if v is constrained, it has not moved
+      return !is_constrained(v) && !is_isolated(v) && is_on_patch(v);
+    };
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_same_v<ConcurrencyTag, Parallel_tag>,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+    {
+      const auto vertex_range = vertices(mesh_);
+      const std::vector<vertex_descriptor> vertex_vector(vertex_range.begin(), vertex_range.end());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+          if (shall_project(vertex_vector[i]))
+            put(vpmap_, vertex_vector[i], projection(vertex_vector[i]));
+      });
+      return;
+    }
+#endif
+
+    for(vertex_descriptor v : vertices(mesh_))
+      if (shall_project(v))
+        put(vpmap_, v, projection(v));
+  }
+
   Patch_id get_patch_id(const face_descriptor& f) const
   {
     if (f == boost::graph_traits<PM>::null_face())
@@ -77,8 +77,12 @@ public:
 
   void intersection(const typename Traits::Plane_3& plane, const typename AABBTraits::Primitive& primitive)
   {
-    typename boost::graph_traits<TriangleMesh>::edge_descriptor ed = primitive.id();
+    intersection(plane, primitive.id());
+  }
 
+  // classifies the edge `ed` with respect to `plane`
+  void intersection(const typename Traits::Plane_3& plane, edge_descriptor ed)
+  {
     Oriented_side src = oriented_side_3(plane, get(m_vpmap, source(ed,m_tmesh)) );
     Oriented_side tgt = oriented_side_3(plane, get(m_vpmap, target(ed,m_tmesh)) );
 
@@ -22,11 +22,21 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/property_map.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #include <Eigen/Eigenvalues>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL {
 
@@ -742,6 +752,22 @@ class Interpolated_corrected_curvatures_computer
   typedef typename boost::property_map<PolygonMesh,
     CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>>::const_type Face_anisotropic_measure_map;
 
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag>::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_same_v<Concurrency_tag, Parallel_tag>,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  // the selected curvatures at a vertex
+  struct Vertex_curvatures {
+    FT mean_curvature = 0;
+    FT gaussian_curvature = 0;
+    Principal_curvatures_and_directions<GT> principal_curvatures_and_directions;
+  };
+
 private:
   const PolygonMesh& pmesh;
   Vertex_position_map vpm;
@@ -760,6 +786,8 @@ private:
   Face_scalar_measure_map mu0_map, mu1_map, mu2_map;
   Face_anisotropic_measure_map muXY_map;
 
+  std::vector<vertex_descriptor> updated;
+
   void set_property_maps() {
     mu0_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
     mu1_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
@@ -779,13 +807,12 @@ private:
     vnm = choose_parameter(get_parameter(np, internal_np::vertex_normal_map),
       get(Vector_map_tag(), pmesh));
 
-    // if no normal map is given, compute normals
-    if (is_default_parameter<NamedParameters, internal_np::vertex_normal_map_t>::value)
-      compute_vertex_normals(pmesh, vnm, np);
-
     // if no radius is given, we pass -1 which will make the expansion be only on the incident faces instead of a ball
     const FT radius = choose_parameter(get_parameter(np, internal_np::ball_radius), -1);
-    avg_edge_length = average_edge_length<PolygonMesh>(pmesh);
+    // the average edge length of the whole mesh, unless the one of a previous computation is given
+    avg_edge_length = is_default_parameter<NamedParameters, internal_np::average_edge_length_t>::value
+                      ? average_edge_length<PolygonMesh>(pmesh)
+                      : FT(choose_parameter(get_parameter(np, internal_np::average_edge_length), 0));
     set_ball_radius(radius);
 
     // check which curvature maps are provided by the user (determines which curvatures are computed)
@@ -806,59 +833,160 @@ private:
       ball_radius = radius;
   }
 
+  bool is_any_curvature_selected() const
+  {
+    return is_mean_curvature_selected || is_Gaussian_curvature_selected || is_principal_curvatures_and_directions_selected;
+  }
+
 public:
 
-  Interpolated_corrected_curvatures_computer(const PolygonMesh& pmesh,const NamedParameters& np)
+  // computes the selected curvatures at all the vertices of `pmesh`
+  Interpolated_corrected_curvatures_computer(const PolygonMesh& pmesh, const NamedParameters& np)
     : pmesh(pmesh)
   {
     set_named_params(np);
 
-    if (is_mean_curvature_selected || is_Gaussian_curvature_selected || is_principal_curvatures_and_directions_selected)
+    if (is_any_curvature_selected())
     {
+      // if no normal map is given, compute normals
+      if (parameters::is_default_parameter<NamedParameters, internal_np::vertex_normal_map_t>::value)
+        compute_vertex_normals(pmesh, vnm, np);
+
       set_property_maps();
 
-      compute_selected_curvatures();
+      interpolated_corrected_selected_measures_faces(faces(pmesh));
+      compute_selected_curvatures(vertices(pmesh));
     }
   }
 
-private:
-
-  // Computes the (selected) interpolated corrected measures for all faces
-  // and stores them in the property maps
-  void interpolated_corrected_selected_measures_all_faces()
+  // computes the selected curvatures at the vertices of `pmesh` whose expanded measures
+  // use a face whose measures are modified by a change of the faces of `changed_faces`
+  template <class FaceRange>
+  Interpolated_corrected_curvatures_computer(const PolygonMesh& pmesh,
+                                             const FaceRange& changed_faces,
+                                             const NamedParameters& np)
+    : pmesh(pmesh)
   {
-    std::vector<Vector_3> x;
-    std::vector<Vector_3> u;
-    // minimal number of vertices per face is 3
-    x.reserve(3);
-    u.reserve(3);
+    set_named_params(np);
 
-    for (face_descriptor f : faces(pmesh))
+    if (is_any_curvature_selected())
     {
-      for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+      std::vector<face_descriptor> region;
+      collect_updated_region(changed_faces, region, updated);
+
+      // if no normal map is given, compute the normals of the vertices of the faces used only
+      if (parameters::is_default_parameter<NamedParameters, internal_np::vertex_normal_map_t>::value)
       {
-        const Point_3& p = get(vpm, v);
-        x.push_back(Vector_3(p.x(), p.y(), p.z()));
-        u.push_back(get(vnm, v));
+        std::unordered_set<vertex_descriptor> region_vertices;
+        for (face_descriptor f : region)
+          for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+            if (region_vertices.insert(v).second)
+              put(vnm, v, compute_vertex_normal(v, pmesh, np));
       }
-      put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
 
-      if (is_mean_curvature_selected)
-        put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
+      set_property_maps();
 
-      if (is_Gaussian_curvature_selected)
-        put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
+      interpolated_corrected_selected_measures_faces(region);
+      compute_selected_curvatures(updated);
+    }
+  }
 
-      if (is_principal_curvatures_and_directions_selected)
-        put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+  // the vertices whose curvatures have been computed by the incremental constructor
+  const std::vector<vertex_descriptor>& updated_vertices() const
+  {
+    return updated;
+  }
 
-      x.clear();
-      u.clear();
+private:
+
+  // gets the vertices of `f` and their normal vectors
+  void face_points_and_normals(face_descriptor f, std::vector<Vector_3>& x, std::vector<Vector_3>& u) const
+  {
+    x.clear();
+    u.clear();
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+    {
+      const Point_3& p = get(vpm, v);
+      x.push_back(Vector_3(p.x(), p.y(), p.z()));
+      u.push_back(get(vnm, v));
     }
   }
 
+  // computes the (selected) interpolated corrected measures of the face `f`
+  Vertex_measures<GT> interpolated_corrected_selected_measures_face(face_descriptor f,
+                                                                    std::vector<Vector_3>& x,
+                                                                    std::vector<Vector_3>& u) const
+  {
+    face_points_and_normals(f, x, u);
+
+    Vertex_measures<GT> face_measures;
+    face_measures.area_measure = interpolated_corrected_area_measure_face<GT>(u, x);
+
+    if (is_mean_curvature_selected)
+      face_measures.mean_curvature_measure = interpolated_corrected_mean_curvature_measure_face<GT>(u, x);
+
+    if (is_Gaussian_curvature_selected)
+      face_measures.gaussian_curvature_measure = interpolated_corrected_Gaussian_curvature_measure_face<GT>(u);
+
+    if (is_principal_curvatures_and_directions_selected)
+      face_measures.anisotropic_measure = interpolated_corrected_anisotropic_measure_face<GT>(u, x);
+
+    return face_measures;
+  }
+
+  void put_face_measures(face_descriptor f, const Vertex_measures<GT>& face_measures)
+  {
+    put(mu0_map, f, face_measures.area_measure);
+
+    if (is_mean_curvature_selected)
+      put(mu1_map, f, face_measures.mean_curvature_measure);
+
+    if (is_Gaussian_curvature_selected)
+      put(mu2_map, f, face_measures.gaussian_curvature_measure);
+
+    if (is_principal_curvatures_and_directions_selected)
+      put(muXY_map, f, face_measures.anisotropic_measure);
+  }
+
+  // Computes the (selected) interpolated corrected measures for the faces of `face_range`
+  // and stores them in the property maps
+  template <class FaceRange>
+  void interpolated_corrected_selected_measures_faces(const FaceRange& face_range)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_same_v<Concurrency_tag, Parallel_tag>)
+    {
+      // the measures are computed in parallel but written sequentially,
+      // as concurrent writes are not safe with all property maps
+      const std::vector<face_descriptor> face_vector(std::begin(face_range), std::end(face_range));
+      std::vector<Vertex_measures<GT>> face_measures(face_vector.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, face_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          std::vector<Vector_3> x;
+                          std::vector<Vector_3> u;
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            face_measures[i] = interpolated_corrected_selected_measures_face(face_vector[i], x, u);
+                        });
+
+      for (std::size_t i = 0; i < face_vector.size(); ++i)
+        put_face_measures(face_vector[i], face_measures[i]);
+      return;
+    }
+#endif
+
+    std::vector<Vector_3> x;
+    std::vector<Vector_3> u;
+    // minimal number of vertices per face is 3
+    x.reserve(3);
+    u.reserve(3);
+
+    for (face_descriptor f : face_range)
+      put_face_measures(f, interpolated_corrected_selected_measures_face(f, x, u));
+  }
+
   // expand the measures of the faces incident to v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v) const
   {
     Vertex_measures<GT> vertex_measures;
 
@@ -888,7 +1016,7 @@ private:
   }
 
   // expand the measures of the faces inside the ball of radius r around v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v) const
   {
     // the ball expansion is done using a BFS traversal from the vertex
     std::queue<face_descriptor> bfs_queue;
@@ -954,40 +1082,190 @@ private:
     return vertex_measures;
   }
 
-  void compute_selected_curvatures() {
-    interpolated_corrected_selected_measures_all_faces();
+  // computes the selected curvatures at `v` from the expanded measures
+  // if the area measure is zero, the curvature is set to zero
+  Vertex_curvatures selected_curvatures_vertex(vertex_descriptor v) const
+  {
+    // expand the computed measures (on faces) to the vertices
+    const Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
+      expand_interpolated_corrected_measure_vertex_no_radius(v) :
+      expand_interpolated_corrected_measure_vertex(v);
+
+    Vertex_curvatures curvatures;
+
+    if (is_mean_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.mean_curvature = 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure;
+
+    if (is_Gaussian_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.gaussian_curvature = vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure;
+
+    if (is_principal_curvatures_and_directions_selected) {
+      // compute the principal curvatures and directions from the anisotropic measure
+      const Vector_3& v_normal = get(vnm, v);
+      curvatures.principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
+        vertex_measures.anisotropic_measure,
+        vertex_measures.area_measure,
+        v_normal,
+        avg_edge_length
+        );
+    }
+
+    return curvatures;
+  }
 
-    for (vertex_descriptor v : vertices(pmesh))
+  void put_vertex_curvatures(vertex_descriptor v, const Vertex_curvatures& curvatures)
+  {
+    if (is_mean_curvature_selected)
+      put(mean_curvature_map, v, curvatures.mean_curvature);
+
+    if (is_Gaussian_curvature_selected)
+      put(gaussian_curvature_map, v, curvatures.gaussian_curvature);
+
+    if (is_principal_curvatures_and_directions_selected)
+      put(principal_curvatures_and_directions_map, v, curvatures.principal_curvatures_and_directions);
+  }
+
+  // computes the selected curvatures at the vertices of `vertex_range`
+  // and stores them in the property maps
+  template <class VertexRange>
+  void compute_selected_curvatures(const VertexRange& vertex_range)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_same_v<Concurrency_tag, Parallel_tag>)
     {
-      // expand the computed measures (on faces) to the vertices
-      Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
-        expand_interpolated_corrected_measure_vertex_no_radius(v) :
-        expand_interpolated_corrected_measure_vertex(v);
-
-      // compute the selected curvatures from the expanded measures and store them in the property maps
-      // if the area measure is zero, the curvature is set to zero
-      if (is_mean_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(mean_curvature_map, v, 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure) :
-          put(mean_curvature_map, v, 0);
-      }
+      // the curvatures are computed in parallel but written sequentially,
+      // as concurrent writes are not safe with all property maps
+      const std::vector<vertex_descriptor> vertex_vector(std::begin(vertex_range), std::end(vertex_range));
+      std::vector<Vertex_curvatures> curvatures(vertex_vector.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            curvatures[i] = selected_curvatures_vertex(vertex_vector[i]);
+                        });
+
+      for (std::size_t i = 0; i < vertex_vector.size(); ++i)
+        put_vertex_curvatures(vertex_vector[i], curvatures[i]);
+      return;
+    }
+#endif
 
-      if (is_Gaussian_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(gaussian_curvature_map, v, vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure) :
-          put(gaussian_curvature_map, v, 0);
-      }
+    for (vertex_descriptor v : vertex_range)
+      put_vertex_curvatures(v, selected_curvatures_vertex(v));
+  }
 
-      if (is_principal_curvatures_and_directions_selected) {
-        // compute the principal curvatures and directions from the anisotropic measure
-        const Vector_3& v_normal = get(vnm, v);
-        const Principal_curvatures_and_directions<GT> principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
-          vertex_measures.anisotropic_measure,
-          vertex_measures.area_measure,
-          v_normal,
-          avg_edge_length
-          );
-        put(principal_curvatures_and_directions_map, v, principal_curvatures_and_directions);
+  // gets the points used by `face_in_ball_ratio()` for `f`: its vertices and their center
+  void face_sample_points(face_descriptor f, std::vector<Vector_3>& samples) const
+  {
+    samples.clear();
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+    {
+      const Point_3& p = get(vpm, v);
+      samples.push_back(Vector_3(p.x(), p.y(), p.z()));
+    }
+    Vector_3 xm = std::accumulate(samples.begin(), samples.end(), Vector_3(0, 0, 0));
+    xm /= static_cast<FT>(samples.size());
+    samples.push_back(xm);
+  }
+
+  static FT squared_distance_to_samples(const Vector_3& p, const std::vector<Vector_3>& samples)
+  {
+    FT d_min = (samples.front() - p).squared_length();
+    for (const Vector_3& s : samples)
+      d_min = (std::min)(d_min, (s - p).squared_length());
+    return d_min;
+  }
+
+  // collects the faces whose measures are used to expand the measures at the vertices to update (`region`),
+  // and the vertices whose expanded measures use a face whose measures are modified by a change
+  // of the faces of `changed_faces` (`updated`)
+  template <class FaceRange>
+  void collect_updated_region(const FaceRange& changed_faces,
+                              std::vector<face_descriptor>& region,
+                              std::vector<vertex_descriptor>& updated) const
+  {
+    // the normals of the vertices of the changed faces are modified,
+    // and so are the measures of the faces incident to these vertices
+    std::unordered_set<vertex_descriptor> changed_vertices;
+    std::unordered_set<face_descriptor> seed_set;
+    std::vector<face_descriptor> seed_faces;
+    for (face_descriptor f : changed_faces)
+      for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+        if (changed_vertices.insert(v).second)
+          for (face_descriptor fv : faces_around_target(halfedge(v, pmesh), pmesh))
+            if (fv != boost::graph_traits<PolygonMesh>::null_face() && seed_set.insert(fv).second)
+              seed_faces.push_back(fv);
+
+    std::unordered_set<face_descriptor> region_set;
+    std::unordered_set<vertex_descriptor> updated_set;
+
+    // without radius, the expansion at a vertex only uses the faces incident to it
+    if (is_negative(ball_radius))
+    {
+      for (face_descriptor f : seed_faces)
+        for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
+          if (updated_set.insert(v).second)
+          {
+            updated.push_back(v);
+            for (face_descriptor fv : faces_around_target(halfedge(v, pmesh), pmesh))
+              if (fv != boost::graph_traits<PolygonMesh>::null_face() && region_set.insert(fv).second)
+                region.push_back(fv);
+          }
+      return;
+    }
+
+    // The expansion at a vertex `v` uses the faces having a sample point closer than the radius to `v`
+    // and connected to `v` by such faces. Hence, a vertex using a seed face is closer than the radius
+    // to a sample point of the seed face, and the faces it uses have a sample point closer than twice
+    // the radius to this sample point. These faces are gathered with a BFS traversal from each seed face.
+    const FT sq_radius = square(ball_radius);
+    const FT sq_diameter = 4 * sq_radius;
+
+    std::queue<face_descriptor> bfs_queue;
+    std::unordered_set<face_descriptor> bfs_visited;
+    std::vector<Vector_3> seed_samples, samples;
+    for (face_descriptor f : seed_faces)
+    {
+      face_sample_points(f, seed_samples);
+
+      bfs_visited.clear();
+      bfs_queue.push(f);
+      bfs_visited.insert(f);
+      while (!bfs_queue.empty())
+      {
+        face_descriptor fi = bfs_queue.front();
+        bfs_queue.pop();
+
+        if (region_set.insert(fi).second)
+          region.push_back(fi);
+
+        for (vertex_descriptor vi : vertices_around_face(halfedge(fi, pmesh), pmesh))
+        {
+          if (updated_set.count(vi) != 0)
+            continue;
+          const Point_3& pi = get(vpm, vi);
+          if (squared_distance_to_samples(Vector_3(pi.x(), pi.y(), pi.z()), seed_samples) < sq_radius)
+          {
+            updated_set.insert(vi);
+            updated.push_back(vi);
+          }
+        }
+
+        for (face_descriptor fj : faces_around_face(halfedge(fi, pmesh), pmesh))
+        {
+          if (fj == boost::graph_traits<PolygonMesh>::null_face() || !bfs_visited.insert(fj).second)
+            continue;
+
+          face_sample_points(fj, samples);
+          for (const Vector_3& s : samples)
+          {
+            if (squared_distance_to_samples(s, seed_samples) < sq_diameter)
+            {
+              bfs_queue.push(fj);
+              break;
+            }
+          }
+        }
       }
     }
   }
@@ -1075,8 +1353,22 @@ private:
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{average_edge_length}
+*     \cgalParamDescription{the average length of the edges of `pmesh`, which scales the radius used
+*                           when `ball_radius` is `0` and the regularization of the principal curvatures.}
+*     \cgalParamType{`GT::FT`}
+*     \cgalParamDefault{the average length of all the edges of `pmesh`}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
+* \sa `update_interpolated_corrected_curvatures()`
 */
 template<typename PolygonMesh,
          typename  CGAL_NP_TEMPLATE_PARAMETERS>
@@ -1086,6 +1378,139 @@ void interpolated_corrected_curvatures(const PolygonMesh& pmesh,
   internal::Interpolated_corrected_curvatures_computer<PolygonMesh, CGAL_NP_CLASS>(pmesh, np);
 }
 
+/**
+* \ingroup PMP_corrected_curvatures_grp
+*
+* updates the interpolated corrected curvatures of the mesh `pmesh` after a local modification.
+* The curvatures are recomputed only at the vertices whose expanded measures use a face
+* whose measures are affected by the modification, that is a face incident to a vertex of a face of `changed_faces`.
+* The values stored in the property maps for the other vertices are left unchanged, and are
+* expected to have been computed by a previous call to `interpolated_corrected_curvatures()`
+* with the same named parameters.
+*
+* \note This function depends on the \eigen 3.1 (or later) library.
+*
+* @tparam FaceRange a model of `ConstRange` with value type `boost::graph_traits<PolygonMesh>::%face_descriptor`.
+* @tparam PolygonMesh a model of `FaceListGraph`.
+* @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters".
+*
+* @param changed_faces the faces of `pmesh` that have been created or whose vertices have been moved
+*                      since the curvatures were computed. If some faces have been removed,
+*                      the faces incident to the vertices of the removed faces must also be part of this range.
+* @param pmesh the polygon mesh.
+* @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below.
+*        `GT` stands for the type of the object provided to the named parameter `geom_traits()`.
+*
+* \cgalNamedParamsBegin
+*
+*   \cgalParamNBegin{vertex_mean_curvature_map}
+*     \cgalParamDescription{a property map associating mean curvatures to the vertices of `pmesh`.}
+*     \cgalParamType{a class model of `WritablePropertyMap` with
+*                    `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+*                    as key type and `GT::FT` as value type}
+*     \cgalParamExtra{If this parameter is omitted, mean curvatures will not be updated.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{vertex_Gaussian_curvature_map}
+*     \cgalParamDescription{a property map associating Gaussian curvatures to the vertices of `pmesh`.}
+*     \cgalParamType{a class model of `WritablePropertyMap` with
+*                    `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+*                    as key type and `GT::FT` as value type.}
+*     \cgalParamExtra{If this parameter is omitted, Gaussian curvatures will not be updated.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{vertex_principal_curvatures_and_directions_map}
+*     \cgalParamDescription{a property map associating principal curvatures and directions to the vertices of `pmesh`.}
+*     \cgalParamType{a class model of `WritablePropertyMap` with
+*                    `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+*                    as key type and `Principal_curvatures_and_directions<GT>` as value type.}
+*     \cgalParamExtra{If this parameter is omitted, principal curvatures and directions will not be updated.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{ball_radius}
+*     \cgalParamDescription{a strictly positive scalar value specifying the radius used for expanding curvature measures
+*                           by summing measures of faces inside a ball of this radius centered at the
+*                           vertex expanded from. The summed face measures are weighted by their
+*                           inclusion ratio inside this ball.}
+*     \cgalParamType{`GT::FT`}
+*     \cgalParamDefault{`-1`}
+*     \cgalParamExtra{If this parameter is omitted (`-1`), the expansion is then just a sum of
+*                     measures on faces around the vertex.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{vertex_point_map}
+*     \cgalParamDescription{a property map associating points to the vertices of `pmesh`.}
+*     \cgalParamType{a class model of `ReadablePropertyMap` with
+*                    `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+*                    as key type and `GT::Point_3` as value type.}
+*     \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`.}
+*     \cgalParamExtra{If this parameter is omitted, an internal property map for
+*                     `CGAL::vertex_point_t` must be available in `PolygonMesh`.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{vertex_normal_map}
+*     \cgalParamDescription{a property map associating normal vectors to the vertices of `pmesh`.}
+*     \cgalParamType{a class model of `ReadablePropertyMap` with
+*                    `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+*                    as key type and `GT::Vector_3` as value type.}
+*     \cgalParamDefault{`get(dynamic_vertex_property_t<GT::Vector_3>(), pmesh)`.}
+*     \cgalParamExtra{If this parameter is omitted, the normals of the vertices of the faces used
+*                     will be computed using `compute_vertex_normal()`.
+*                     Otherwise, the normals must be up to date.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{geom_traits}
+*     \cgalParamDescription{an instance of a geometric traits class.}
+*     \cgalParamType{a class model of `Kernel`}
+*     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`.}
+*     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{average_edge_length}
+*     \cgalParamDescription{the average length of the edges of `pmesh` used by the previous computation of the curvatures,
+*                           which scales the radius used when `ball_radius` is `0` and the regularization
+*                           of the principal curvatures.}
+*     \cgalParamType{`GT::FT`}
+*     \cgalParamDefault{the average length of all the edges of `pmesh`}
+*     \cgalParamExtra{Passing the value of the previous computation avoids a pass over the whole mesh,
+*                     and ensures that the updated vertices use the same value as the other vertices.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{vertex_output_iterator}
+*     \cgalParamDescription{an output iterator collecting the vertices whose curvatures have been updated}
+*     \cgalParamType{a model of `OutputIterator` with value type `boost::graph_traits<PolygonMesh>::%vertex_descriptor`}
+*     \cgalParamDefault{`Emptyset_iterator`}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*   \cgalParamNEnd
+*
+* \cgalNamedParamsEnd
+*
+* \sa `interpolated_corrected_curvatures()`
+*/
+template<typename FaceRange,
+         typename PolygonMesh,
+         typename CGAL_NP_TEMPLATE_PARAMETERS>
+void update_interpolated_corrected_curvatures(const FaceRange& changed_faces,
+                                              const PolygonMesh& pmesh,
+                                              const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::vertex_output_iterator_t,
+                                                       CGAL_NP_CLASS,
+                                                       Emptyset_iterator>::type Vertex_output_iterator;
+  Vertex_output_iterator vertex_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::vertex_output_iterator));
+
+  internal::Interpolated_corrected_curvatures_computer<PolygonMesh, CGAL_NP_CLASS> computer(pmesh, changed_faces, np);
+  std::copy(computer.updated_vertices().begin(), computer.updated_vertices().end(), vertex_out);
+}
+
 /**
 * \ingroup PMP_corrected_curvatures_grp
 * computes the interpolated corrected curvatures at a vertex `v`.
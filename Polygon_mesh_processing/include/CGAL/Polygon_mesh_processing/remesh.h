@@ -193,6 +193,19 @@ namespace Polygon_mesh_processing {
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the tangential relaxation (see `tangential_relaxation()`)
+*                     and the projection steps are performed concurrently. The faces are partitioned into
+*                     spatially coherent patches, and the edges of each patch are flipped concurrently
+*                     with the edges of the other patches, the edges next to patch boundaries being flipped
+*                     sequentially afterwards. Edge splits and collapses remain sequential.
+*                     The functors passed to `allow_move_functor` and `projection_functor`
+*                     must be safe to call concurrently.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @sa `split_long_edges()`
@@ -318,6 +331,12 @@ void isotropic_remeshing(const FaceRange& faces
   bool do_split = choose_parameter(get_parameter(np, internal_np::do_split), true);
   bool do_flip = choose_parameter(get_parameter(np, internal_np::do_flip), true);
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
 #ifdef CGAL_PMP_REMESHING_VERBOSE
   std::cout << std::endl;
   std::cout << "Remeshing (#iter = " << nb_iterations << ")..." << std::endl;
@@ -335,10 +354,10 @@ void isotropic_remeshing(const FaceRange& faces
     if(do_collapse)
      remesher.collapse_short_edges(sizing, collapse_constraints);
     if(do_flip)
-      remesher.flip_edges_for_valence_and_shape();
-    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian, sizing, shall_move);
+      remesher.template flip_edges_for_valence_and_shape<Concurrency_tag>();
+    remesher.template tangential_relaxation_impl<Concurrency_tag>(smoothing_1d, nb_laplacian, sizing, shall_move);
     if ( choose_parameter(get_parameter(np, internal_np::do_project), true) )
-      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor));
+      remesher.template project_to_surface<Concurrency_tag>(get_parameter(np, internal_np::projection_functor));
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << std::endl;
 #endif
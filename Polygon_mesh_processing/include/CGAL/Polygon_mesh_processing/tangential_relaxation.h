@@ -19,13 +19,22 @@
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/Polygon_mesh_processing/Uniform_sizing_field.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <algorithm>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -123,6 +132,16 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, smoothing weights are the same for all vertices.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the relocations are computed concurrently, and the vertices
+*                     are then moved concurrently by sets of pairwise non-adjacent vertices. The result may thus
+*                     slightly differ from the sequential one. The functor passed to `allow_move_functor`
+*                     must be safe to call concurrently.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
@@ -226,145 +245,263 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
-  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
-  {
-#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
-    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
-    std::cout << nb_iterations << ") ";
-    std::cout.flush();
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      CGAL_NP_CLASS,
+      Sequential_tag
+    > ::type Concurrency_tag;
+  constexpr bool parallel_execution = std::is_same_v<Parallel_tag, Concurrency_tag>;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!parallel_execution,
+                 "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
-    typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
-    auto gt_barycenter = gt.construct_barycenter_3_object();
-    auto gt_project = gt.construct_projected_point_3_object();
+  typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
+  auto gt_barycenter = gt.construct_barycenter_3_object();
+  auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+  // computes the barycenter of the neighbors of `v`, and the normal at `v`
+  // given by `vertex_normal` if `v` is not on a border or a constraint
+  auto compute_barycenter = [&](const vertex_descriptor v,
+                                const auto& vertex_normal) -> std::optional<VNP>
+  {
+    if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
+      return std::nullopt;
 
-    // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    // collect hedges to detect if we have to handle boundary cases
+    std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
+    for(halfedge_descriptor h : halfedges_around_target(v, tm))
     {
-      if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
-
-      // collect hedges to detect if we have to handle boundary cases
-      std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
-      for(halfedge_descriptor h : halfedges_around_target(v, tm))
-      {
-        if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
-          border_halfedges.push_back(h);
-        else
-          interior_hedges.push_back(h);
-      }
+      if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
+        border_halfedges.push_back(h);
+      else
+        interior_hedges.push_back(h);
+    }
 
-      if (border_halfedges.empty())
+    if (border_halfedges.empty())
+    {
+      const Vector_3 vn = vertex_normal(v);
+      Vector_3 move = CGAL::NULL_VECTOR;
+      if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
       {
-        const Vector_3& vn = vnormals.at(v);
-        Vector_3 move = CGAL::NULL_VECTOR;
-        if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
+        unsigned int star_size = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          unsigned int star_size = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
-            ++star_size;
-          }
-          CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
-          move = (1. / static_cast<double>(star_size)) * move;
+          move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
+          ++star_size;
         }
-        else
-        {
-          auto gt_centroid = gt.construct_centroid_3_object();
-          auto gt_area = gt.compute_area_3_object();
-          double weight = 0;
-          for(halfedge_descriptor h :interior_hedges)
-          {
-            // calculate weight
-            // need v, v1 and v2
-            const vertex_descriptor v1 = target(next(h, tm), tm);
-            const vertex_descriptor v2 = source(h, tm);
-
-            const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            const double face_weight = tri_area
-                                       / (1. / 3. * (sizing.at(v, tm)
-                                                   + sizing.at(v1, tm)
-                                                   + sizing.at(v2, tm)));
-            weight += face_weight;
-
-            const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
-            move = move + Vector_3(get(vpm, v), centroid) * face_weight;
-          }
-          move = move / weight; //todo ip: what if weight ends up being close to 0?
-        }
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
+        move = (1. / static_cast<double>(star_size)) * move;
       }
       else
       {
-        if (!relax_constraints) continue;
-        Vector_3 vn(NULL_VECTOR);
-
-        if (border_halfedges.size() == 2)// corners are constrained
+        auto gt_centroid = gt.construct_centroid_3_object();
+        auto gt_area = gt.compute_area_3_object();
+        double weight = 0;
+        for(halfedge_descriptor h :interior_hedges)
         {
-          vertex_descriptor ph0 = source(border_halfedges[0], tm);
-          vertex_descriptor ph1 = source(border_halfedges[1], tm);
-          double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
-                                 * Vector_3(get(vpm, v), get(vpm, ph1)));
-          // \todo shouldn't it be an input parameter?
-          //check squared cosine is < 0.25 (~120 degrees)
-          if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
-                                 squared_distance(get(vpm,ph1), get(vpm, v))) )
-          {
-            typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
-            // to avoid shrinking of borders, we project back onto the incident segments
-            typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
-                                   s2(get(vpm, ph1), get(vpm,v));
-
-            typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
-
-            bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
-          }
+          // calculate weight
+          // need v, v1 and v2
+          const vertex_descriptor v1 = target(next(h, tm), tm);
+          const vertex_descriptor v2 = source(h, tm);
+
+          const double tri_area = gt_area(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          const double face_weight = tri_area
+                                     / (1. / 3. * (sizing.at(v, tm)
+                                                 + sizing.at(v1, tm)
+                                                 + sizing.at(v2, tm)));
+          weight += face_weight;
+
+          const Point_3 centroid = gt_centroid(get(vpm, v), get(vpm, v1), get(vpm, v2));
+          move = move + Vector_3(get(vpm, v), centroid) * face_weight;
         }
+        move = move / weight; //todo ip: what if weight ends up being close to 0?
       }
+      return VNP(v, vn, get(vpm, v) + move);
     }
 
-    // compute moves
-    typedef std::pair<vertex_descriptor, Point_3> VP_pair;
-    std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
-    new_locations.reserve(barycenters.size());
-    for(const VNP& vnp : barycenters)
+    if (!relax_constraints)
+      return std::nullopt;
+    Vector_3 vn(NULL_VECTOR);
+
+    if (border_halfedges.size() == 2)// corners are constrained
     {
-      vertex_descriptor v = std::get<0>(vnp);
-      const Point_3& pv = get(vpm, v);
-      const Vector_3& nv = std::get<1>(vnp);
-      const Point_3& qv = std::get<2>(vnp); //barycenter at v
+      vertex_descriptor ph0 = source(border_halfedges[0], tm);
+      vertex_descriptor ph1 = source(border_halfedges[1], tm);
+      double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
+                             * Vector_3(get(vpm, v), get(vpm, ph1)));
+      // \todo shouldn't it be an input parameter?
+      //check squared cosine is < 0.25 (~120 degrees)
+      if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
+                             squared_distance(get(vpm,ph1), get(vpm, v))) )
+      {
+        typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
+        // to avoid shrinking of borders, we project back onto the incident segments
+        typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
+                               s2(get(vpm, ph1), get(vpm,v));
+
+        typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
 
-      new_locations.emplace_back(v, qv + (nv * Vector_3(qv, pv)) * nv);
+        bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
+        return VNP(v, vn, bary);
+      }
     }
+    return std::nullopt;
+  };
+
+  // the barycenter, moved back to the tangent plane
+  auto new_location = [&](const VNP& vnp) -> Point_3
+  {
+    const Point_3& pv = get(vpm, std::get<0>(vnp));
+    const Vector_3& nv = std::get<1>(vnp);
+    const Point_3& qv = std::get<2>(vnp); //barycenter at v
+
+    return qv + (nv * Vector_3(qv, pv)) * nv;
+  };
 
-    // perform moves
-    for(const VP_pair& vp : new_locations)
+  auto perform_move = [&](const vertex_descriptor v, const Point_3& new_pos)
+  {
+    const Point_3 initial_pos = get(vpm, v); // make a copy on purpose
+    const Vector_3 move(initial_pos, new_pos);
+
+    put(vpm, v, new_pos);
+
+    //check that no inversion happened
+    double frac = 1.;
+    while (frac > 0.03 //5 attempts maximum
+           && (   !check_normals(v)
+                  || !shall_move(v, initial_pos, get(vpm, v)))) //if a face has been inverted
     {
-      const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
-      const Vector_3 move(initial_pos, vp.second);
+      frac = 0.5 * frac;
+      put(vpm, v, initial_pos + frac * move);//shorten the move by 2
+    }
+    if (frac <= 0.02)
+      put(vpm, v, initial_pos);//cancel move
+  };
 
-      put(vpm, vp.first, vp.second);
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (parallel_execution)
+  {
+    typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+
+    const std::vector<vertex_descriptor> vertex_vector(std::begin(vertices), std::end(vertices));
+    const auto face_range = faces(tm);
+    const std::vector<face_descriptor> face_vector(face_range.begin(), face_range.end());
 
-      //check that no inversion happened
-      double frac = 1.;
-      while (frac > 0.03 //5 attempts maximum
-             && (   !check_normals(vp.first)
-                    || !shall_move(vp.first, initial_pos, get(vpm, vp.first)))) //if a face has been inverted
+    // The moves of a vertex only read the positions of its neighbors:
+    // the vertices of a color class, which are pairwise non-adjacent,
+    // are moved concurrently (greedy coloring in the order of `vertices`).
+    std::vector<std::vector<std::size_t> > color_classes;
+    {
+      std::unordered_map<vertex_descriptor, std::size_t> colors;
+      std::vector<bool> used;
+      for (std::size_t i = 0; i < vertex_vector.size(); ++i)
       {
-        frac = 0.5 * frac;
-        put(vpm, vp.first, initial_pos + frac * move);//shorten the move by 2
+        const vertex_descriptor v = vertex_vector[i];
+        used.assign(color_classes.size() + 1, false);
+        if (!CGAL::internal::is_isolated(v, tm))
+          for (vertex_descriptor w : vertices_around_target(v, tm))
+          {
+            auto it = colors.find(w);
+            if (it != colors.end())
+              used[it->second] = true;
+          }
+        const std::size_t c = std::find(used.begin(), used.end(), false) - used.begin();
+        if (c == color_classes.size())
+          color_classes.emplace_back();
+        color_classes[c].push_back(i);
+        colors.emplace(v, c);
       }
-      if (frac <= 0.02)
-        put(vpm, vp.first, initial_pos);//cancel move
     }
-  }//end for loop (nit == nb_iterations)
+
+    typedef CGAL::dynamic_face_property_t<Vector_3> Face_normal_tag;
+    auto fnormals = get(Face_normal_tag(), tm, Vector_3(NULL_VECTOR));
+    std::vector<std::optional<Point_3> > new_locations(vertex_vector.size());
+
+    for (unsigned int nit = 0; nit < nb_iterations; ++nit)
+    {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+      std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+      std::cout << nb_iterations << ") ";
+      std::cout.flush();
+#endif
+
+      // at each face, compute face normal
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, face_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+          put(fnormals, face_vector[i], compute_face_normal(face_vector[i], tm, np));
+      });
+
+      // at each vertex, compute barycenter of neighbors and the move
+      auto vertex_normal = [&](const vertex_descriptor v)
+      {
+        return compute_vertex_normal(v, tm, np.face_normal_map(fnormals));
+      };
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+        {
+          new_locations[i].reset();
+          if (std::optional<VNP> vnp = compute_barycenter(vertex_vector[i], vertex_normal))
+            new_locations[i] = new_location(*vnp);
+        }
+      });
+
+      // perform moves, one color class at a time
+      for (const std::vector<std::size_t>& color_class : color_classes)
+      {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, color_class.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          for (std::size_t k = r.begin(); k != r.end(); ++k)
+          {
+            const std::size_t i = color_class[k];
+            if (new_locations[i])
+              perform_move(vertex_vector[i], *new_locations[i]);
+          }
+        });
+      }
+    }//end for loop (nit == nb_iterations)
+  }
+  else
+#endif
+  {
+    for (unsigned int nit = 0; nit < nb_iterations; ++nit)
+    {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+      std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+      std::cout << nb_iterations << ") ";
+      std::cout.flush();
+#endif
+
+      std::vector< VNP > barycenters;
+
+      // at each vertex, compute vertex normal
+      std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+
+      // at each vertex, compute barycenter of neighbors
+      auto vertex_normal = [&](const vertex_descriptor v) { return vnormals.at(v); };
+      for(vertex_descriptor v : vertices)
+        if (std::optional<VNP> vnp = compute_barycenter(v, vertex_normal))
+          barycenters.push_back(*vnp);
+
+      // compute moves
+      typedef std::pair<vertex_descriptor, Point_3> VP_pair;
+      std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
+      new_locations.reserve(barycenters.size());
+      for(const VNP& vnp : barycenters)
+        new_locations.emplace_back(std::get<0>(vnp), new_location(vnp));
+
+      // perform moves
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp.first, vp.second);
+    }//end for loop (nit == nb_iterations)
+  }
 
 #ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
   std::cout << "\rTangential relaxation : "
@@ -60,6 +60,37 @@ namespace Polygon_mesh_processing {
     };
   } // namespace Hole_filling
 
+  namespace internal {
+
+  // the maximum squared distance between the vertices of the hole boundary and their fitting plane
+  // for the hole to be filled using a 2D constrained Delaunay triangulation
+  template <typename GeomTraits, typename PolygonMesh, typename VertexPointMap>
+  typename GeomTraits::FT
+  hole_max_squared_distance(const PolygonMesh& pmesh,
+                            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                            const VertexPointMap vpmap,
+                            const typename GeomTraits::FT threshold_distance)
+  {
+    std::vector<typename GeomTraits::Point_3> points;
+    typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
+    Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
+    do {
+      points.push_back(get(vpmap, target(*circ, pmesh)));
+    } while (++circ != done);
+
+    const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
+    typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
+    default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
+
+    typename GeomTraits::FT max_squared_distance = default_squared_distance;
+    if (threshold_distance >= typename GeomTraits::FT(0))
+      max_squared_distance = threshold_distance * threshold_distance;
+    CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+    return max_squared_distance;
+  }
+
+  } // namespace internal
+
   /*!
   \ingroup PMP_hole_filling_grp
 
@@ -143,6 +174,14 @@ namespace Polygon_mesh_processing {
                       otherwise nothing will be done.}
     \cgalParamNEnd
 
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel mode, the weights of the triangulations of the large holes are computed
+                      concurrently when the cubic search space is used.}
+    \cgalParamNEnd
+
     \cgalParamNBegin{visitor}
       \cgalParamDescription{a visitor used to track when entering a given phase of the algorithm}
       \cgalParamType{A model of PMPHolefillingVisitor}
@@ -195,27 +234,22 @@ namespace Polygon_mesh_processing {
         choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
 #endif
 
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same_v<Concurrency_tag, Parallel_tag>,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+
     typename GeomTraits::FT max_squared_distance = typename GeomTraits::FT(-1);
     if (use_cdt) {
-
-      std::vector<typename GeomTraits::Point_3> points;
-      typedef Halfedge_around_face_circulator<PolygonMesh> Hedge_around_face_circulator;
-      const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
-      Hedge_around_face_circulator circ(border_halfedge, pmesh), done(circ);
-      do {
-        points.push_back(get(vpmap, target(*circ, pmesh)));
-      } while (++circ != done);
-
-      const typename GeomTraits::Iso_cuboid_3 bbox = CGAL::bounding_box(points.begin(), points.end());
-      typename GeomTraits::FT default_squared_distance = CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5)));
-      default_squared_distance /= typename GeomTraits::FT(16); // one quarter of the bbox height
-
-      const typename GeomTraits::FT threshold_distance = choose_parameter(
-        get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1));
-      max_squared_distance = default_squared_distance;
-      if (threshold_distance >= typename GeomTraits::FT(0))
-        max_squared_distance = threshold_distance * threshold_distance;
-      CGAL_assertion(max_squared_distance >= typename GeomTraits::FT(0));
+      max_squared_distance = internal::hole_max_squared_distance<GeomTraits>(
+        pmesh, border_halfedge, vpmap,
+        choose_parameter(get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1)));
     }
 
     Hole_filling::Default_visitor default_visitor;
@@ -225,13 +259,14 @@ namespace Polygon_mesh_processing {
         pmesh,
         border_halfedge,
         out,
-        choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh)),
+        vpmap,
         use_dt3,
         choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits)),
         use_cdt,
         choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false),
         choose_parameter(get_parameter_reference(np, internal_np::visitor), default_visitor),
-        max_squared_distance).first;
+        max_squared_distance,
+        Concurrency_tag()).first;
   }
 
 #ifndef CGAL_NO_DEPRECATED_CODE
@@ -635,6 +670,374 @@ namespace Polygon_mesh_processing {
   }
 #endif // CGAL_NO_DEPRECATED_CODE
 
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates several holes of a polygon mesh.
+
+  The triangulations of the holes are computed before the mesh is modified, which enables computing them concurrently.
+  The patches are then added to the mesh in the order of `border_halfedges`, except for the holes
+  sharing a vertex with a previous hole in `border_halfedges`: these are triangulated and filled afterwards,
+  in the same order. The triangles are the same as with successive calls to `triangulate_hole()`
+  in the order of `border_halfedges`, but the faces are created in a different order if some holes share vertices.
+  If a hole cannot be triangulated, it is left unchanged.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `ConstRange` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range of border halfedges, one per hole
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If no valid triangulation can be found in this search space, the algorithm
+                      falls back to the non-Delaunay triangulations search space to find a solution.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, the points of the boundary of each hole are used
+                            to estimate a fitting plane and a 2D constrained Delaunay triangulation
+                            is then used to fill the hole projected in the fitting plane.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If the boundary of the hole is not planar (according to the
+                      parameter `threshold_distance`) or if no valid 2D triangulation
+                      can be found, the algorithm falls back to the method using
+                      the 3D Delaunay triangulation. This parameter is a good choice for near planar holes.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the boundary of a hole and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{do_not_use_cubic_algorithm}
+      \cgalParamDescription{Set this parameter to `true` if you only want to use the Delaunay based versions of the algorithm,
+                            skipping the cubic search space one in case of failure.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If `true`, `use_2d_constrained_delaunay_triangulation` or `use_delaunay_triangulation` must be set to `true`
+                      otherwise nothing will be done.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel mode, the triangulations of the holes are computed concurrently.
+                      The output does not depend on the number of threads.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{visitor}
+      \cgalParamDescription{a visitor used to track when entering a given phase of the algorithm}
+      \cgalParamType{A model of PMPHolefillingVisitor}
+      \cgalParamType{Hole_filling::Default_visitor}
+      \cgalParamExtra{In parallel mode, the functions of the visitor are never called concurrently,
+                      but the calls related to the triangulations of different holes may be interleaved.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @pre Each hole is described by exactly one halfedge of `border_halfedges`.
+
+  @return the face output iterator
+
+  \sa CGAL::Polygon_mesh_processing::triangulate_hole()
+  \sa CGAL::Polygon_mesh_processing::extract_boundary_cycles()
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  auto
+  triangulate_holes(PolygonMesh& pmesh,
+                    const HalfedgeRange& border_halfedges,
+                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+    using parameters::get_parameter_reference;
+
+    typedef typename GetGeomTraits<PolygonMesh,CGAL_NP_CLASS>::type         GeomTraits;
+    typedef typename GeomTraits::FT                                         FT;
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor  halfedge_descriptor;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    Face_output_iterator out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         CGAL_NP_CLASS,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same_v<Concurrency_tag, Parallel_tag>,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    bool use_dt3 =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_DT3
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_delaunay_triangulation), true);
+#endif
+
+    bool use_cdt =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+        false;
+#else
+        choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
+#endif
+
+    const auto vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh));
+    const FT threshold_distance = choose_parameter(get_parameter(np, internal_np::threshold_distance), FT(-1));
+
+    auto max_squared_distance = [&](halfedge_descriptor h)
+    {
+      if(!use_cdt)
+        return FT(-1);
+      return internal::hole_max_squared_distance<GeomTraits>(pmesh, h, vpmap, threshold_distance);
+    };
+
+    Hole_filling::Default_visitor default_visitor;
+
+    return
+      internal::triangulate_holes_polygon_mesh<Concurrency_tag>(
+        pmesh,
+        border_halfedges,
+        out,
+        vpmap,
+        use_dt3,
+        choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits)),
+        use_cdt,
+        choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false),
+        choose_parameter(get_parameter_reference(np, internal_np::visitor), default_visitor),
+        max_squared_distance);
+  }
+
+  /*!
+  \ingroup PMP_hole_filling_grp
+  @brief triangulates, refines and fairs several holes of a polygon mesh.
+
+  The holes are first triangulated using `triangulate_holes()`. All the patches are then refined
+  together, and the vertices of all the patches are faired together, using a single linear system.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a model of `ConstRange` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range of border halfedges, one per hole
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_output_iterator}
+      \cgalParamDescription{iterator over patch vertices}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%vertex_descriptor` for patch vertices}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If no valid triangulation can be found in this search space, the algorithm
+                      falls back to the non-Delaunay triangulations search space to find a solution.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, the points of the boundary of each hole are used
+                            to estimate a fitting plane and a 2D constrained Delaunay triangulation
+                            is then used to fill the hole projected in the fitting plane.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If the boundary of the hole is not planar (according to the
+                      parameter `threshold_distance`) or if no valid 2D triangulation
+                      can be found, the algorithm falls back to the method using
+                      the 3D Delaunay triangulation. This parameter is a good choice for near planar holes.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the boundary of a hole and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{do_not_use_cubic_algorithm}
+      \cgalParamDescription{Set this parameter to `true` if you only want to use the Delaunay based versions of the algorithm,
+                            skipping the cubic search space one in case of failure.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If `true`, `use_2d_constrained_delaunay_triangulation` or `use_delaunay_triangulation` must be set to `true`
+                      otherwise nothing will be done.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{In parallel mode, the triangulations of the holes are computed concurrently.
+                      The output does not depend on the number of threads.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{density_control_factor}
+      \cgalParamDescription{factor to control density of the output mesh,
+                            where larger values cause denser refinements, as in `refine()`}
+      \cgalParamType{double}
+      \cgalParamDefault{\f$ \sqrt{2}\f$}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{fairing_continuity}
+      \cgalParamDescription{A value controlling the tangential continuity of the output surface patches.
+                            The possible values are 0, 1 and 2, referring to the  C<sup>0</sup>, C<sup>1</sup>
+                            and C<sup>2</sup> continuity.}
+      \cgalParamType{unsigned int}
+      \cgalParamDefault{`1`}
+      \cgalParamExtra{The larger `fairing_continuity` gets, the more fixed vertices are required.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{sparse_linear_solver}
+      \cgalParamDescription{an instance of the sparse linear solver used for fairing}
+      \cgalParamType{a class model of `SparseLinearAlgebraWithFactorTraits_d`}
+      \cgalParamDefault{If \ref thirdpartyEigen "Eigen" 3.2 (or greater) is available and
+                        `CGAL_EIGEN3_ENABLED` is defined, then the following overload of `Eigen_solver_traits`
+                        is provided as default value:\n
+                        `CGAL::Eigen_solver_traits<Eigen::SparseLU<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::COLAMDOrdering<int> > >`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{visitor}
+      \cgalParamDescription{a visitor used to track when entering a given phase of the algorithm}
+      \cgalParamType{A model of PMPHolefillingVisitor}
+      \cgalParamType{Hole_filling::Default_visitor}
+      \cgalParamExtra{In parallel mode, the functions of the visitor are never called concurrently,
+                      but the calls related to the triangulations of different holes may be interleaved.}
+    \cgalParamNEnd
+  \cgalNamedParamsEnd
+
+  @pre Each hole is described by exactly one halfedge of `border_halfedges`.
+
+  @return tuple of `bool` with `true` if fairing is successful, and
+  the face and vertex output iterator. If the fairing fails, the vertices of none of the patches are moved.
+
+  \sa CGAL::Polygon_mesh_processing::triangulate_holes()
+  \sa CGAL::Polygon_mesh_processing::triangulate_refine_and_fair_hole()
+  \sa CGAL::Polygon_mesh_processing::refine()
+  \sa CGAL::Polygon_mesh_processing::fair()
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  auto
+  triangulate_refine_and_fair_holes(PolygonMesh& pmesh,
+                                    const HalfedgeRange& border_halfedges,
+                                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    CGAL_precondition(CGAL::is_triangle_mesh(pmesh));
+
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+    using parameters::get_parameter_reference;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    Face_output_iterator face_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::vertex_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Vertex_output_iterator;
+
+    Vertex_output_iterator vertex_out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::vertex_output_iterator));
+
+    std::vector<typename boost::graph_traits<PolygonMesh>::face_descriptor> patch;
+    triangulate_holes(pmesh, border_halfedges, np.face_output_iterator(std::back_inserter(patch)));
+    face_out = std::copy(patch.begin(), patch.end(), face_out);
+
+    Hole_filling::Default_visitor default_visitor;
+    typedef typename internal_np::Lookup_named_param_def<internal_np::visitor_t,
+                                                         CGAL_NP_CLASS,
+                                                         Hole_filling::Default_visitor>::reference Visitor;
+
+    Visitor visitor = choose_parameter(get_parameter_reference(np, internal_np::visitor), default_visitor);
+
+    // all the patches are refined and faired at once
+    std::vector<typename boost::graph_traits<PolygonMesh>::vertex_descriptor> patch_vertices;
+    visitor.start_refine_phase();
+    face_out = refine(pmesh, patch, face_out, std::back_inserter(patch_vertices), np).first;
+    visitor.end_refine_phase();
+
+    CGAL_postcondition(CGAL::is_triangle_mesh(pmesh));
+
+    visitor.start_fair_phase();
+    bool fair_success = fair(pmesh, patch_vertices, np);
+    visitor.end_fair_phase();
+
+    vertex_out = std::copy(patch_vertices.begin(), patch_vertices.end(), vertex_out);
+    return std::make_tuple(fair_success, face_out, vertex_out);
+  }
+
   /*!
   \ingroup PMP_hole_filling_grp
   creates triangles to fill the hole defined by points in the range `points`.
@@ -20,10 +20,20 @@
 #include <CGAL/AABB_traits_3.h>
 #include <CGAL/AABB_halfedge_graph_segment_primitive.h>
 #include <CGAL/tuple.h>
+#include <CGAL/tags.h>
+#include <CGAL/Iterator_range.h>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include <set>
 #include <type_traits>
+#include <utility>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #include <boost/graph/adjacency_list.hpp>
 #include <CGAL/Polygon_mesh_processing/internal/Polygon_mesh_slicer/Traversal_traits.h>
@@ -33,6 +43,7 @@
 
 #include <CGAL/boost/graph/split_graph_into_polylines.h>
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/named_params_helper.h>
 
 namespace CGAL {
 
@@ -538,6 +549,231 @@ public:
       m_tree_ptr->traversal(plane, ttraits);
     }
 
+    return build_polylines(plane, app_info, all_coplanar_edges, iedges, vertices, out);
+  }
+
+  /**
+   * Constructs the intersecting polylines of each plane of `planes` with the input triangulated surface mesh.
+   * The polylines are the same as the ones constructed by `operator()` for each plane,
+   * up to the order of the polylines and to the first point of the closed polylines.
+   *
+   * Instead of querying the internal `AABB_tree` once per plane, the planes are sorted along their
+   * common normal vector, and each edge of the mesh is assigned to the range of planes it intersects.
+   * The polylines of each plane are then constructed from the edges assigned to it, independently
+   * of the other planes, which allows to construct them in parallel when the number of planes is large,
+   * for example when computing the layers of an additive manufacturing process.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel construction of the polylines of the planes.
+   *         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   * @tparam PlaneRange a model of `ConstRange` with value type `Traits::Plane_3`
+   * @tparam OutputIterator an output iterator accepting objects of type `std::vector<std::vector<Traits::Point_3> >`.
+   *
+   * @param planes the planes to intersect the triangulated surface mesh with
+   * @param out output iterator of the polylines of each plane, put in the order of `planes`.
+   *            For each plane, the polylines are provided as a `std::vector` of polylines,
+   *            as described in `operator()`.
+   *
+   * \pre all the planes of `planes` are parallel, and have the same orientation.
+   */
+  template <typename ConcurrencyTag = Sequential_tag, class PlaneRange, class OutputIterator>
+  OutputIterator slice(const PlaneRange& planes,
+                       OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same_v<ConcurrencyTag, Parallel_tag>,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef std::vector<Point_3>                                          Polyline;
+
+    const std::vector<Plane_3> plane_vector(std::begin(planes), std::end(planes));
+    const std::size_t nb_planes = plane_vector.size();
+    if (nb_planes == 0)
+      return out;
+
+    for (const Plane_3& plane : plane_vector)
+    {
+      CGAL_precondition(!plane.is_degenerate());
+      CGAL_precondition(plane.orthogonal_direction() == plane_vector.front().orthogonal_direction());
+    }
+
+    typename Traits::Oriented_side_3 oriented_side_3 = m_traits.oriented_side_3_object();
+
+    // sort the planes along their common normal vector
+    std::vector<Point_3> plane_points;
+    plane_points.reserve(nb_planes);
+    for (const Plane_3& plane : plane_vector)
+      plane_points.push_back(plane.point());
+
+    std::vector<std::size_t> order(nb_planes);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t i, std::size_t j)
+                     {
+                       return oriented_side_3(plane_vector[i], plane_points[j]) == ON_POSITIVE_SIDE;
+                     });
+
+    // for each vertex, the range of sorted planes containing it:
+    // the first plane not strictly below it, and the first plane strictly above it
+    typedef typename GetInitializedVertexIndexMap<TriangleMesh>::const_type    Vertex_index_map;
+    const Vertex_index_map vim = get_initialized_vertex_index_map(m_tmesh);
+    const std::vector<vertex_descriptor> vertex_vector(vertices(m_tmesh).first, vertices(m_tmesh).second);
+    std::vector<std::pair<std::size_t, std::size_t> > vertex_plane_ranges(vertex_vector.size());
+
+    auto compute_vertex_plane_range = [&](std::size_t vi)
+    {
+      const Point_3& p = get(m_vpmap, vertex_vector[vi]);
+      typename std::vector<std::size_t>::const_iterator
+        first = std::partition_point(order.cbegin(), order.cend(),
+                                     [&](std::size_t i) { return oriented_side_3(plane_vector[i], p) == ON_POSITIVE_SIDE; }),
+        last = std::partition_point(first, order.cend(),
+                                    [&](std::size_t i) { return oriented_side_3(plane_vector[i], p) != ON_NEGATIVE_SIDE; });
+      vertex_plane_ranges[get(vim, vertex_vector[vi])] = std::make_pair(first - order.cbegin(), last - order.cbegin());
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_vector.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t vi = r.begin(); vi != r.end(); ++vi)
+                            compute_vertex_plane_range(vi);
+                        });
+    }
+    else
+#endif
+    {
+      for (std::size_t vi = 0; vi < vertex_vector.size(); ++vi)
+        compute_vertex_plane_range(vi);
+    }
+
+    // for each edge, the range of sorted planes containing one of its vertices or separating them
+    const std::vector<edge_descriptor> edge_vector(edges(m_tmesh).first, edges(m_tmesh).second);
+    std::vector<std::pair<std::size_t, std::size_t> > edge_plane_ranges(edge_vector.size());
+    for (std::size_t ei = 0; ei < edge_vector.size(); ++ei)
+    {
+      const std::pair<std::size_t, std::size_t>& rs = vertex_plane_ranges[get(vim, source(edge_vector[ei], m_tmesh))];
+      const std::pair<std::size_t, std::size_t>& rt = vertex_plane_ranges[get(vim, target(edge_vector[ei], m_tmesh))];
+      edge_plane_ranges[ei] = std::make_pair((std::min)(rs.first, rt.first), (std::max)(rs.second, rt.second));
+    }
+
+    // assign the edges to the planes, in the order of the sorted planes
+    std::vector<std::size_t> offsets(nb_planes + 1, 0);
+    std::vector<edge_descriptor> plane_edges;
+
+    // the polylines of each plane, in the order of `planes`
+    std::vector<std::vector<Polyline> > polylines(nb_planes);
+
+    auto slice_plane = [&](std::size_t k)
+    {
+      const std::size_t i = order[k];
+      slice_edges(plane_vector[i],
+                  make_range(plane_edges.cbegin() + offsets[k], plane_edges.cbegin() + offsets[k+1]),
+                  std::back_inserter(polylines[i]));
+    };
+
+    for (const std::pair<std::size_t, std::size_t>& r : edge_plane_ranges)
+    {
+      if (r.first < r.second)
+      {
+        ++offsets[r.first + 1];
+        if (r.second < nb_planes)
+          --offsets[r.second + 1];
+      }
+    }
+    // the differences of the numbers of edges are turned into numbers of edges, then into offsets
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    plane_edges.resize(offsets.back());
+    std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+    for (std::size_t ei = 0; ei < edge_vector.size(); ++ei)
+      for (std::size_t k = edge_plane_ranges[ei].first; k < edge_plane_ranges[ei].second; ++k)
+        plane_edges[positions[k]++] = edge_vector[ei];
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_same_v<ConcurrencyTag, Parallel_tag>)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_planes, 1),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for (std::size_t k = r.begin(); k != r.end(); ++k)
+                            slice_plane(k);
+                        });
+    }
+    else
+#endif
+    {
+      for (std::size_t k = 0; k < nb_planes; ++k)
+        slice_plane(k);
+    }
+
+    for (std::vector<Polyline>& plane_polylines : polylines)
+      *out++ = std::move(plane_polylines);
+    return out;
+  }
+
+  ~Polygon_mesh_slicer()
+  {
+    if (m_own_tree) delete m_tree_ptr;
+  }
+
+private:
+  // same as `operator()`, the edges intersected by `plane` being searched
+  // in `edge_range` instead of the internal `AABB_tree`
+  template <class EdgeRange, class OutputIterator>
+  OutputIterator slice_edges(const Plane_3& plane,
+                             const EdgeRange& edge_range,
+                             OutputIterator out) const
+  {
+    std::set<edge_descriptor> all_coplanar_edges;
+    std::vector<edge_descriptor> iedges;
+    Vertices_map vertices;
+
+    std::pair<int, FT> app_info = axis_parallel_plane_info(plane);
+    if (!UseParallelPlaneOptimization || app_info.first==-1)
+    {
+      General_traversal_traits ttraits(
+        all_coplanar_edges,
+        iedges,
+        vertices,
+        m_tmesh,
+        m_vpmap,
+        m_tree_ptr->traits(),
+        m_traits);
+      for (edge_descriptor ed : edge_range)
+        ttraits.intersection(plane, ed);
+    }
+    else
+    {
+      Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits>
+        traits(app_info.first, app_info.second, m_traits);
+
+      Axis_parallel_traversal_traits ttraits(
+        all_coplanar_edges,
+        iedges,
+        vertices,
+        m_tmesh,
+        m_vpmap,
+        m_tree_ptr->traits(),
+        traits);
+      for (edge_descriptor ed : edge_range)
+        ttraits.intersection(plane, ed);
+    }
+
+    return build_polylines(plane, app_info, all_coplanar_edges, iedges, vertices, out);
+  }
+
+  // assembles the edges intersected by `plane` into polylines put in `out`
+  template <class OutputIterator>
+  OutputIterator build_polylines(const Plane_3& plane,
+                                 const std::pair<int, FT>& app_info,
+                                 std::set<edge_descriptor>& all_coplanar_edges,
+                                 std::vector<edge_descriptor>& iedges,
+                                 Vertices_map& vertices,
+                                 OutputIterator out) const
+  {
     // init output graph
     AL_graph al_graph;
 
@@ -643,11 +879,6 @@ public:
       return visitor.out;
     }
   }
-
-  ~Polygon_mesh_slicer()
-  {
-    if (m_own_tree) delete m_tree_ptr;
-  }
 };
 
 }// end of namespace CGAL
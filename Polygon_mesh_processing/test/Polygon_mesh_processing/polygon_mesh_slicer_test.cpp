@@ -18,8 +18,11 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 
+#include <algorithm>
 #include <fstream>
 #include <cassert>
+#include <iterator>
+#include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epic;
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epec;
@@ -40,6 +43,42 @@ bool is_ccw(int xi, int yi,
   }
   return true;
 }
+// the polylines of a plane, independently of their order and of the first point of the closed ones
+template <class Polyline_type>
+std::vector<Polyline_type> canonical_polylines(std::vector<Polyline_type> polylines)
+{
+  for(Polyline_type& polyline : polylines)
+  {
+    if(polyline.size() > 1 && polyline.front() == polyline.back())
+    {
+      polyline.pop_back();
+      std::rotate(polyline.begin(), std::min_element(polyline.begin(), polyline.end()), polyline.end());
+      polyline.push_back(polyline.front());
+    }
+  }
+  std::sort(polylines.begin(), polylines.end());
+  return polylines;
+}
+
+// slicing a range of planes at once vs. one plane after the other
+template <class ConcurrencyTag, class Slicer, class Plane_3>
+void test_batched_slicer(const Slicer& slicer, const std::vector<Plane_3>& planes)
+{
+  typedef std::vector<typename CGAL::Kernel_traits<Plane_3>::Kernel::Point_3> Polyline_type;
+  typedef std::vector< Polyline_type > Polylines;
+
+  std::vector<Polylines> batched_polylines;
+  slicer.template slice<ConcurrencyTag>(planes, std::back_inserter(batched_polylines));
+  assert(batched_polylines.size() == planes.size());
+
+  for(std::size_t i=0; i<planes.size(); ++i)
+  {
+    Polylines polylines;
+    slicer(planes[i], std::back_inserter(polylines));
+    assert(canonical_polylines(polylines) == canonical_polylines(batched_polylines[i]));
+  }
+}
+
 template <typename K>
 int test_slicer()
 {
@@ -164,7 +203,23 @@ int test_slicer()
   assert(polylines.size()==1); // one polyline
   assert( is_ccw<K>(0, 1 , polylines[0]) );
 
-
+  // batched slicing, with planes through vertices and containing faces of the mesh
+  std::vector<typename K::Plane_3> z_planes, y_planes, oblique_planes;
+  for(int i=-12; i<=12; ++i)
+  {
+    z_planes.push_back(typename K::Plane_3(0,0,1,i/8.));
+    y_planes.push_back(typename K::Plane_3(0,-1,0,i/8.));
+    oblique_planes.push_back(typename K::Plane_3(1,1,0.5,i/6.));
+  }
+  std::reverse(y_planes.begin(), y_planes.end());
+  std::swap(oblique_planes.front(), oblique_planes[oblique_planes.size()/2]);
+
+  test_batched_slicer<CGAL::Sequential_tag>(slicer, z_planes);
+  test_batched_slicer<CGAL::Sequential_tag>(slicer, y_planes);
+  test_batched_slicer<CGAL::Sequential_tag>(slicer, oblique_planes);
+  test_batched_slicer<CGAL::Parallel_if_available_tag>(slicer, z_planes);
+  test_batched_slicer<CGAL::Parallel_if_available_tag>(slicer, oblique_planes);
+  test_batched_slicer<CGAL::Sequential_tag>(slicer, std::vector<typename K::Plane_3>());
 
   return 0;
 }
@@ -0,0 +1,92 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
+#include <CGAL/Polygon_mesh_processing/distance.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                      Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <typename ConcurrencyTag>
+void test_remeshing(const Mesh& input, const double target_edge_length)
+{
+  Mesh sequential_mesh = input, parallel_mesh = input;
+
+  // splits and collapses are sequential, and flips keep the numbers of elements
+  PMP::isotropic_remeshing(faces(sequential_mesh), target_edge_length, sequential_mesh,
+                           CGAL::parameters::number_of_relaxation_steps(3));
+  PMP::isotropic_remeshing(faces(parallel_mesh), target_edge_length, parallel_mesh,
+                           CGAL::parameters::number_of_relaxation_steps(3)
+                                            .concurrency_tag(ConcurrencyTag()));
+
+  assert(CGAL::is_valid_polygon_mesh(parallel_mesh));
+  assert(num_faces(parallel_mesh) == num_faces(sequential_mesh));
+  assert(num_vertices(parallel_mesh) == num_vertices(sequential_mesh));
+
+  // the vertices are projected on the input
+  const std::vector<K::Point_3> points(parallel_mesh.points().begin(), parallel_mesh.points().end());
+  const double d = PMP::max_distance_to_triangle_mesh<CGAL::Sequential_tag>(points, input);
+  std::cout << "  distance of the vertices to the input: " << d << std::endl;
+  assert(d < 1e-6 * target_edge_length);
+
+  // more iterations
+  PMP::isotropic_remeshing(faces(parallel_mesh), target_edge_length, parallel_mesh,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .concurrency_tag(ConcurrencyTag()));
+  assert(CGAL::is_valid_polygon_mesh(parallel_mesh));
+  assert(PMP::does_self_intersect(input) || !PMP::does_self_intersect(parallel_mesh));
+}
+
+template <typename ConcurrencyTag>
+void test_relaxation(const Mesh& input)
+{
+  Mesh mesh = input;
+  PMP::tangential_relaxation(mesh, CGAL::parameters::number_of_iterations(5)
+                                                    .concurrency_tag(ConcurrencyTag()));
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(num_vertices(mesh) == num_vertices(input));
+
+  // the border vertices do not move
+  for(Mesh::Vertex_index v : vertices(mesh))
+    if(is_border(v, mesh))
+      assert(mesh.point(v) == input.point(v));
+}
+
+int main(int argc, char* argv[])
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::string filename_with_holes = (argc > 2) ? argv[2]
+                                                     : CGAL::data_file_path("meshes/elephant-with-holes.off");
+
+  Mesh mesh, mesh_with_holes;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) ||
+     !PMP::IO::read_polygon_mesh(filename_with_holes, mesh_with_holes))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return 1;
+  }
+
+  std::cout << "Sequential_tag" << std::endl;
+  test_remeshing<CGAL::Sequential_tag>(mesh, 0.02);
+  test_relaxation<CGAL::Sequential_tag>(mesh_with_holes);
+
+  std::cout << "Parallel_if_available_tag" << std::endl;
+  test_remeshing<CGAL::Parallel_if_available_tag>(mesh, 0.02);
+  test_remeshing<CGAL::Parallel_if_available_tag>(mesh_with_holes, 0.02);
+  // enough faces for the edge flips to be partitioned into several patches
+  test_remeshing<CGAL::Parallel_if_available_tag>(mesh, 0.004);
+  test_relaxation<CGAL::Parallel_if_available_tag>(mesh_with_holes);
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include <CGAL/Polygon_mesh_processing/Adaptive_sizing_field.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+typedef boost::graph_traits<Mesh>::edge_descriptor edge_descriptor;
+typedef boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+const double tol = 0.001;
+const std::pair<double, double> edge_min_max{0.001, 0.5};
+
+// moves a few vertices and flips a few edges in the region of the faces of `selection`,
+// and returns the faces that have been changed
+std::vector<face_descriptor> edit_locally(Mesh& mesh, const std::vector<face_descriptor>& selection)
+{
+  std::unordered_set<face_descriptor> changed_faces;
+
+  std::size_t i = 0;
+  for (face_descriptor f : selection)
+  {
+    if (i++ % 50 != 0)
+      continue;
+
+    const vertex_descriptor v = target(halfedge(f, mesh), mesh);
+    const Point_3 p = mesh.point(v);
+    mesh.point(v) = Point_3(1.02 * p.x(), 1.02 * p.y(), 1.02 * p.z());
+    for (face_descriptor g : faces_around_target(halfedge(v, mesh), mesh))
+      if (g != boost::graph_traits<Mesh>::null_face())
+        changed_faces.insert(g);
+  }
+
+  i = 0;
+  for (face_descriptor f : selection)
+  {
+    if (i++ % 50 != 25)
+      continue;
+
+    const edge_descriptor e = edge(halfedge(f, mesh), mesh);
+    if (is_border(e, mesh) ||
+        halfedge(target(next(halfedge(e, mesh), mesh), mesh),
+                 target(next(opposite(halfedge(e, mesh), mesh), mesh), mesh), mesh).second)
+      continue;
+
+    CGAL::Euler::flip_edge(halfedge(e, mesh), mesh);
+    changed_faces.insert(face(halfedge(e, mesh), mesh));
+    changed_faces.insert(face(opposite(halfedge(e, mesh), mesh), mesh));
+  }
+
+  return std::vector<face_descriptor>(changed_faces.begin(), changed_faces.end());
+}
+
+// the updated sizing field is compared with a sizing field computed from scratch on the modified mesh.
+// The average edge length used by the curvatures is given, as the updated field keeps the one
+// of the initial mesh
+void test_update(Mesh mesh, const std::vector<face_descriptor>& selection)
+{
+  const double avg_edge_length = PMP::average_edge_length(mesh);
+  PMP::Adaptive_sizing_field<Mesh> sizing_field(tol, edge_min_max, selection, mesh,
+                                                CGAL::parameters::average_edge_length(avg_edge_length));
+
+  const std::vector<face_descriptor> changed_faces = edit_locally(mesh, selection);
+  sizing_field.update(changed_faces, mesh);
+
+  PMP::Adaptive_sizing_field<Mesh> reference(tol, edge_min_max, selection, mesh,
+                                             CGAL::parameters::average_edge_length(avg_edge_length));
+
+  std::size_t nb_vertices = 0;
+  for (face_descriptor f : selection)
+  {
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, mesh), mesh))
+    {
+      const double size = sizing_field.at(v, mesh), expected = reference.at(v, mesh);
+      assert(std::abs(size - expected) < 1e-10 * expected);
+      ++nb_vertices;
+    }
+  }
+
+  std::cout << "  " << changed_faces.size() << " faces changed, "
+            << nb_vertices << " vertex sizes compared" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  Mesh mesh;
+  if (!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Not a valid input file." << std::endl;
+    return 1;
+  }
+
+  std::cout << "whole mesh" << std::endl;
+  test_update(mesh, std::vector<face_descriptor>(faces(mesh).begin(), faces(mesh).end()));
+
+  // the faces outside the selection must not be used by the update
+  std::cout << "subset of the faces" << std::endl;
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  std::vector<face_descriptor> selection;
+  for (face_descriptor f : faces(mesh))
+    if (mesh.point(target(halfedge(f, mesh), mesh)).x() < 0.5 * (bb.xmin() + bb.xmax()))
+      selection.push_back(f);
+  test_update(mesh, selection);
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
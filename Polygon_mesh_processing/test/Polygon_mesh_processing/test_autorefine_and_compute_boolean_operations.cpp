@@ -0,0 +1,173 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefine_and_compute_boolean_operations.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/orientation.h>
+#include <CGAL/Polygon_mesh_processing/polygon_mesh_to_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Aff_transformation_3.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <class Mesh>
+double volume(const Mesh& m)
+{
+  if(is_empty(m))
+    return 0;
+  return CGAL::to_double(PMP::volume(m));
+}
+
+// n-ary operation vs. pairwise cascade
+template <class Mesh>
+void test(const std::vector<Mesh>& meshes)
+{
+  Mesh union_out, union_par, inter_out;
+  PMP::autorefine_and_compute_union(meshes, union_out);
+  PMP::autorefine_and_compute_union(meshes, union_par,
+                                    CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  PMP::autorefine_and_compute_intersection(meshes, inter_out);
+
+  assert(CGAL::is_valid_polygon_mesh(union_out));
+  assert(CGAL::is_valid_polygon_mesh(inter_out));
+  assert(CGAL::is_valid_polygon_mesh(union_par));
+  assert(is_closed(union_out) && is_closed(inter_out) && is_closed(union_par));
+  assert(is_empty(union_out) || PMP::is_outward_oriented(union_out));
+
+  Mesh union_ref = meshes[0], inter_ref = meshes[0];
+  for(std::size_t i=1; i<meshes.size(); ++i)
+  {
+    Mesh m1 = meshes[i], m2 = meshes[i], u, in;
+    PMP::corefine_and_compute_union(union_ref, m1, u);
+    PMP::corefine_and_compute_intersection(inter_ref, m2, in);
+    union_ref = u;
+    inter_ref = in;
+  }
+
+  const double vu = volume(union_out), vu_ref = volume(union_ref),
+               vi = volume(inter_out), vi_ref = volume(inter_ref);
+  std::cout << "  union: " << num_faces(union_out) << " faces, volume " << vu << " (" << vu_ref << ")\n"
+            << "  intersection: " << num_faces(inter_out) << " faces, volume " << vi << " (" << vi_ref << ")"
+            << std::endl;
+  assert(std::abs(vu - vu_ref) <= 1e-6 * vu_ref);
+  assert(num_faces(union_par) == num_faces(union_out));
+  assert(std::abs(volume(union_par) - vu) <= 1e-6 * vu);
+  assert(std::abs(vi - vi_ref) <= 1e-6 * vu_ref);
+}
+
+template <class Kernel>
+void test_translated_copies(const std::string& filename,
+                            const std::vector<typename Kernel::Vector_3>& translations)
+{
+  typedef CGAL::Surface_mesh<typename Kernel::Point_3> Mesh;
+
+  Mesh tm;
+  if(!PMP::IO::read_polygon_mesh(filename, tm))
+  {
+    std::cerr << "Invalid input: " << filename << std::endl;
+    assert(false);
+    return;
+  }
+
+  std::vector<Mesh> meshes;
+  for(const typename Kernel::Vector_3& t : translations)
+  {
+    meshes.push_back(tm);
+    PMP::transform(typename Kernel::Aff_transformation_3(CGAL::TRANSLATION, t), meshes.back());
+  }
+
+  std::cout << meshes.size() << " copies of " << filename << std::endl;
+  test(meshes);
+}
+
+// A patch whose first triangle is degenerate, as it can happen after the rounding of the
+// autorefinement, is classified with another triangle. A patch with only degenerate triangles
+// cannot be classified.
+void test_degenerate_triangles()
+{
+  typedef CGAL::Exact_predicates_exact_constructions_kernel  K;
+  typedef K::Point_3                                         Point_3;
+  typedef std::array<std::size_t, 3>                         Triangle;
+  typedef CGAL::Surface_mesh<Point_3>                        Mesh;
+
+  Mesh cube;
+  if(!PMP::IO::read_polygon_mesh("data-coref/cube.off", cube))
+  {
+    std::cerr << "Invalid input: data-coref/cube.off" << std::endl;
+    assert(false);
+    return;
+  }
+
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  PMP::polygon_mesh_to_polygon_soup(cube, points, triangles);
+
+  // split the edge (a, b) of the first triangle (a, b, c) in its middle m, only in this triangle,
+  // and close the surface with the degenerate triangle (a, b, m), placed first
+  const Triangle abc = triangles[0];
+  const std::size_t m = points.size();
+  points.push_back(CGAL::midpoint(points[abc[0]], points[abc[1]]));
+  triangles[0] = Triangle{{abc[0], m, abc[2]}};
+  triangles.push_back(Triangle{{m, abc[1], abc[2]}});
+  triangles.insert(triangles.begin(), Triangle{{abc[0], abc[1], m}});
+
+  std::vector<std::size_t> mesh_ids(triangles.size(), 0);
+  Mesh out;
+  bool res = PMP::internal::compute_boolean_operation_in_refined_soup<CGAL::Sequential_tag>(
+               points, triangles, mesh_ids, 1, out, K(), CGAL::parameters::default_values());
+  assert(res);
+  assert(num_faces(out) == triangles.size());
+  assert(is_closed(out));
+  assert(PMP::volume(out) == 1);
+
+  // only the degenerate triangle
+  points.resize(m + 1);
+  triangles.resize(1);
+  mesh_ids.resize(1);
+  Mesh out_degenerate;
+  res = PMP::internal::compute_boolean_operation_in_refined_soup<CGAL::Sequential_tag>(
+          points, triangles, mesh_ids, 1, out_degenerate, K(), CGAL::parameters::default_values());
+  assert(!res);
+  assert(is_empty(out_degenerate));
+}
+
+int main()
+{
+  typedef CGAL::Exact_predicates_inexact_constructions_kernel Epick;
+  typedef CGAL::Exact_predicates_exact_constructions_kernel   Epeck;
+
+  // overlapping cubes, with shared faces and edges
+  test_translated_copies<Epeck>("data-coref/cube.off",
+                                { Epeck::Vector_3(0, 0, 0), Epeck::Vector_3(0.5, 0.5, 0.5),
+                                  Epeck::Vector_3(1, 0, 0), Epeck::Vector_3(0, 0.5, 0) });
+  test_translated_copies<Epeck>("data-coref/cube.off",
+                                { Epeck::Vector_3(0, 0, 0), Epeck::Vector_3(0.5, 0.5, 0.5),
+                                  Epeck::Vector_3(0, 0.5, 0) });
+  // identical meshes
+  test_translated_copies<Epeck>("data-coref/cube.off",
+                                { Epeck::Vector_3(0, 0, 0), Epeck::Vector_3(0, 0, 0) });
+  // disjoint meshes
+  test_translated_copies<Epeck>("data-coref/cube.off",
+                                { Epeck::Vector_3(0, 0, 0), Epeck::Vector_3(2, 0, 0) });
+
+  test_translated_copies<Epick>("data-coref/sphere.off",
+                                { Epick::Vector_3(0, 0, 0), Epick::Vector_3(0.3, 0, 0),
+                                  Epick::Vector_3(0, 0.3, 0), Epick::Vector_3(0.1, 0.1, 0.3) });
+
+  test_degenerate_triangles();
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,148 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Aff_transformation_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the two meshes have the same faces. The order of the elements is not compared,
+// as it depends on the addresses of the meshes.
+template <class Mesh>
+bool same_meshes(const Mesh& m1, const Mesh& m2)
+{
+  typedef typename Mesh::Point                Point;
+  typedef std::array<Point, 3>                Triangle;
+
+  auto sorted_triangles = [](const Mesh& m)
+  {
+    std::vector<Triangle> triangles;
+    for(typename Mesh::Face_index f : faces(m))
+    {
+      typename Mesh::Halfedge_index h = halfedge(f, m);
+      Triangle t = {{ m.point(source(h, m)), m.point(target(h, m)), m.point(target(next(h, m), m)) }};
+      // keep the orientation
+      std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+      triangles.push_back(t);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  };
+
+  return num_vertices(m1) == num_vertices(m2) &&
+         sorted_triangles(m1) == sorted_triangles(m2);
+}
+
+template <class ConcurrencyTag, class Mesh>
+std::array<Mesh, 4> boolean_operations(const Mesh& tm1, const Mesh& tm2)
+{
+  Mesh m1 = tm1, m2 = tm2;
+  std::array<Mesh, 4> out;
+  std::array<std::optional<Mesh*>, 4> output;
+  for(int i=0; i<4; ++i)
+    output[i] = &out[i];
+
+  PMP::corefine_and_compute_boolean_operations(m1, m2, output,
+                                               CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  for(int i=0; i<4; ++i)
+    assert(CGAL::is_valid_polygon_mesh(out[i]));
+  return out;
+}
+
+template <class Mesh>
+void test(const Mesh& tm1, const Mesh& tm2)
+{
+  const std::array<Mesh, 4> sequential = boolean_operations<CGAL::Sequential_tag>(tm1, tm2);
+  const std::array<Mesh, 4> parallel = boolean_operations<CGAL::Parallel_if_available_tag>(tm1, tm2);
+  for(int i=0; i<4; ++i)
+    assert(same_meshes(sequential[i], parallel[i]));
+
+  // the result does not depend on the number of threads
+#ifdef CGAL_LINKED_WITH_TBB
+  for(int nb_threads : { 1, 3 })
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+    const std::array<Mesh, 4> parallel_t = boolean_operations<CGAL::Parallel_tag>(tm1, tm2);
+    for(int i=0; i<4; ++i)
+      assert(same_meshes(sequential[i], parallel_t[i]));
+  }
+#endif
+
+  // corefinement only
+  Mesh m1 = tm1, m2 = tm2, pm1 = tm1, pm2 = tm2;
+  PMP::corefine(m1, m2);
+  PMP::corefine(pm1, pm2, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(same_meshes(m1, pm1) && same_meshes(m2, pm2));
+
+  std::cout << "  " << num_faces(tm1) << " + " << num_faces(tm2) << " faces -> "
+            << num_faces(m1) << " + " << num_faces(m2) << " faces" << std::endl;
+}
+
+template <class Kernel>
+void test(const std::string& filename1, const std::string& filename2)
+{
+  typedef CGAL::Surface_mesh<typename Kernel::Point_3> Mesh;
+
+  Mesh tm1, tm2;
+  if(!PMP::IO::read_polygon_mesh(filename1, tm1) || !PMP::IO::read_polygon_mesh(filename2, tm2))
+  {
+    std::cerr << "Invalid input: " << filename1 << " " << filename2 << std::endl;
+    assert(false);
+    return;
+  }
+
+  std::cout << filename1 << " " << filename2 << std::endl;
+  test(tm1, tm2);
+}
+
+template <class Kernel>
+void test_translated_copy(const std::string& filename)
+{
+  typedef CGAL::Surface_mesh<typename Kernel::Point_3> Mesh;
+
+  Mesh tm1;
+  if(!PMP::IO::read_polygon_mesh(filename, tm1))
+  {
+    std::cerr << "Invalid input: " << filename << std::endl;
+    assert(false);
+    return;
+  }
+
+  Mesh tm2 = tm1;
+  PMP::transform(typename Kernel::Aff_transformation_3(CGAL::TRANSLATION,
+                                                       typename Kernel::Vector_3(0.011, 0.023, 0.017)), tm2);
+
+  std::cout << filename << " and a translated copy" << std::endl;
+  test(tm1, tm2);
+}
+
+int main()
+{
+  typedef CGAL::Exact_predicates_inexact_constructions_kernel Epick;
+  typedef CGAL::Exact_predicates_exact_constructions_kernel   Epeck;
+
+  test<Epick>(CGAL::data_file_path("meshes/elephant.off"), CGAL::data_file_path("meshes/sphere.off"));
+  test<Epick>("data-coref/cube.off", "data-coref/coplanar_with_cube1.off");
+  test<Epick>("data-coref/large_cube_coplanar.off", "data-coref/small_cube_coplanar_inside.off");
+  test_translated_copy<Epick>(CGAL::data_file_path("meshes/elephant.off"));
+  test_translated_copy<Epeck>(CGAL::data_file_path("meshes/elephant.off"));
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
@@ -9,9 +9,13 @@
 
 #include <boost/graph/graph_traits.hpp>
 
+#include <cmath>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #define ABS_ERROR 1e-6
 
@@ -179,6 +183,120 @@ void test_average_curvatures(std::string mesh_path,
 
 }
 
+// the principal directions are not defined at umbilic points
+bool same_curvatures(const PMP::Principal_curvatures_and_directions<Epic_kernel>& p1,
+                     const PMP::Principal_curvatures_and_directions<Epic_kernel>& p2)
+{
+  if (std::abs(p1.min_curvature - p2.min_curvature) > ABS_ERROR ||
+      std::abs(p1.max_curvature - p2.max_curvature) > ABS_ERROR)
+    return false;
+
+  if (p1.max_curvature - p1.min_curvature < 1e-3 * std::abs(p1.max_curvature))
+    return true;
+
+  return CGAL::cross_product(p1.min_direction, p2.min_direction).squared_length() < 1e-4 &&
+         CGAL::cross_product(p1.max_direction, p2.max_direction).squared_length() < 1e-4;
+}
+
+// parallel computation and update after a local modification vs. computation from scratch
+template <typename PolygonMesh>
+void test_parallel_and_update_curvatures(std::string mesh_path, Epic_kernel::FT expansion_radius)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::face_descriptor face_descriptor;
+  typedef PMP::Principal_curvatures_and_directions<Epic_kernel> Principal_curvatures;
+
+  typedef typename boost::property_map<PolygonMesh, CGAL::dynamic_vertex_property_t<Epic_kernel::FT>>::type Scalar_map;
+  typedef typename boost::property_map<PolygonMesh, CGAL::dynamic_vertex_property_t<Principal_curvatures>>::type Principal_map;
+
+  PolygonMesh pmesh;
+  const std::string filename = CGAL::data_file_path(mesh_path);
+
+  if (!CGAL::IO::read_polygon_mesh(filename, pmesh) || faces(pmesh).size() == 0)
+  {
+    std::cerr << "Invalid input file." << std::endl;
+  }
+
+  Scalar_map mean_curvature_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+             gaussian_curvature_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+             ref_mean_curvature_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+             ref_gaussian_curvature_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh);
+  Principal_map principal_curvatures_and_directions_map = get(CGAL::dynamic_vertex_property_t<Principal_curvatures>(), pmesh),
+                ref_principal_curvatures_and_directions_map = get(CGAL::dynamic_vertex_property_t<Principal_curvatures>(), pmesh);
+
+  auto compare = [&]()
+  {
+    for (vertex_descriptor v : vertices(pmesh)) {
+      assert(std::abs(get(mean_curvature_map, v) - get(ref_mean_curvature_map, v)) < ABS_ERROR);
+      assert(std::abs(get(gaussian_curvature_map, v) - get(ref_gaussian_curvature_map, v)) < ABS_ERROR);
+      assert(same_curvatures(get(principal_curvatures_and_directions_map, v),
+                             get(ref_principal_curvatures_and_directions_map, v)));
+    }
+  };
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(ref_mean_curvature_map)
+    .vertex_Gaussian_curvature_map(ref_gaussian_curvature_map)
+    .vertex_principal_curvatures_and_directions_map(ref_principal_curvatures_and_directions_map)
+  );
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(mean_curvature_map)
+    .vertex_Gaussian_curvature_map(gaussian_curvature_map)
+    .vertex_principal_curvatures_and_directions_map(principal_curvatures_and_directions_map)
+    .concurrency_tag(CGAL::Parallel_if_available_tag())
+  );
+
+  compare();
+
+  // move a few vertices, and update the curvatures around them,
+  // with the average edge length of the initial computation
+  const Epic_kernel::FT avg_edge_length = PMP::average_edge_length(pmesh);
+  auto vpm = get(CGAL::vertex_point, pmesh);
+  std::unordered_set<face_descriptor> changed_faces;
+  std::size_t i = 0;
+  for (vertex_descriptor v : vertices(pmesh)) {
+    if (i++ % 100 != 0)
+      continue;
+    const Epic_kernel::Point_3 p = get(vpm, v);
+    put(vpm, v, Epic_kernel::Point_3(1.05 * p.x(), 1.05 * p.y(), 1.05 * p.z()));
+    for (face_descriptor f : faces_around_target(halfedge(v, pmesh), pmesh))
+      if (f != boost::graph_traits<PolygonMesh>::null_face())
+        changed_faces.insert(f);
+  }
+
+  std::vector<vertex_descriptor> updated;
+  PMP::update_interpolated_corrected_curvatures(
+    changed_faces,
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(mean_curvature_map)
+    .vertex_Gaussian_curvature_map(gaussian_curvature_map)
+    .vertex_principal_curvatures_and_directions_map(principal_curvatures_and_directions_map)
+    .average_edge_length(avg_edge_length)
+    .vertex_output_iterator(std::back_inserter(updated))
+  );
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(ref_mean_curvature_map)
+    .vertex_Gaussian_curvature_map(ref_gaussian_curvature_map)
+    .vertex_principal_curvatures_and_directions_map(ref_principal_curvatures_and_directions_map)
+    .average_edge_length(avg_edge_length)
+  );
+
+  compare();
+  assert(!updated.empty() && updated.size() < vertices(pmesh).size());
+
+  std::cout << mesh_path << " (radius " << expansion_radius << "): " << updated.size() << " of "
+            << vertices(pmesh).size() << " vertices updated" << std::endl;
+}
+
 int main()
 {
   // testing on a simple sphere(r = 0.5), on both Polyhedron & SurfaceMesh:
@@ -228,4 +346,12 @@ int main()
 
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0), false, 6);
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0.5), false, 6);
+
+  // parallel computation and update after a local modification
+  test_parallel_and_update_curvatures<Polyhedron>("meshes/sphere966.off", -1);
+  test_parallel_and_update_curvatures<SMesh>("meshes/sphere966.off", -1);
+  test_parallel_and_update_curvatures<SMesh>("meshes/sphere966.off", 0);
+  test_parallel_and_update_curvatures<Polyhedron>("meshes/sphere966.off", 2);
+  test_parallel_and_update_curvatures<SMesh>("meshes/sphere966.off", 2);
+  test_parallel_and_update_curvatures<SMesh>("meshes/cylinder.off", 0.5);
 }
@@ -0,0 +1,213 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/triangulate_hole.h>
+#include <CGAL/Polygon_mesh_processing/border.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/boost/graph/Euler_operations.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   K;
+typedef CGAL::Surface_mesh<K::Point_3>                        Mesh;
+typedef boost::graph_traits<Mesh>::halfedge_descriptor        halfedge_descriptor;
+typedef boost::graph_traits<Mesh>::face_descriptor            face_descriptor;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+// the patches are added in the same order: the meshes must be identical
+bool same_meshes(const Mesh& m1, const Mesh& m2)
+{
+  if(num_vertices(m1) != num_vertices(m2) || num_faces(m1) != num_faces(m2))
+    return false;
+
+  for(face_descriptor f : faces(m1))
+  {
+    halfedge_descriptor h1 = halfedge(f, m1), h2 = halfedge(f, m2);
+    for(int i=0; i<3; ++i)
+    {
+      if(target(h1, m1) != target(h2, m2))
+        return false;
+      h1 = next(h1, m1);
+      h2 = next(h2, m2);
+    }
+  }
+  return true;
+}
+
+// the patches are added in a different order: the meshes must have the same triangles
+bool same_triangles(const Mesh& m1, const Mesh& m2)
+{
+  auto triangles = [](const Mesh& m)
+  {
+    std::vector<std::array<std::size_t, 3> > triangles;
+    for(face_descriptor f : faces(m))
+    {
+      halfedge_descriptor h = halfedge(f, m);
+      std::array<std::size_t, 3> t = { std::size_t(target(h, m)), std::size_t(target(next(h, m), m)),
+                                       std::size_t(source(h, m)) };
+      std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+      triangles.push_back(t);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  };
+
+  return num_vertices(m1) == num_vertices(m2) && triangles(m1) == triangles(m2);
+}
+
+template <class NamedParameters>
+void test_triangulate_holes(const Mesh& input, const NamedParameters& np)
+{
+  std::vector<halfedge_descriptor> border_cycles;
+  PMP::extract_boundary_cycles(input, std::back_inserter(border_cycles));
+
+  // one hole after the other
+  Mesh reference = input;
+  std::size_t nb_reference_faces = 0;
+  for(halfedge_descriptor h : border_cycles)
+  {
+    std::vector<face_descriptor> patch;
+    PMP::triangulate_hole(reference, h, np.face_output_iterator(std::back_inserter(patch)));
+    nb_reference_faces += patch.size();
+  }
+
+  Mesh sequential = input;
+  std::vector<face_descriptor> patch;
+  PMP::triangulate_holes(sequential, border_cycles, np.face_output_iterator(std::back_inserter(patch)));
+  assert(patch.size() == nb_reference_faces);
+  assert(same_meshes(reference, sequential));
+
+  Mesh parallel = input;
+  PMP::triangulate_holes(parallel, border_cycles, np.concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(same_meshes(reference, parallel));
+
+  std::cout << "  " << border_cycles.size() << " holes filled with " << nb_reference_faces << " faces" << std::endl;
+}
+
+void test_dependent_holes(const Mesh& input)
+{
+  // remove the faces around some vertices: the holes of neighboring vertices share vertices
+  Mesh mesh = input;
+  std::vector<face_descriptor> to_remove;
+  for(face_descriptor f : faces(mesh))
+    if(target(halfedge(f, mesh), mesh).idx() % 40 == 0)
+      to_remove.push_back(f);
+  for(face_descriptor f : to_remove)
+    CGAL::Euler::remove_face(halfedge(f, mesh), mesh);
+  mesh.collect_garbage();
+
+  std::vector<halfedge_descriptor> border_cycles;
+  PMP::extract_boundary_cycles(mesh, std::back_inserter(border_cycles));
+
+  // one hole after the other, skipping the holes closed by a previous one
+  Mesh reference = mesh;
+  for(halfedge_descriptor h : border_cycles)
+    if(is_border(h, reference))
+      PMP::triangulate_hole(reference, h);
+
+  Mesh sequential = mesh, parallel = mesh;
+  PMP::triangulate_holes(sequential, border_cycles);
+  PMP::triangulate_holes(parallel, border_cycles, CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(CGAL::is_valid_polygon_mesh(sequential));
+  assert(is_closed(sequential));
+  assert(same_triangles(reference, sequential));
+  assert(same_meshes(sequential, parallel));
+
+  std::cout << "  " << border_cycles.size() << " holes sharing vertices filled" << std::endl;
+}
+
+void test_large_hole()
+{
+  // a cone whose base is a large non-planar hole, filled with the cubic algorithm
+  const int n = 200;
+  Mesh mesh;
+  boost::graph_traits<Mesh>::vertex_descriptor apex = mesh.add_vertex(K::Point_3(0, 0, 2));
+  std::vector<boost::graph_traits<Mesh>::vertex_descriptor> base;
+  for(int i=0; i<n; ++i)
+  {
+    const double a = 2 * CGAL_PI * i / n;
+    base.push_back(mesh.add_vertex(K::Point_3(std::cos(a), std::sin(a), 0.3 * std::sin(3 * a))));
+  }
+  for(int i=0; i<n; ++i)
+    mesh.add_face(apex, base[i], base[(i+1)%n]);
+
+  halfedge_descriptor h = opposite(halfedge(base[1], base[0], mesh).first, mesh);
+  if(!is_border(h, mesh))
+    h = opposite(h, mesh);
+
+  Mesh sequential = mesh, parallel = mesh;
+  std::vector<face_descriptor> patch;
+  PMP::triangulate_hole(sequential, h, CGAL::parameters::use_delaunay_triangulation(false)
+                                                        .face_output_iterator(std::back_inserter(patch)));
+  PMP::triangulate_hole(parallel, h, CGAL::parameters::use_delaunay_triangulation(false)
+                                                      .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(patch.size() == n - 2);
+  assert(is_closed(sequential));
+  assert(same_meshes(sequential, parallel));
+
+  std::cout << "  hole with " << n << " vertices filled" << std::endl;
+}
+
+#ifdef CGAL_EIGEN3_ENABLED
+void test_triangulate_refine_and_fair_holes(const Mesh& input)
+{
+  std::vector<halfedge_descriptor> border_cycles;
+  PMP::extract_boundary_cycles(input, std::back_inserter(border_cycles));
+
+  Mesh sequential = input, parallel = input;
+  std::vector<face_descriptor> faces;
+  std::vector<boost::graph_traits<Mesh>::vertex_descriptor> vertices;
+  bool success = std::get<0>(PMP::triangulate_refine_and_fair_holes(sequential, border_cycles,
+                                                                    CGAL::parameters::face_output_iterator(std::back_inserter(faces))
+                                                                                     .vertex_output_iterator(std::back_inserter(vertices))));
+  assert(success);
+  assert(is_closed(sequential));
+
+  success = std::get<0>(PMP::triangulate_refine_and_fair_holes(parallel, border_cycles,
+                                                               CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag())));
+  assert(success);
+  assert(same_meshes(sequential, parallel));
+
+  std::cout << "  " << border_cycles.size() << " holes filled, refined and faired with "
+            << faces.size() << " faces and " << vertices.size() << " new vertices" << std::endl;
+}
+#endif
+
+int main()
+{
+  Mesh shark, elephant;
+  if(!PMP::IO::read_polygon_mesh(CGAL::data_file_path("meshes/mech-holes-shark.off"), shark) ||
+     !PMP::IO::read_polygon_mesh(CGAL::data_file_path("meshes/elephant.off"), elephant))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return 1;
+  }
+
+  std::cout << "mech-holes-shark" << std::endl;
+  test_triangulate_holes(shark, CGAL::parameters::default_values());
+  test_triangulate_holes(shark, CGAL::parameters::use_2d_constrained_delaunay_triangulation(true));
+  test_triangulate_holes(shark, CGAL::parameters::use_delaunay_triangulation(false));
+
+  std::cout << "elephant" << std::endl;
+  test_dependent_holes(elephant);
+
+  std::cout << "cone" << std::endl;
+  test_large_hole();
+
+#ifdef CGAL_EIGEN3_ENABLED
+  std::cout << "mech-holes-shark, refine and fair" << std::endl;
+  test_triangulate_refine_and_fair_holes(shark);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
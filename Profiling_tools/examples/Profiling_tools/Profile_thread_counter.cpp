@@ -0,0 +1,21 @@
+#include <CGAL/Profile_counter.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/parallel_for.h>
+#endif
+
+int main()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  static CGAL::Profile_thread_counter iterations("[iterations of the parallel loop]");
+  tbb::parallel_for(0, 1000, [](int)
+  {
+    ++iterations;
+  });
+#else
+  static CGAL::Profile_thread_counter iterations("[iterations of the loop]");
+  for (int i=0; i<1000; ++i)
+    ++iterations;
+#endif
+  return 0;
+}
@@ -24,6 +24,18 @@
 //   a value (unsigned int), and the final dump is the histogram of the non-zero
 //   counters.
 //
+// - Profile_thread_counter which is similar to Profile_counter, but keeps
+//   one number per thread, and the final dump gives the number of each thread
+//   and the total.
+//
+// - Profile_thread_histogram_counter which is similar to Profile_histogram_counter,
+//   but keeps one histogram per thread, so that concurrent updates do not contend;
+//   the final dump gives the histogram of each thread, and the merged histogram.
+//
+//   These two counters have no macro: they are meant to be declared as static
+//   variables under the switch of the package that uses them (see for example
+//   CGAL_CONCURRENT_TRIANGULATION_3_PROFILING in Triangulation_3.h).
+//
 // - Profile_branch_counter which keeps track of 2 counters, aiming at measuring
 //   the ratio corresponding to the number of times a branch is taken.
 //
@@ -49,6 +61,7 @@
 #include <string>
 #include <map>
 #include <atomic>
+#include <mutex>
 
 #include <CGAL/disable_warnings.h>
 
@@ -66,6 +79,7 @@
 
 #ifdef CGAL_CONCURRENT_PROFILE
 # include "tbb/concurrent_hash_map.h"
+# include "tbb/enumerable_thread_specific.h"
 #endif
 
 namespace CGAL {
@@ -163,6 +177,114 @@ private:
 };
 
 
+struct Profile_thread_counter
+{
+    Profile_thread_counter(const std::string & ss)
+      : s(ss)
+#ifndef CGAL_CONCURRENT_PROFILE
+      , i(0)
+#endif
+    {}
+
+#ifdef CGAL_CONCURRENT_PROFILE
+    void operator++() { ++counters.local(); }
+#else
+    void operator++() { ++i; }
+#endif
+
+    ~Profile_thread_counter()
+    {
+        unsigned total=0;
+#ifdef CGAL_CONCURRENT_PROFILE
+        int thread=0;
+        for (CounterMap::const_iterator it=counters.begin(), end=counters.end();
+             it != end; ++it, ++thread) {
+            std::cerr << "[CGAL::Profile_thread_counter] " << s;
+            std::cerr << " [ thread " << std::setw(3) << thread << " : "
+                      << std::setw(10) << internal::dot_it(*it) << " ]"
+                      << std::endl;
+            total += *it;
+        }
+#else
+        total = i;
+#endif
+        std::cerr << "[CGAL::Profile_thread_counter] " << s;
+        std::cerr << " [ " << std::setw(10) << "Total" << " : "
+                           << std::setw(10) << internal::dot_it(total) << " ]" << std::endl;
+    }
+
+private:
+    const std::string s;
+#ifdef CGAL_CONCURRENT_PROFILE
+    typedef tbb::enumerable_thread_specific<unsigned>  CounterMap;
+    CounterMap  counters{0u};
+#else
+    std::atomic<unsigned int> i;
+#endif
+};
+
+
+struct Profile_thread_histogram_counter
+{
+private:
+    typedef std::map<unsigned, unsigned>  Histogram;
+
+public:
+    Profile_thread_histogram_counter(const std::string & ss)
+      : s(ss) {}
+
+    void operator()(unsigned i)
+    {
+#ifdef CGAL_CONCURRENT_PROFILE
+      ++histograms.local()[i];
+#else
+      std::lock_guard<std::mutex> lock(mutex);
+      ++histogram[i];
+#endif
+    }
+
+    ~Profile_thread_histogram_counter()
+    {
+#ifdef CGAL_CONCURRENT_PROFILE
+        Histogram histogram;
+        int thread=0;
+        for (const Histogram& h : histograms) {
+          for (Histogram::const_iterator it=h.begin(), end=h.end(); it != end; ++it) {
+            std::cerr << "[CGAL::Profile_thread_histogram_counter] " << s;
+            std::cerr << " [ thread " << std::setw(3) << thread << " : "
+                      << std::setw(10) << internal::dot_it(it->first) << " : "
+                      << std::setw(10) << internal::dot_it(it->second) << " ]"
+                      << std::endl;
+            histogram[it->first] += it->second;
+          }
+          ++thread;
+        }
+#endif
+        unsigned total=0;
+        for (Histogram::const_iterator it=histogram.begin(), end=histogram.end();
+             it != end; ++it) {
+            std::cerr << "[CGAL::Profile_thread_histogram_counter] " << s;
+            std::cerr << " [ " << std::setw(10) << internal::dot_it(it->first) << " : "
+                      << std::setw(10) << internal::dot_it(it->second) << " ]"
+                               << std::endl;
+            total += it->second;
+        }
+        std::cerr << "[CGAL::Profile_thread_histogram_counter] " << s;
+        std::cerr << " [ " << std::setw(10) << "Total" << " : "
+                           << std::setw(10) << total << " ]" << std::endl;
+    }
+
+private:
+#ifdef CGAL_CONCURRENT_PROFILE
+    tbb::enumerable_thread_specific<Histogram>  histograms;
+#else
+    Histogram  histogram;
+    std::mutex  mutex;
+#endif
+    const std::string s;
+};
+
+
 struct Profile_branch_counter
 {
     Profile_branch_counter(const std::string & ss)
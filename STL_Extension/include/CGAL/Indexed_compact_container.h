@@ -0,0 +1,551 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Sylvain Pion
+
+#ifndef CGAL_INDEXED_COMPACT_CONTAINER_H
+#define CGAL_INDEXED_COMPACT_CONTAINER_H
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/config.h>
+#include <CGAL/Default.h>
+#include <CGAL/Compact_container.h>
+#include <CGAL/Time_stamper.h>
+#include <CGAL/assertions.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// A container similar to Compact_container, whose elements also have
+// a 32-bit index, so that they can refer to each other with indices
+// instead of pointers:
+// - the elements are allocated in blocks of 2^log2_block_size bytes, which
+//   are aligned on their size. A block starts with a header giving the
+//   container and the number of the block, so that the index of an element,
+//   and the element of a given index, are obtained in constant time from the
+//   address of any element of the container.
+// - as in Compact_container, the first and last elements of a block are
+//   used to link the blocks together, and each element stores 2 bits of
+//   information for the container, here in a 32-bit word accessed through a
+//   traits class. The 30 other bits of this word are free for the element
+//   while it is used, and store the index of the next free element, or the
+//   number of the next block, otherwise.
+// - the iterators are the ones of Compact_container.
+// - a container can be associated to another one, so that the elements of
+//   the first one can also reach the elements of the second one from their
+//   indices (e.g. the cells and the vertices of a triangulation).
+//
+// As the indices are stored on 30 bits, the container can hold at most
+// 2^30 - 1 elements: the largest index is kept to encode a null index.
+//
+// The elements are stored whole, one after the other, as in Compact_container:
+// the data members of the elements are not split in separate arrays.
+
+namespace CGAL {
+
+// The traits class describes the way to access the 32-bit word of an element.
+// The element must leave the 2 least significant bits of this word to 0.
+// It can be specialized.
+template < class T >
+struct Indexed_compact_container_traits {
+  static std::uint32_t word(const T &t)             { return t.for_indexed_compact_container(); }
+  static void set_word(T &t, std::uint32_t w)       { t.for_indexed_compact_container(w); }
+};
+
+template < class T, unsigned int log2_block_size = 14, class TimeStamper_ = Default >
+class Indexed_compact_container
+{
+  typedef Indexed_compact_container<T, log2_block_size, TimeStamper_> Self;
+  typedef Indexed_compact_container_traits<T>                          Traits;
+
+  template <typename U> using EraseCounterStrategy =
+      internal::Erase_counter_strategy<internal::has_increment_erase_counter<U>::value>;
+
+  template <class T2, unsigned int l2, class Ts2>
+  friend class Indexed_compact_container;
+
+public:
+  typedef typename Default::Get< TimeStamper_,
+                                 CGAL::Time_stamper_impl<T> >::type
+                                                    Time_stamper;
+  typedef Default                                   Al;
+
+  typedef T                                         value_type;
+  typedef value_type&                               reference;
+  typedef const value_type&                         const_reference;
+  typedef value_type*                               pointer;
+  typedef const value_type*                         const_pointer;
+  typedef std::size_t                               size_type;
+  typedef std::ptrdiff_t                            difference_type;
+
+  typedef internal::CC_iterator<Self, false>        iterator;
+  typedef internal::CC_iterator<Self, true>         const_iterator;
+
+  friend class internal::CC_iterator<Self, false>;
+  friend class internal::CC_iterator<Self, true>;
+
+  // The index of a null element.
+  static constexpr std::uint32_t null_index = (std::uint32_t(1) << 30) - 1;
+
+private:
+  struct State;
+
+  struct Block_header
+  {
+    State*    state;
+    size_type number;
+  };
+
+  static constexpr std::size_t block_bytes = std::size_t(1) << log2_block_size;
+
+  // These are functions, as `T` can be incomplete when the container is instantiated.
+  static constexpr std::size_t first_offset()
+  {
+    return (sizeof(Block_header) + alignof(T) - 1) / alignof(T) * alignof(T);
+  }
+
+public:
+  // The number of elements of a block, without the two boundary elements.
+  static constexpr size_type block_size()
+  {
+    static_assert(alignof(T) <= block_bytes && (block_bytes - first_offset()) / sizeof(T) >= 3,
+                  "The blocks of Indexed_compact_container are too small for this type");
+    return (block_bytes - first_offset()) / sizeof(T) - 2;
+  }
+
+  Indexed_compact_container()
+    : m_state(new State())
+  {}
+
+  // The indices of the elements depend on the order in which they are created
+  // and erased, and cannot be preserved by a copy.
+  Indexed_compact_container(const Indexed_compact_container&) = delete;
+  Indexed_compact_container& operator=(const Indexed_compact_container&) = delete;
+
+  // The moved-from container is empty, and is not associated to another container.
+  // It gets a new state, whose allocation is not expected to fail.
+  Indexed_compact_container(Indexed_compact_container&& c) noexcept
+    : m_state(new State())
+  {
+    swap(c);
+  }
+
+  Indexed_compact_container& operator=(Indexed_compact_container&& c) noexcept
+  {
+    Self tmp(std::move(c));
+    tmp.swap(*this);
+    return *this;
+  }
+
+  ~Indexed_compact_container()
+  {
+    clear();
+  }
+
+  void swap(Self& c) noexcept
+  {
+    m_state.swap(c.m_state);
+  }
+
+  friend void swap(Self& a, Self& b) noexcept { a.swap(b); }
+
+  iterator begin()
+  {
+    return empty() ? end() : iterator(first_used());
+  }
+  iterator end() { return iterator(m_state->last_item); }
+
+  const_iterator begin() const
+  {
+    return empty() ? end() : const_iterator(first_used());
+  }
+  const_iterator end() const { return const_iterator(m_state->last_item); }
+
+  template < typename... Args >
+  iterator emplace(Args&&... args)
+  {
+    State& s = *m_state;
+    if(s.free_list == nullptr)
+      allocate_new_block();
+
+    pointer ret = s.free_list;
+    s.free_list = clean_pointee(ret);
+    new (ret) value_type(std::forward<Args>(args)...);
+    CGAL_assertion_msg(type(ret) == USED,
+                       "The two least significant bits of the word of an element must be 0");
+    set_time_stamp(ret, index(ret));
+    ++s.size;
+    return iterator(ret);
+  }
+
+  iterator insert(const T& t)
+  {
+    return emplace(t);
+  }
+
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last)
+  {
+    for(; first != last; ++first)
+      insert(*first);
+  }
+
+  void erase(iterator x)
+  {
+    pointer ptr = &*x;
+    CGAL_precondition(type(ptr) == USED);
+    EraseCounterStrategy<T>::increment_erase_counter(*x);
+    ptr->~T();
+    put_on_free_list(ptr);
+    --m_state->size;
+  }
+
+  void erase(iterator first, iterator last)
+  {
+    while(first != last)
+      erase(first++);
+  }
+
+  // Destroys the elements and frees the memory, but keeps the association.
+  void clear();
+
+  size_type size() const { return m_state->size; }
+  size_type capacity() const { return m_state->blocks.size() * block_size(); }
+  bool empty() const { return m_state->size == 0; }
+  static size_type max_size() { return null_index; }
+
+  void reserve(size_type n)
+  {
+    // The elements are put on the free list block after block, so that
+    // they are used in the iterator order.
+    std::vector<pointer> new_blocks;
+    while(capacity() + new_blocks.size() * block_size() < n)
+      new_blocks.push_back(push_back_new_block());
+    for(typename std::vector<pointer>::reverse_iterator it = new_blocks.rbegin();
+        it != new_blocks.rend(); ++it)
+      put_block_on_free_list(*it);
+  }
+
+  bool is_used(const_iterator ptr) const
+  {
+    return type(&*ptr) == USED;
+  }
+
+  bool is_used(size_type i) const
+  {
+    return type(element(m_state.get(), i)) == USED;
+  }
+
+  // Returns the element of index `i`, in constant time.
+  reference operator[](size_type i)
+  {
+    CGAL_precondition(is_used(i));
+    return *element(m_state.get(), i);
+  }
+
+  const_reference operator[](size_type i) const
+  {
+    CGAL_precondition(is_used(i));
+    return *element(m_state.get(), i);
+  }
+
+  // Returns the index of the element pointed by `cit`, in constant time.
+  static size_type index(const_iterator cit)
+  {
+    return index(&*cit);
+  }
+
+  // Returns the element of index `i` of the container of the element `x`.
+  static iterator element(const_iterator x, size_type i)
+  {
+    return iterator(element(header(&*x)->state, i));
+  }
+
+  // Associates `c` to this container: the elements of this container can
+  // reach the ones of `c`, with `associated_element()`. The association
+  // is kept by `swap()`.
+  template <class C>
+  void set_associated_container(C& c)
+  {
+    m_state->associated = c.m_state.get();
+  }
+
+  // Returns the element of index `i` of the container of type `C`
+  // associated to the container of the element `x`.
+  template <class C>
+  static typename C::iterator associated_element(const_iterator x, size_type i)
+  {
+    const void* associated = header(&*x)->state->associated;
+    CGAL_precondition(associated != nullptr);
+    return typename C::iterator(
+      C::element(static_cast<typename C::State*>(const_cast<void*>(associated)), i));
+  }
+
+  // The three functions below are the ones above for the element which
+  // contains the object at address `m`, e.g. one of its data members.
+  // They are used by the objects that store the indices of an element
+  // without being a base class of it.
+  static size_type index_of_member(const void* m)
+  {
+    const Block_header* h = header(static_cast<const_pointer>(m));
+    const char* first = reinterpret_cast<const char*>(block_begin(h) + 1);
+    return h->number * block_size() +
+           static_cast<size_type>((static_cast<const char*>(m) - first) / sizeof(T));
+  }
+
+  static iterator element_of_member(const void* m, size_type i)
+  {
+    return iterator(element(header(static_cast<const_pointer>(m))->state, i));
+  }
+
+  template <class C>
+  static typename C::iterator associated_element_of_member(const void* m, size_type i)
+  {
+    const void* associated = header(static_cast<const_pointer>(m))->state->associated;
+    CGAL_precondition(associated != nullptr);
+    return typename C::iterator(
+      C::element(static_cast<typename C::State*>(const_cast<void*>(associated)), i));
+  }
+
+  // Returns whether `cit` is in the range [begin(), end()].
+  // Complexity : O(#blocks).
+  bool owns(const_iterator cit) const
+  {
+    if(cit == end())
+      return true;
+
+    const char* c = reinterpret_cast<const char*>(&*cit);
+    for(const Block_header* h : m_state->blocks)
+    {
+      const_pointer first = block_begin(h) + 1;
+      if(c < reinterpret_cast<const char*>(first) ||
+         c >= reinterpret_cast<const char*>(first + block_size()))
+        continue;
+      return (c - reinterpret_cast<const char*>(first)) % sizeof(T) == 0 &&
+             type(&*cit) == USED;
+    }
+    return false;
+  }
+
+  bool owns_dereferenceable(const_iterator cit) const
+  {
+    return cit != end() && owns(cit);
+  }
+
+private:
+  struct State
+  {
+    std::vector<Block_header*> blocks;
+    // The blocks are carved out of chunks of consecutive blocks, as the
+    // allocator can waste up to the alignment for each aligned allocation.
+    std::vector<char*> chunks;
+    char*       chunk_next = nullptr;
+    char*       chunk_end = nullptr;
+    size_type   size = 0;
+    pointer     free_list = nullptr;
+    pointer     last_item = nullptr;
+    const void* associated = nullptr;
+  };
+
+  // The 2 least significant bits of the word of an element:
+  //                 upper 30 bits of the word
+  // USED            free for the element
+  // BLOCK_BOUNDARY  number of the previous/next block
+  // FREE            index of the next free element, or null_index
+  // START_END       unused
+  enum Type { USED = 0, BLOCK_BOUNDARY = 1, FREE = 2, START_END = 3 };
+
+  static Block_header* header(const_pointer p)
+  {
+    return reinterpret_cast<Block_header*>(
+      reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t(block_bytes - 1));
+  }
+
+  // The first boundary element of the block.
+  static pointer block_begin(const Block_header* h)
+  {
+    return reinterpret_cast<pointer>(
+      const_cast<char*>(reinterpret_cast<const char*>(h)) + first_offset());
+  }
+
+  static size_type index(const_pointer p)
+  {
+    const Block_header* h = header(p);
+    return h->number * block_size() + static_cast<size_type>(p - block_begin(h) - 1);
+  }
+
+  static pointer element(const State* s, size_type i)
+  {
+    CGAL_precondition(i < s->blocks.size() * block_size());
+    return block_begin(s->blocks[i / block_size()]) + 1 + i % block_size();
+  }
+
+  static Type type(const_pointer ptr)
+  {
+    return Type(Traits::word(*ptr) & 3);
+  }
+
+  static std::uint32_t payload(const_pointer ptr)
+  {
+    return Traits::word(*ptr) >> 2;
+  }
+
+  static void set_type(pointer ptr, std::uint32_t payload, Type t)
+  {
+    Traits::set_word(*ptr, (payload << 2) | std::uint32_t(t));
+  }
+
+  // For the iterators: the next free element, or the boundary element
+  // of the adjacent block.
+  static pointer clean_pointee(const_pointer ptr)
+  {
+    const std::uint32_t p = payload(ptr);
+    if(type(ptr) == BLOCK_BOUNDARY)
+    {
+      const Block_header* h = header(ptr);
+      pointer other = block_begin(h->state->blocks[p]);
+      return (ptr == block_begin(h)) ? other + block_size() + 1 : other;
+    }
+    return (p == null_index) ? nullptr : element(header(ptr)->state, p);
+  }
+
+  static void set_time_stamp(pointer ptr, size_type i)
+  {
+    if constexpr (Time_stamper::has_timestamp)
+      Time_stamper::restore_timestamp(ptr, i);
+    else
+      CGAL_USE(i);
+  }
+
+  pointer first_used() const
+  {
+    pointer p = block_begin(m_state->blocks.front()) + 1;
+    return (type(p) == USED) ? p : &*(++iterator(p));
+  }
+
+  void put_on_free_list(pointer x)
+  {
+    State& s = *m_state;
+    set_type(x, s.free_list == nullptr ? null_index : std::uint32_t(index(s.free_list)), FREE);
+    s.free_list = x;
+  }
+
+  // Returns the first boundary element of the new block.
+  pointer push_back_new_block();
+  void put_block_on_free_list(pointer first);
+
+  void allocate_new_block()
+  {
+    put_block_on_free_list(push_back_new_block());
+  }
+
+  std::unique_ptr<State> m_state;
+};
+
+template < class T, unsigned int log2_block_size, class TimeStamper >
+void Indexed_compact_container<T, log2_block_size, TimeStamper>::clear()
+{
+  State& s = *m_state;
+  for(Block_header* h : s.blocks)
+  {
+    pointer first = block_begin(h);
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+      for(pointer p = first + 1; p != first + block_size() + 1; ++p)
+        if(type(p) == USED)
+          p->~T();
+    }
+    h->~Block_header();
+  }
+  for(char* chunk : s.chunks)
+    ::operator delete(static_cast<void*>(chunk), std::align_val_t(block_bytes));
+  s.blocks.clear();
+  s.chunks.clear();
+  s.chunk_next = s.chunk_end = nullptr;
+  s.size = 0;
+  s.free_list = nullptr;
+  s.last_item = nullptr;
+}
+
+template < class T, unsigned int log2_block_size, class TimeStamper >
+auto Indexed_compact_container<T, log2_block_size, TimeStamper>::push_back_new_block()
+  -> pointer
+{
+  State& s = *m_state;
+  const size_type number = s.blocks.size();
+  if(capacity() + block_size() > max_size())
+    throw std::length_error("Indexed_compact_container: too many elements");
+
+  if(s.chunk_next == s.chunk_end)
+  {
+    // The chunks double in size, up to 256 blocks.
+    const size_type n = (std::min)((std::max)(number, size_type(1)), size_type(256));
+    s.chunks.reserve(s.chunks.size() + 1);
+    s.chunk_next = static_cast<char*>(::operator new(n * block_bytes, std::align_val_t(block_bytes)));
+    s.chunk_end = s.chunk_next + n * block_bytes;
+    s.chunks.push_back(s.chunk_next);
+  }
+
+  void* mem = s.chunk_next;
+  s.chunk_next += block_bytes;
+  Block_header* h = new (mem) Block_header{&s, number};
+  s.blocks.push_back(h);
+
+  pointer first = block_begin(h);
+  if(s.last_item == nullptr) // First time
+  {
+    set_type(first, 0, START_END);
+  }
+  else
+  {
+    set_type(s.last_item, std::uint32_t(number), BLOCK_BOUNDARY);
+    set_type(first, std::uint32_t(number - 1), BLOCK_BOUNDARY);
+  }
+  s.last_item = first + block_size() + 1;
+  set_type(s.last_item, 0, START_END);
+  return first;
+}
+
+template < class T, unsigned int log2_block_size, class TimeStamper >
+void Indexed_compact_container<T, log2_block_size, TimeStamper>::
+put_block_on_free_list(pointer first)
+{
+  // In reverse order, so that the insertion order
+  // corresponds to the iterator order.
+  for(size_type i = block_size(); i >= 1; --i)
+  {
+    EraseCounterStrategy<T>::set_erase_counter(*(first + i), 0);
+    put_on_free_list(first + i);
+  }
+}
+
+namespace internal {
+
+template <class Container>
+struct Is_indexed_compact_container : public std::false_type {};
+
+template < class T, unsigned int log2_block_size, class TimeStamper >
+struct Is_indexed_compact_container<
+  Indexed_compact_container<T, log2_block_size, TimeStamper> > : public std::true_type {};
+
+} // namespace internal
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_INDEXED_COMPACT_CONTAINER_H
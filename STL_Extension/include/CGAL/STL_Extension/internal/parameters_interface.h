@@ -101,6 +101,7 @@ CGAL_add_named_parameter(vertex_mean_curvature_t, vertex_mean_curvature, vertex_
 CGAL_add_named_parameter(vertex_Gaussian_curvature_t, vertex_Gaussian_curvature, vertex_Gaussian_curvature)
 CGAL_add_named_parameter(vertex_principal_curvatures_and_directions_t, vertex_principal_curvatures_and_directions, vertex_principal_curvatures_and_directions)
 CGAL_add_named_parameter(ball_radius_t, ball_radius, ball_radius)
+CGAL_add_named_parameter(average_edge_length_t, average_edge_length, average_edge_length)
 CGAL_add_named_parameter(outward_orientation_t, outward_orientation, outward_orientation)
 CGAL_add_named_parameter(overlap_test_t, overlap_test, do_overlap_test_of_bounded_sides)
 CGAL_add_named_parameter(preserve_genus_t, preserve_genus, preserve_genus)
@@ -192,6 +193,7 @@ CGAL_add_named_parameter(callback_t, callback, callback)
 CGAL_add_named_parameter(sharpness_angle_t, sharpness_angle, sharpness_angle)
 CGAL_add_named_parameter(edge_sensitivity_t, edge_sensitivity, edge_sensitivity)
 CGAL_add_named_parameter(neighbor_radius_t, neighbor_radius, neighbor_radius)
+CGAL_add_named_parameter(neighbor_graph_t, neighbor_graph, neighbor_graph)
 CGAL_add_named_parameter(number_of_output_points_t, number_of_output_points, number_of_output_points)
 CGAL_add_named_parameter(size_t, size, size)
 CGAL_add_named_parameter(maximum_variation_t, maximum_variation, maximum_variation)
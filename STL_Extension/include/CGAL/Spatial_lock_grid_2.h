@@ -0,0 +1,54 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Clement Jamin
+
+#ifndef CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
+#define CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
+
+#include <CGAL/Spatial_lock_grid_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <CGAL/Bbox_2.h>
+
+namespace CGAL {
+
+//*****************************************************************************
+// class Spatial_lock_grid_2
+// The 2D counterpart of Spatial_lock_grid_3, which shares its implementation.
+//*****************************************************************************
+template <typename Grid_lock_tag = Tag_priority_blocking>
+class Spatial_lock_grid_2
+  : public internal::Spatial_lock_grid<Grid_lock_tag, 2>
+{
+  typedef internal::Spatial_lock_grid<Grid_lock_tag, 2> Base;
+
+public:
+  Spatial_lock_grid_2(const Bbox_2 &bbox, int num_grid_cells_per_axis)
+    : Base(bbox, num_grid_cells_per_axis)
+  {}
+};
+
+} //namespace CGAL
+
+#else // !CGAL_LINKED_WITH_TBB
+
+namespace CGAL {
+
+template <typename Grid_lock_tag = void>
+class Spatial_lock_grid_2
+{
+};
+
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+#endif // CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
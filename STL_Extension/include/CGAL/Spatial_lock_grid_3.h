@@ -14,13 +14,18 @@
 
 #ifdef CGAL_LINKED_WITH_TBB
 
+#include <CGAL/Bbox_2.h>
 #include <CGAL/Bbox_3.h>
+#include <CGAL/number_utils.h>
 
 #include <atomic>
 #include <thread>
 #include <tbb/enumerable_thread_specific.h>
 
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace CGAL {
@@ -29,50 +34,65 @@ struct Tag_no_lock {};
 struct Tag_non_blocking {};
 struct Tag_priority_blocking {};
 
+namespace internal {
+
 //*****************************************************************************
-// class Spatial_lock_grid_base_3
+// class Spatial_lock_grid_base
 // (Uses Curiously recurring template pattern)
+// The domain is divided into a regular grid of cells, in dimension 2 or 3,
+// and a point is locked by locking its cell.
 //*****************************************************************************
 
-template <typename Derived>
-class Spatial_lock_grid_base_3
+template <typename Derived, int Dimension>
+class Spatial_lock_grid_base
 {
+  static_assert(Dimension == 2 || Dimension == 3,
+                "Spatial_lock_grid is only available in dimension 2 and 3.");
+
+public:
+  typedef std::conditional_t<Dimension == 2, Bbox_2, Bbox_3>  Bbox;
+  typedef std::array<int, Dimension>                          Grid_indices;
+
 private:
-  static bool *init_TLS_grid(int num_cells_per_axis)
+  static bool *init_TLS_grid(int num_cells)
   {
-    int num_cells = num_cells_per_axis*
-      num_cells_per_axis*num_cells_per_axis;
     bool *local_grid = new bool[num_cells];
     for (int i = 0 ; i < num_cells ; ++i)
       local_grid[i] = false;
     return local_grid;
   }
 
+  static int compute_num_cells(int num_cells_per_axis)
+  {
+    int num_cells = 1;
+    for (int i = 0 ; i < Dimension ; ++i)
+      num_cells *= num_cells_per_axis;
+    return num_cells;
+  }
+
 public:
   bool *get_thread_local_grid()
   {
     return m_tls_grids.local();
   }
 
-  void set_bbox(const Bbox_3 &bbox)
+  void set_bbox(const Bbox &bbox)
   {
     // Compute resolutions
     m_bbox = bbox;
     double n = static_cast<double>(m_num_grid_cells_per_axis);
-    m_resolution_x = n / (bbox.xmax() - bbox.xmin());
-    m_resolution_y = n / (bbox.ymax() - bbox.ymin());
-    m_resolution_z = n / (bbox.zmax() - bbox.zmin());
+    for (int i = 0 ; i < Dimension ; ++i)
+      m_resolution[i] = n / ((bbox.max)(i) - (bbox.min)(i));
 
 #ifdef CGAL_CONCURRENT_MESH_3_VERBOSE
-    std::cerr << "Locking data structure Bounding Box = "
-      << "[" << bbox.xmin() << ", " << bbox.xmax() << "], "
-      << "[" << bbox.ymin() << ", " << bbox.ymax() << "], "
-      << "[" << bbox.zmin() << ", " << bbox.zmax() << "]"
-      << std::endl;
+    std::cerr << "Locking data structure Bounding Box = ";
+    for (int i = 0 ; i < Dimension ; ++i)
+      std::cerr << "[" << (bbox.min)(i) << ", " << (bbox.max)(i) << "] ";
+    std::cerr << std::endl;
 #endif
   }
 
-  const Bbox_3 &get_bbox() const
+  const Bbox &get_bbox() const
   {
     return m_bbox;
   }
@@ -82,18 +102,26 @@ public:
     return get_thread_local_grid()[cell_index];
   }
 
-  template <typename P3>
-  bool is_locked(const P3 &point)
+  template <typename P>
+  bool is_locked(const P &point)
   {
     return is_cell_locked(get_grid_index(point));
   }
 
-  template <typename P3>
-  bool is_locked_by_this_thread(const P3 &point)
+  template <typename P>
+  bool is_locked_by_this_thread(const P &point)
   {
     return get_thread_local_grid()[get_grid_index(point)];
   }
 
+  // Index of the cell containing `point`, which can be locked with `try_lock(int)`.
+  // P must provide .x(), .y() (and .z() in 3D)
+  template <typename P>
+  int get_grid_index(const P& point) const
+  {
+    return get_cell_index(get_grid_indices(point));
+  }
+
   bool try_lock(int cell_index)
   {
     return try_lock<false>(cell_index);
@@ -107,68 +135,69 @@ public:
   }
 
 
-  bool try_lock(int index_x, int index_y, int index_z, int lock_radius)
+  bool try_lock(const Grid_indices &indices, int lock_radius)
   {
-    return try_lock<false>(index_x, index_y, index_z, lock_radius);
+    return try_lock<false>(indices, lock_radius);
   }
 
   template <bool no_spin>
-  bool try_lock(int index_x, int index_y, int index_z, int lock_radius)
+  bool try_lock(const Grid_indices &indices, int lock_radius)
   {
     if (lock_radius == 0)
+      return try_lock<no_spin>(get_cell_index(indices));
+
+    // We have to lock the square (2D) or the cube (3D)
+    Grid_indices first, last;
+    for (int i = 0 ; i < Dimension ; ++i)
     {
-      int index_to_lock =
-        index_z*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis
-        + index_y*m_num_grid_cells_per_axis
-        + index_x;
-      return try_lock<no_spin>(index_to_lock);
+      first[i] = (std::max)(0, indices[i]-lock_radius);
+      last[i] = (std::min)(m_num_grid_cells_per_axis - 1, indices[i]+lock_radius);
     }
-    else
-    {
-      // We have to lock the square
-      std::vector<int> locked_cells_tmp;
 
-      // For each cell inside the square
-      for (int i = (std::max)(0, index_x-lock_radius) ;
-           i <= (std::min)(m_num_grid_cells_per_axis - 1, index_x+lock_radius) ;
-           ++i)
+    std::vector<int> locked_cells_tmp;
+
+    // For each cell inside the square/cube, the last axis varying fastest
+    Grid_indices cell = first;
+    for(;;)
+    {
+      int index_to_lock = get_cell_index(cell);
+      // Try to lock it
+      if (try_lock<no_spin>(index_to_lock))
       {
-        for (int j = (std::max)(0, index_y-lock_radius) ;
-             j <= (std::min)(m_num_grid_cells_per_axis - 1, index_y+lock_radius) ;
-             ++j)
-        {
-          for (int k = (std::max)(0, index_z-lock_radius) ;
-               k <= (std::min)(m_num_grid_cells_per_axis - 1, index_z+lock_radius) ;
-               ++k)
-          {
-            int index_to_lock =
-              k*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis
-              + j*m_num_grid_cells_per_axis
-              + i;
-            // Try to lock it
-            if (try_lock<no_spin>(index_to_lock))
-            {
-              locked_cells_tmp.push_back(index_to_lock);
-            }
-            else
-            {
-              // failed => we unlock already locked cells and return false
-              std::vector<int>::const_iterator it = locked_cells_tmp.begin();
-              std::vector<int>::const_iterator it_end = locked_cells_tmp.end();
-              for( ; it != it_end ; ++it)
-              {
-                unlock(*it);
-              }
-              return false;
-            }
-          }
-        }
+        locked_cells_tmp.push_back(index_to_lock);
+      }
+      else
+      {
+        // failed => we unlock already locked cells and return false
+        for (int locked_cell : locked_cells_tmp)
+          unlock(locked_cell);
+        return false;
       }
 
-      return true;
+      int axis = Dimension - 1;
+      while (axis >= 0 && cell[axis] == last[axis])
+      {
+        cell[axis] = first[axis];
+        --axis;
+      }
+      if (axis < 0)
+        return true;
+      ++cell[axis];
     }
   }
 
+  template <int D = Dimension, std::enable_if_t<D == 3, int> = 0>
+  bool try_lock(int index_x, int index_y, int index_z, int lock_radius)
+  {
+    return try_lock<false>(Grid_indices{{index_x, index_y, index_z}}, lock_radius);
+  }
+
+  template <bool no_spin, int D = Dimension, std::enable_if_t<D == 3, int> = 0>
+  bool try_lock(int index_x, int index_y, int index_z, int lock_radius)
+  {
+    return try_lock<no_spin>(Grid_indices{{index_x, index_y, index_z}}, lock_radius);
+  }
+
 
   bool try_lock(int cell_index, int lock_radius)
   {
@@ -184,71 +213,28 @@ public:
     }
     else
     {
-      int index_z = cell_index/(m_num_grid_cells_per_axis*m_num_grid_cells_per_axis);
-      cell_index -= index_z*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
-      int index_y = cell_index/m_num_grid_cells_per_axis;
-      cell_index -= index_y*m_num_grid_cells_per_axis;
-      int index_x = cell_index;
-
-      return try_lock<no_spin>(index_x, index_y, index_z, lock_radius);
+      Grid_indices indices;
+      for (int i = 0 ; i < Dimension ; ++i)
+      {
+        indices[i] = cell_index % m_num_grid_cells_per_axis;
+        cell_index /= m_num_grid_cells_per_axis;
+      }
+      return try_lock<no_spin>(indices, lock_radius);
     }
   }
 
-  // P3 must provide .x(), .y(), .z()
-  template <typename P3>
-  bool try_lock(const P3 &point, int lock_radius = 0)
-  {
-    return try_lock<false, P3>(point, lock_radius);
-  }
-
-  // P3 must provide .x(), .y(), .z()
-  template <bool no_spin, typename P3>
-  bool try_lock(const P3 &point, int lock_radius = 0)
-  {
-    // Compute index on grid
-    int index_x = static_cast<int>( (CGAL::to_double(point.x()) - m_bbox.xmin()) * m_resolution_x);
-    //index_x = std::max( 0, std::min(index_x, m_num_grid_cells_per_axis - 1) );
-    index_x =
-      (index_x < 0 ? /// @TODO: use std::clamp
-        0
-        : (index_x >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_x
-          )
-      );
-    int index_y = static_cast<int>( (CGAL::to_double(point.y()) - m_bbox.ymin()) * m_resolution_y);
-    //index_y = std::max( 0, std::min(index_y, m_num_grid_cells_per_axis - 1) );
-    index_y =
-      (index_y < 0 ?
-        0
-        : (index_y >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_y
-          )
-      );
-    int index_z = static_cast<int>( (CGAL::to_double(point.z()) - m_bbox.zmin()) * m_resolution_z);
-    //index_z = std::max( 0, std::min(index_z, m_num_grid_cells_per_axis - 1) );
-    index_z =
-      (index_z < 0 ?
-        0
-        : (index_z >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_z
-          )
-      );
+  // P must provide .x(), .y() (and .z() in 3D)
+  template <typename P>
+  bool try_lock(const P &point, int lock_radius = 0)
+  {
+    return try_lock<false, P>(point, lock_radius);
+  }
 
-    if (lock_radius == 0)
-    {
-      int index =
-        index_z*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis
-        + index_y*m_num_grid_cells_per_axis
-        + index_x;
-      return try_lock<no_spin>(index);
-    }
-    else
-    {
-      return try_lock<no_spin>(index_x, index_y, index_z, lock_radius);
-    }
+  // P must provide .x(), .y() (and .z() in 3D)
+  template <bool no_spin, typename P>
+  bool try_lock(const P &point, int lock_radius = 0)
+  {
+    return try_lock<no_spin>(get_grid_indices(point), lock_radius);
   }
 
   void unlock(int cell_index)
@@ -296,16 +282,15 @@ public:
       tls_locked_cells.push_back(cell_index_to_keep_locked);
   }
 
-  template <typename P3>
-  void unlock_all_tls_locked_locations_but_one_point(const P3 &point)
+  template <typename P>
+  void unlock_all_tls_locked_locations_but_one_point(const P &point)
   {
     unlock_all_tls_locked_cells_but_one(get_grid_index(point));
   }
 
   bool check_if_all_cells_are_unlocked()
   {
-    int num_cells = m_num_grid_cells_per_axis*
-      m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+    int num_cells = compute_num_cells(m_num_grid_cells_per_axis);
     bool unlocked = true;
     for (int i = 0 ; unlocked && i < num_cells ; ++i)
       unlocked = !is_cell_locked(i);
@@ -314,8 +299,7 @@ public:
 
   bool check_if_all_tls_cells_are_unlocked()
   {
-    int num_cells = m_num_grid_cells_per_axis*
-      m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+    int num_cells = compute_num_cells(m_num_grid_cells_per_axis);
     bool unlocked = true;
     for (int i = 0 ; unlocked && i < num_cells ; ++i)
       unlocked = (get_thread_local_grid()[i] == false);
@@ -325,18 +309,19 @@ public:
 protected:
 
   // Constructor
-  Spatial_lock_grid_base_3(const Bbox_3 &bbox,
-                                          int num_grid_cells_per_axis)
+  Spatial_lock_grid_base(const Bbox &bbox,
+                         int num_grid_cells_per_axis)
     : m_num_grid_cells_per_axis(num_grid_cells_per_axis),
-      m_tls_grids([num_grid_cells_per_axis](){ return init_TLS_grid(num_grid_cells_per_axis); })
+      m_tls_grids([num_grid_cells_per_axis](){
+                    return init_TLS_grid(compute_num_cells(num_grid_cells_per_axis)); })
   {
     set_bbox(bbox);
   }
 
   /// Destructor
-  ~Spatial_lock_grid_base_3()
+  ~Spatial_lock_grid_base()
   {
-    for( TLS_grid::iterator it_grid = m_tls_grids.begin() ;
+    for( typename TLS_grid::iterator it_grid = m_tls_grids.begin() ;
              it_grid != m_tls_grids.end() ;
              ++it_grid )
     {
@@ -344,45 +329,37 @@ protected:
     }
   }
 
-  template <typename P3>
-  int get_grid_index(const P3& point) const
-  {
-    // Compute indices on grid
-    int index_x = static_cast<int>( (CGAL::to_double(point.x()) - m_bbox.xmin()) * m_resolution_x);
-    //index_x = std::max( 0, std::min(index_x, m_num_grid_cells_per_axis - 1) );
-    index_x =
-      (index_x < 0 ?
-        0
-        : (index_x >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_x
-          )
-      );
-    int index_y = static_cast<int>( (CGAL::to_double(point.y()) - m_bbox.ymin()) * m_resolution_y);
-    //index_y = std::max( 0, std::min(index_y, m_num_grid_cells_per_axis - 1) );
-    index_y =
-      (index_y < 0 ?
-        0
-        : (index_y >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_y
-          )
-      );
-    int index_z = static_cast<int>( (CGAL::to_double(point.z()) - m_bbox.zmin()) * m_resolution_z);
-    //index_z = std::max( 0, std::min(index_z, m_num_grid_cells_per_axis - 1) );
-    index_z =
-      (index_z < 0 ?
-        0
-        : (index_z >= m_num_grid_cells_per_axis ?
-            m_num_grid_cells_per_axis - 1
-            : index_z
-          )
-      );
-
-    return
-      index_z*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis
-      + index_y*m_num_grid_cells_per_axis
-      + index_x;
+  int num_cells() const
+  {
+    return compute_num_cells(m_num_grid_cells_per_axis);
+  }
+
+  // The cells are stored with the first axis varying fastest
+  int get_cell_index(const Grid_indices &indices) const
+  {
+    int index = 0;
+    for (int i = Dimension - 1 ; i >= 0 ; --i)
+      index = index*m_num_grid_cells_per_axis + indices[i];
+    return index;
+  }
+
+  template <typename FT>
+  int get_axis_index(const FT &coordinate, int axis) const
+  {
+    int index = static_cast<int>(
+      (CGAL::to_double(coordinate) - (m_bbox.min)(axis)) * m_resolution[axis]);
+    return std::clamp(index, 0, m_num_grid_cells_per_axis - 1);
+  }
+
+  template <typename P>
+  Grid_indices get_grid_indices(const P &point) const
+  {
+    Grid_indices indices;
+    indices[0] = get_axis_index(point.x(), 0);
+    indices[1] = get_axis_index(point.y(), 1);
+    if constexpr (Dimension == 3)
+      indices[2] = get_axis_index(point.z(), 2);
+    return indices;
   }
 
   bool is_cell_locked(int cell_index)
@@ -407,10 +384,8 @@ protected:
   }
 
   int                                             m_num_grid_cells_per_axis;
-  Bbox_3                                          m_bbox;
-  double                                          m_resolution_x;
-  double                                          m_resolution_y;
-  double                                          m_resolution_z;
+  Bbox                                            m_bbox;
+  std::array<double, Dimension>                   m_resolution;
 
   // TLS
   typedef tbb::enumerable_thread_specific<
@@ -426,39 +401,34 @@ protected:
 
 
 //*****************************************************************************
-// class Spatial_lock_grid_3
+// class Spatial_lock_grid
 //*****************************************************************************
-template <typename Grid_lock_tag = Tag_priority_blocking>
-class Spatial_lock_grid_3;
+template <typename Grid_lock_tag, int Dimension>
+class Spatial_lock_grid;
 
 
 //*****************************************************************************
-// class Spatial_lock_grid_3<Tag_non_blocking>
+// class Spatial_lock_grid<Tag_non_blocking>
 //*****************************************************************************
-template <>
-class Spatial_lock_grid_3<Tag_non_blocking>
-  : public Spatial_lock_grid_base_3<
-      Spatial_lock_grid_3<Tag_non_blocking> >
+template <int Dimension>
+class Spatial_lock_grid<Tag_non_blocking, Dimension>
+  : public Spatial_lock_grid_base<
+      Spatial_lock_grid<Tag_non_blocking, Dimension>, Dimension>
 {
-  typedef Spatial_lock_grid_base_3<
-    Spatial_lock_grid_3<Tag_non_blocking> > Base;
+  typedef Spatial_lock_grid_base<
+    Spatial_lock_grid<Tag_non_blocking, Dimension>, Dimension> Base;
 
 public:
+  typedef typename Base::Bbox Bbox;
+
   // Constructors
-  Spatial_lock_grid_3(const Bbox_3 &bbox, int num_grid_cells_per_axis)
+  Spatial_lock_grid(const Bbox &bbox, int num_grid_cells_per_axis)
   : Base(bbox, num_grid_cells_per_axis),
-    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis)
+    m_grid(this->num_cells())
   {
-    int num_cells =
-      num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis;
-
     // Initialize grid (useless?)
-    for (int i = 0 ; i < num_cells ; ++i)
-      m_grid[i] = false;
-  }
-
-  ~Spatial_lock_grid_3()
-  {
+    for (std::atomic<bool>& cell : m_grid)
+      cell = false;
   }
 
   bool is_cell_locked_impl(int cell_index)
@@ -472,8 +442,8 @@ public:
     bool v1 = true, v2 = false;
     if(m_grid[cell_index].compare_exchange_strong(v2,v1))
     {
-      get_thread_local_grid()[cell_index] = true;
-      m_tls_locked_cells.local().push_back(cell_index);
+      this->get_thread_local_grid()[cell_index] = true;
+      this->m_tls_locked_cells.local().push_back(cell_index);
       return true;
     }
     return false;
@@ -491,34 +461,30 @@ protected:
 
 
 //*****************************************************************************
-// class Spatial_lock_grid_3<Tag_priority_blocking>
+// class Spatial_lock_grid<Tag_priority_blocking>
 //*****************************************************************************
 
-template <>
-class Spatial_lock_grid_3<Tag_priority_blocking>
-  : public Spatial_lock_grid_base_3<Spatial_lock_grid_3<Tag_priority_blocking> >
+template <int Dimension>
+class Spatial_lock_grid<Tag_priority_blocking, Dimension>
+  : public Spatial_lock_grid_base<
+      Spatial_lock_grid<Tag_priority_blocking, Dimension>, Dimension>
 {
-  typedef Spatial_lock_grid_base_3<
-    Spatial_lock_grid_3<Tag_priority_blocking> > Base;
+  typedef Spatial_lock_grid_base<
+    Spatial_lock_grid<Tag_priority_blocking, Dimension>, Dimension> Base;
 
 public:
+  typedef typename Base::Bbox Bbox;
+
   // Constructors
 
-  Spatial_lock_grid_3(const Bbox_3 &bbox, int num_grid_cells_per_axis)
+  Spatial_lock_grid(const Bbox &bbox, int num_grid_cells_per_axis)
   : Base(bbox, num_grid_cells_per_axis),
-    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis),
+    m_grid(this->num_cells()),
     m_tls_thread_priorities(init_TLS_thread_priorities)
   {
     // Explicitly initialize the atomics
-    std::vector<std::atomic<unsigned int> >::iterator it     = m_grid.begin();
-    std::vector<std::atomic<unsigned int> >::iterator it_end = m_grid.end();
-    for ( ; it != it_end ; ++it)
-      *it = 0;
-  }
-
-  /// Destructor
-  ~Spatial_lock_grid_3()
-  {
+    for (std::atomic<unsigned int>& cell : m_grid)
+      cell = 0;
   }
 
   bool is_cell_locked_impl(int cell_index)
@@ -537,8 +503,8 @@ public:
       unsigned int old_value = 0;
       if(m_grid[cell_index].compare_exchange_strong(old_value, this_thread_priority))
       {
-        get_thread_local_grid()[cell_index] = true;
-        m_tls_locked_cells.local().push_back(cell_index);
+        this->get_thread_local_grid()[cell_index] = true;
+        this->m_tls_locked_cells.local().push_back(cell_index);
         return true;
       }
     }
@@ -550,8 +516,8 @@ public:
         unsigned int old_value =0;
         if(m_grid[cell_index].compare_exchange_weak(old_value, this_thread_priority))
         {
-          get_thread_local_grid()[cell_index] = true;
-          m_tls_locked_cells.local().push_back(cell_index);
+          this->get_thread_local_grid()[cell_index] = true;
+          this->m_tls_locked_cells.local().push_back(cell_index);
           return true;
         }
         else if (old_value > this_thread_priority)
@@ -591,6 +557,24 @@ protected:
   TLS_thread_uint_ids                                   m_tls_thread_priorities;
 };
 
+} // namespace internal
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_3
+//*****************************************************************************
+template <typename Grid_lock_tag = Tag_priority_blocking>
+class Spatial_lock_grid_3
+  : public internal::Spatial_lock_grid<Grid_lock_tag, 3>
+{
+  typedef internal::Spatial_lock_grid<Grid_lock_tag, 3> Base;
+
+public:
+  Spatial_lock_grid_3(const Bbox_3 &bbox, int num_grid_cells_per_axis)
+    : Base(bbox, num_grid_cells_per_axis)
+  {}
+};
+
 } //namespace CGAL
 
 #else // !CGAL_LINKED_WITH_TBB
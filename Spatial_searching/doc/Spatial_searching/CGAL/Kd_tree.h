@@ -260,6 +260,35 @@ into the output stream `s`.
 */
 std::ostream& write_graphviz(std::ostream& s) const;
 
+/*!
+writes the structure of the tree, that is the order of its points and its nodes, in a binary format
+into the output stream `os`, in order to avoid the construction of the same tree in a later run.
+The points themselves are not written: `index_map` must give, for each point of the tree, its position
+in the range used to construct the tree. If the points of the tree are indices
+(for example with `Search_traits_adapter`), `Identity_property_map<Point_d>` can be used.
+The tree is built if it was not.
+
+The data is written in the native byte order of the machine, and it can only be read
+by a tree of the same type on a platform with the same byte order.
+
+\tparam PointIndexMap a model of `ReadablePropertyMap` with key type `Point_d` and value type `std::size_t`
+
+\pre No point has been removed from the tree.
+*/
+template <class PointIndexMap>
+std::ostream& write_structure(std::ostream& os, PointIndexMap index_map) const;
+
+/*!
+reads the structure of a tree written by `write_structure()` from the input stream `is`
+and uses it as the structure of this tree, which is then built.
+The points of the tree must be the points of the tree written, inserted in the same order.
+Returns `false` if the structure read does not match the points of this tree, in which case
+the tree is left unchanged.
+
+\pre `is_built()` is `false`.
+*/
+bool read_structure(std::istream& is);
+
 /// @}
 
 }; /* end Kd_tree */
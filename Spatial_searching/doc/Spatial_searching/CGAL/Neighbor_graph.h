@@ -0,0 +1,118 @@
+namespace CGAL {
+
+/*!
+\ingroup SearchClasses
+
+The class `Neighbor_graph` stores the neighbors of a set of `n` points,
+designated by indices in `[0, n)`, in compressed sparse row form: the
+neighbors of all the points are stored one after the other in a single
+array, and the point `i` has the neighbors stored between the offsets
+`offsets()[i]` and `offsets()[i+1]`.
+
+Such a graph is computed by the function `compute_k_neighbor_graph()`.
+
+\sa `CGAL::Orthogonal_k_neighbor_search<Traits, OrthogonalDistance, Splitter, SpatialTree>`
+*/
+class Neighbor_graph {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+A random access iterator over the indices of the neighbors of a point.
+*/
+typedef unspecified_type Neighbor_iterator;
+
+/*!
+A range of `Neighbor_iterator`.
+*/
+typedef Iterator_range<Neighbor_iterator> Neighbor_range;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+Constructs an empty graph.
+*/
+Neighbor_graph();
+
+/*!
+Constructs a graph from its arrays: `offsets` has one more element than the number
+of points, starts with `0`, is sorted, and ends with the size of `neighbors`.
+*/
+Neighbor_graph(std::vector<std::size_t> offsets, std::vector<std::size_t> neighbors);
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+Returns the number of points.
+*/
+std::size_t number_of_points() const;
+
+/*!
+Returns the number of neighbors of the point `i`.
+*/
+std::size_t number_of_neighbors(std::size_t i) const;
+
+/*!
+Returns the indices of the neighbors of the point `i`.
+*/
+Neighbor_range neighbors(std::size_t i) const;
+
+/*!
+Returns the offsets of the neighbors of the points in `neighbor_indices()`.
+*/
+const std::vector<std::size_t>& offsets() const;
+
+/*!
+Returns the indices of the neighbors of all the points.
+*/
+const std::vector<std::size_t>& neighbor_indices() const;
+
+/*!
+Removes all the points.
+*/
+void clear();
+
+/// @}
+
+}; /* end Neighbor_graph */
+
+/*!
+\ingroup SearchClasses
+
+Computes the `k` nearest neighbors of all the points of `tree`, and stores them
+in `graph`. The neighbors of a point are sorted by increasing distance, and start
+with the point itself, even if other points are at the same place.
+
+The queries are answered in the order of the leaves of the tree, so that
+consecutive queries visit mostly the same nodes: this is faster than the same
+queries with `Orthogonal_k_neighbor_search` in the order of the input points.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation. Possible values are `Sequential_tag`
+(the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam SpatialTree must be a `Kd_tree` with extended nodes.
+\tparam PointIndexMap must be a model of `ReadablePropertyMap` whose key type is
+`SpatialTree::Point_d` and whose value type is `std::size_t`.
+\tparam OrthogonalDistance must be a model of the concept `OrthogonalDistance`.
+If omitted, the default distance of `Orthogonal_k_neighbor_search` is used.
+
+\param tree the points and the tree used for the queries, built if it is not already
+\param k the number of neighbors of each point, which is reduced to the number of points if it is larger
+\param index_map gives the index of each point of the tree, between `0` and `tree.size()`
+\param graph the output graph, in which the point of index `i` is the point `i`
+\param distance the distance used for the queries
+
+\pre No point was removed from `tree`, and `index_map` is a bijection between the points of `tree` and `[0, tree.size())`.
+*/
+template <class ConcurrencyTag, class SpatialTree, class PointIndexMap, class OrthogonalDistance>
+void compute_k_neighbor_graph(const SpatialTree& tree, unsigned int k, PointIndexMap index_map,
+                              Neighbor_graph& graph, const OrthogonalDistance& distance = OrthogonalDistance());
+
+} // namespace CGAL
@@ -24,6 +24,11 @@
 #include <string>
 #include <unordered_map>
 #include <ostream>
+#include <istream>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <new>
 
 #include <CGAL/algorithm.h>
 #include <CGAL/Kd_tree_node.h>
@@ -54,6 +59,12 @@
   case, even if TBB is linked, the standard `deque` will be used
   internally. Note that of course, in that case, parallel build will
   be disabled.
+
+  Once the tree is built, its nodes are moved from these containers to a
+  single buffer in which they are stored in depth-first order, internal
+  nodes and leaves being interleaved (see `compact_nodes()`). The nodes
+  keep their layout and are still linked by pointers, and the points of
+  the leaves stay in `pts` and in the cache of their coordinates.
  */
 #if defined(CGAL_LINKED_WITH_TBB) && !defined(CGAL_DISABLE_TBB_STRUCTURE_IN_KD_TREE)
 #  include <tbb/parallel_invoke.h>
@@ -115,6 +126,11 @@ private:
   boost::container::deque<Leaf_node> leaf_nodes;
 #endif
 
+  // Buffer storing the nodes of the built tree, made of blocks
+  // aligned on cache lines
+  struct alignas(64) Node_storage_block { unsigned char bytes[64]; };
+  std::vector<Node_storage_block> compact_node_storage;
+
   Node_handle tree_root;
 
   Kd_tree_rectangle<FT,D>* bbox;
@@ -239,6 +255,67 @@ private:
 
   inline void handle_extended_node (Internal_node_handle, Point_container&, Point_container&, const Tag_false&) { }
 
+  template <class Node_type>
+  static Node_type* place_node(const Node_type& node, unsigned char*& next)
+  {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(next);
+    address = (address + alignof(Node_type) - 1) / alignof(Node_type) * alignof(Node_type);
+    Node_type* copy = new (reinterpret_cast<void*>(address)) Node_type(node);
+    next = reinterpret_cast<unsigned char*>(address) + sizeof(Node_type);
+    return copy;
+  }
+
+  // copies the subtree of `n` in depth-first order starting at `next`, with an explicit
+  // stack as the depth of a tree read by `read_structure()` is given by the input
+  Node_handle copy_subtree(Node_const_handle n, unsigned char*& next)
+  {
+    Node_handle root = nullptr;
+    // the nodes to copy, with the child pointer of the copied parent to set
+    std::vector<std::pair<Node_const_handle, Node_handle*> > stack(1, std::make_pair(n, &root));
+    while (!stack.empty())
+    {
+      const std::pair<Node_const_handle, Node_handle*> top = stack.back();
+      stack.pop_back();
+      if (top.first->is_leaf())
+      {
+        *top.second = place_node(*static_cast<Leaf_node_const_handle>(top.first), next);
+        continue;
+      }
+
+      Internal_node_handle copy = place_node(*static_cast<Internal_node_const_handle>(top.first), next);
+      *top.second = copy;
+      stack.emplace_back(copy->upper_ch, &copy->upper_ch);
+      stack.emplace_back(copy->lower_ch, &copy->lower_ch);
+    }
+    return root;
+  }
+
+  // The nodes are created in two separate containers, in an order that depends
+  // on the concurrency of the construction. They are moved to a single buffer in
+  // depth-first order, so that the children of a node, and in particular the leaves
+  // reached at the end of a descent, are usually stored in the cache lines following
+  // the node, which reduces the number of cache misses of the searches.
+  // Only the order of the nodes changes: they are still linked by pointers
+  // rather than by indices, and the leaves still refer to the points in `pts`.
+  // As the nodes of the buffer are never destroyed, this is only done
+  // if they are trivially destructible, that is if `FT` is.
+  void compact_nodes()
+  {
+    if (!std::is_trivially_destructible<Internal_node>::value ||
+        !std::is_trivially_destructible<Leaf_node>::value)
+      return;
+
+    const std::size_t nb_bytes = internal_nodes.size() * (sizeof(Internal_node) + alignof(Internal_node))
+                               + leaf_nodes.size() * (sizeof(Leaf_node) + alignof(Leaf_node));
+    compact_node_storage.clear();
+    compact_node_storage.resize((nb_bytes + sizeof(Node_storage_block) - 1) / sizeof(Node_storage_block));
+    unsigned char* next = compact_node_storage.front().bytes;
+    tree_root = copy_subtree(tree_root, next);
+
+    decltype(internal_nodes)().swap(internal_nodes);
+    decltype(leaf_nodes)().swap(leaf_nodes);
+  }
+
   inline bool try_parallel_internal_node_creation (Internal_node_handle, Point_container&,
                                                    Point_container&, const Sequential_tag&)
   {
@@ -367,6 +444,7 @@ public:
     if (Enable_points_cache::value)
     {
       typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+      points_cache.clear();
       points_cache.reserve(dim_ * pts.size());
       for (std::size_t i = 0; i < pts.size(); ++i)
         points_cache.insert(points_cache.end(), construct_it(ptstmp[i]), construct_it(ptstmp[i], 0));
@@ -381,6 +459,7 @@ public:
     data.clear();
     data.shrink_to_fit();
 
+    compact_nodes();
     built_ = true;
   }
 
@@ -423,6 +502,267 @@ public:
     return s;
   }
 
+private:
+  // signature of the binary format of `write_structure()`
+  static const char* structure_signature() { return "CGAL::Kd_tree 1"; }
+
+  template <class T>
+  static void write_binary(std::ostream& os, const T* t, std::size_t n = 1)
+  {
+    static_assert(std::is_trivially_copyable<T>::value);
+    os.write(reinterpret_cast<const char*>(t), n * sizeof(T));
+  }
+
+  template <class T>
+  static bool read_binary(std::istream& is, T* t, std::size_t n = 1)
+  {
+    static_assert(std::is_trivially_copyable<T>::value);
+    is.read(reinterpret_cast<char*>(t), n * sizeof(T));
+    return bool(is);
+  }
+
+  void write_extended_values(std::ostream& os, Internal_node_const_handle nh, const Tag_true&) const
+  {
+    const FT values[4] = { nh->lower_low_val, nh->lower_high_val, nh->upper_low_val, nh->upper_high_val };
+    write_binary(os, values, 4);
+  }
+
+  void write_extended_values(std::ostream&, Internal_node_const_handle, const Tag_false&) const { }
+
+  bool read_extended_values(std::istream& is, Internal_node_handle nh, const Tag_true&)
+  {
+    FT values[4];
+    if(!read_binary(is, values, 4))
+      return false;
+    nh->lower_low_val = values[0];
+    nh->lower_high_val = values[1];
+    nh->upper_low_val = values[2];
+    nh->upper_high_val = values[3];
+    return true;
+  }
+
+  bool read_extended_values(std::istream&, Internal_node_handle, const Tag_false&) { return true; }
+
+  // nodes are written in depth-first order, the points of a leaf being
+  // the ones following the points of the previous leaves
+  void write_nodes(std::ostream& os, Node_const_handle root) const
+  {
+    std::vector<Node_const_handle> stack(1, root);
+    while(!stack.empty())
+    {
+      Node_const_handle n = stack.back();
+      stack.pop_back();
+      const std::uint8_t is_leaf = n->is_leaf();
+      write_binary(os, &is_leaf);
+      if(is_leaf)
+      {
+        const std::int32_t size = static_cast<Leaf_node_const_handle>(n)->size();
+        write_binary(os, &size);
+        continue;
+      }
+
+      Internal_node_const_handle nh = static_cast<Internal_node_const_handle>(n);
+      const std::int32_t cut_dim = nh->cutting_dimension();
+      const FT cut_val = nh->cutting_value();
+      write_binary(os, &cut_dim);
+      write_binary(os, &cut_val);
+      write_extended_values(os, nh, UseExtendedNode());
+      stack.push_back(nh->upper());
+      stack.push_back(nh->lower());
+    }
+  }
+
+  // reads a node without its children, which are set to `nullptr` for an internal node;
+  // returns `nullptr` if the input is not valid, `dim` being the dimension of the points
+  Node_handle read_node(std::istream& is, int dim, iterator points_begin, std::size_t& nb_points_read)
+  {
+    std::uint8_t is_leaf;
+    if(!read_binary(is, &is_leaf))
+      return nullptr;
+
+    if(is_leaf)
+    {
+      std::int32_t size;
+      if(!read_binary(is, &size) || size < 0 || nb_points_read + size > pts.size())
+        return nullptr;
+      Leaf_node node(static_cast<unsigned int>(size));
+      node.data = points_begin + nb_points_read;
+      nb_points_read += size;
+#ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
+      return &*(leaf_nodes.push_back(node));
+#else
+      leaf_nodes.emplace_back (node);
+      return &(leaf_nodes.back());
+#endif
+    }
+
+    std::int32_t cut_dim;
+    FT cut_val;
+    if(!read_binary(is, &cut_dim) || !read_binary(is, &cut_val) || cut_dim < 0 || cut_dim >= dim)
+      return nullptr;
+
+    Internal_node_handle nh = static_cast<Internal_node_handle>(new_internal_node());
+    Separator sep(cut_dim, cut_val);
+    nh->set_separator(sep);
+    nh->lower_ch = nullptr;
+    nh->upper_ch = nullptr;
+    if(!read_extended_values(is, nh, UseExtendedNode()))
+      return nullptr;
+    return nh;
+  }
+
+  // reads the nodes written by `write_nodes()` and returns the root, or `nullptr` if the input
+  // is not valid. The depth of the tree is given by the input, and leaves may be empty,
+  // so the nodes are read with an explicit stack of the internal nodes whose upper child
+  // is not read yet, rather than recursively.
+  Node_handle read_nodes(std::istream& is, int dim, iterator points_begin, std::size_t& nb_points_read)
+  {
+    Node_handle root = read_node(is, dim, points_begin, nb_points_read);
+    if(root == nullptr || root->is_leaf())
+      return root;
+
+    std::vector<Internal_node_handle> parents(1, static_cast<Internal_node_handle>(root));
+    while(!parents.empty())
+    {
+      Node_handle n = read_node(is, dim, points_begin, nb_points_read);
+      if(n == nullptr)
+        return nullptr;
+
+      Internal_node_handle parent = parents.back();
+      if(parent->lower_ch == nullptr)
+      {
+        parent->lower_ch = n;
+      }
+      else
+      {
+        parent->upper_ch = n;
+        parents.pop_back();
+      }
+
+      if(!n->is_leaf())
+        parents.push_back(static_cast<Internal_node_handle>(n));
+    }
+    return root;
+  }
+
+public:
+  // Writes the structure of the tree (the order of the points, and the nodes) in a binary
+  // format, `index_map` giving the position of each point in the range used to construct the tree.
+  template <class PointIndexMap>
+  std::ostream&
+  write_structure(std::ostream& os, PointIndexMap index_map) const
+  {
+    static_assert(std::is_trivially_copyable<FT>::value,
+                  "The structure of the tree can only be written if FT is a trivially copyable type.");
+    CGAL_precondition(removed_ == 0);
+
+    os.write(structure_signature(), std::strlen(structure_signature()));
+    const std::uint64_t nb_points = pts.size();
+    write_binary(os, &nb_points);
+    if(pts.empty())
+      return os;
+
+    if(! is_built()){
+      const_build();
+    }
+    const std::int32_t dim = dim_;
+    write_binary(os, &dim);
+
+    std::vector<std::uint64_t> indices;
+    indices.reserve(pts.size());
+    for(const Point_d& p : pts)
+      indices.push_back(get(index_map, p));
+    write_binary(os, indices.data(), indices.size());
+
+    std::vector<FT> bounds;
+    for(int i=0; i<dim_; ++i)
+    {
+      bounds.push_back(bbox->min_coord(i));
+      bounds.push_back(bbox->max_coord(i));
+    }
+    write_binary(os, bounds.data(), bounds.size());
+
+    write_nodes(os, tree_root);
+    return os;
+  }
+
+  // Reads the structure of the tree written by `write_structure()`. The tree must not be
+  // built and must contain the same points as the tree written, in the same order.
+  // Returns `false` if the structure read does not correspond to the points of the tree,
+  // in which case the tree is left unchanged.
+  bool read_structure(std::istream& is)
+  {
+    CGAL_precondition(!is_built());
+
+    const std::size_t signature_size = std::strlen(structure_signature());
+    std::string signature(signature_size, ' ');
+    is.read(&signature[0], signature_size);
+    std::uint64_t nb_points;
+    if(!is || signature != structure_signature() || !read_binary(is, &nb_points) || nb_points != pts.size())
+      return false;
+    if(pts.empty())
+      return true;
+
+    std::int32_t dim;
+    const Point_d& p = *pts.begin();
+    typename SearchTraits::Construct_cartesian_const_iterator_d ccci=traits_.construct_cartesian_const_iterator_d_object();
+    if(!read_binary(is, &dim) || dim != static_cast<int>(std::distance(ccci(p), ccci(p,0))))
+      return false;
+
+    std::vector<std::uint64_t> indices(pts.size());
+    if(!read_binary(is, indices.data(), indices.size()))
+      return false;
+    std::vector<bool> is_used(pts.size(), false);
+    std::vector<Point_d> ptstmp;
+    ptstmp.reserve(pts.size());
+    for(std::uint64_t i : indices)
+    {
+      if(i >= pts.size() || is_used[i])
+        return false;
+      is_used[i] = true;
+      ptstmp.push_back(pts[i]);
+    }
+
+    std::vector<FT> bounds(2*dim);
+    if(!read_binary(is, bounds.data(), bounds.size()))
+      return false;
+
+    // the nodes are read before the tree is modified
+    std::size_t nb_points_read = 0;
+    Node_handle root = read_nodes(is, dim, ptstmp.begin(), nb_points_read);
+    if(root == nullptr || nb_points_read != pts.size())
+    {
+      internal_nodes.clear();
+      leaf_nodes.clear();
+      return false;
+    }
+
+    dim_ = dim;
+    tree_root = root;
+
+    bbox = new Kd_tree_rectangle<FT,D>(dim_);
+    for(int i=0; i<dim_; ++i)
+    {
+      bbox->set_lower_bound(i, bounds[2*i]);
+      bbox->set_upper_bound(i, bounds[2*i+1]);
+    }
+
+    if (Enable_points_cache::value)
+    {
+      typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+      points_cache.clear();
+      points_cache.reserve(dim_ * pts.size());
+      for (std::size_t i = 0; i < ptstmp.size(); ++i)
+        points_cache.insert(points_cache.end(), construct_it(ptstmp[i]), construct_it(ptstmp[i], 0));
+    }
+
+    // the leaves keep pointing to the points, which are moved with the buffer
+    pts.swap(ptstmp);
+    compact_nodes();
+    built_ = true;
+    return true;
+  }
+
 private:
   //any call to this function is for the moment not threadsafe
   void const_build() const {
@@ -455,6 +795,7 @@ public:
     if(is_built()){
       internal_nodes.clear();
       leaf_nodes.clear();
+      compact_node_storage.clear();
       data.clear();
       delete bbox;
       built_ = false;
@@ -554,6 +895,11 @@ private:
       if (pi != lasti) {
         // Hack to get a non-const iterator
         std::iter_swap(pts.begin()+(pi-pts.begin()), pts.begin()+(lasti-pts.begin()));
+        // the cached coordinates follow the points
+        if (Enable_points_cache::value)
+          std::swap_ranges(points_cache.begin() + dim_*(pi-pts.begin()),
+                           points_cache.begin() + dim_*(pi-pts.begin()+1),
+                           points_cache.begin() + dim_*(lasti-pts.begin()));
       }
       lnode->drop_last_point();
     } else if (!equal_to_p(*lnode->begin())) {
@@ -0,0 +1,209 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Simon Giraudot
+
+#ifndef CGAL_NEIGHBOR_GRAPH_H
+#define CGAL_NEIGHBOR_GRAPH_H
+
+#include <CGAL/license/Spatial_searching.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Iterator_range.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+#include <CGAL/assertions.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+class Neighbor_graph
+{
+public:
+  typedef std::vector<std::size_t>::const_iterator Neighbor_iterator;
+  typedef Iterator_range<Neighbor_iterator> Neighbor_range;
+
+private:
+  std::vector<std::size_t> m_offsets;
+  std::vector<std::size_t> m_neighbors;
+
+public:
+  Neighbor_graph()
+    : m_offsets(1, 0)
+  { }
+
+  Neighbor_graph(std::vector<std::size_t> offsets, std::vector<std::size_t> neighbors)
+    : m_offsets(std::move(offsets)), m_neighbors(std::move(neighbors))
+  {
+    CGAL_precondition(!m_offsets.empty() && m_offsets.front() == 0);
+    CGAL_precondition(m_offsets.back() == m_neighbors.size());
+    CGAL_precondition(std::is_sorted(m_offsets.begin(), m_offsets.end()));
+  }
+
+  std::size_t number_of_points() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  std::size_t number_of_neighbors(std::size_t i) const
+  {
+    CGAL_precondition(i < number_of_points());
+    return m_offsets[i+1] - m_offsets[i];
+  }
+
+  Neighbor_range neighbors(std::size_t i) const
+  {
+    CGAL_precondition(i < number_of_points());
+    return make_range(m_neighbors.begin() + m_offsets[i], m_neighbors.begin() + m_offsets[i+1]);
+  }
+
+  const std::vector<std::size_t>& offsets() const
+  {
+    return m_offsets;
+  }
+
+  const std::vector<std::size_t>& neighbor_indices() const
+  {
+    return m_neighbors;
+  }
+
+  void clear()
+  {
+    m_offsets.assign(1, 0);
+    m_neighbors.clear();
+  }
+};
+
+namespace internal {
+
+// The points of the tree are the queries: if the query item of the
+// distance is a different type (Search_traits_adapter), it is
+// obtained through the point property map of the distance.
+template <class Distance, class Point_d>
+const Point_d& k_neighbor_graph_query(const Distance&, const Point_d& p, std::true_type)
+{
+  return p;
+}
+
+template <class Distance, class Point_d>
+typename Distance::Query_item
+k_neighbor_graph_query(const Distance& distance, const Point_d& p, std::false_type)
+{
+  return get(distance.point_property_map(), p);
+}
+
+} // namespace internal
+
+template <class ConcurrencyTag = Sequential_tag, class Tree, class PointIndexMap, class Distance>
+void compute_k_neighbor_graph(const Tree& tree, unsigned int k, PointIndexMap index_map,
+                              Neighbor_graph& graph, const Distance& distance)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typedef typename Tree::Traits Traits;
+  typedef typename Tree::Splitter Splitter;
+  typedef typename Tree::Point_d Point_d;
+  typedef Orthogonal_k_neighbor_search<Traits, Distance, Splitter, Tree> Neighbor_search;
+  typedef typename std::is_convertible<Point_d, typename Distance::Query_item>::type Point_is_query_item;
+
+  const std::size_t nb_points = tree.size();
+  const std::size_t degree = (std::min)(std::size_t(k), nb_points);
+
+  // every point has `degree` neighbors
+  std::vector<std::size_t> offsets(nb_points + 1);
+  for(std::size_t i = 0; i <= nb_points; ++i)
+    offsets[i] = i * degree;
+  std::vector<std::size_t> neighbors(nb_points * degree);
+
+  if(degree == 0)
+  {
+    graph = Neighbor_graph(std::move(offsets), std::move(neighbors));
+    return;
+  }
+
+  // builds the tree before the queries, which may run concurrently
+  tree.root();
+
+  // After the construction, the points of the tree are sorted in
+  // leaf order: consecutive queries are close to each other and
+  // visit mostly the same nodes, which are then in cache.
+  auto search_range = [&](std::size_t first, std::size_t last)
+  {
+    for(std::size_t i = first; i < last; ++i)
+    {
+      const Point_d& p = *(tree.begin() + i);
+      Neighbor_search search(tree,
+                             internal::k_neighbor_graph_query(distance, p, Point_is_query_item()),
+                             static_cast<unsigned int>(degree), 0, true, distance);
+
+      const std::size_t index = get(index_map, p);
+      CGAL_precondition(index < nb_points);
+      std::size_t* first_neighbor = neighbors.data() + offsets[index];
+      std::size_t* row = first_neighbor;
+      for(const auto& neighbor : search)
+        *(row++) = get(index_map, neighbor.first);
+      CGAL_assertion(row == neighbors.data() + offsets[index+1]);
+
+      // Points at the same place as `p` are at distance 0 and may be reported
+      // before it, or instead of it if there are more than `degree` of them:
+      // `p` is moved (or inserted) in front of them, which keeps the order.
+      std::size_t* self = std::find(first_neighbor, row, index);
+      if(self == row)
+        --self;
+      std::rotate(first_neighbor, self, self + 1);
+      *first_neighbor = index;
+    }
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_points, 256),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        search_range(r.begin(), r.end());
+                      });
+  }
+  else
+#endif
+  {
+    search_range(0, nb_points);
+  }
+
+  graph = Neighbor_graph(std::move(offsets), std::move(neighbors));
+}
+
+template <class ConcurrencyTag = Sequential_tag, class Tree, class PointIndexMap>
+void compute_k_neighbor_graph(const Tree& tree, unsigned int k, PointIndexMap index_map,
+                              Neighbor_graph& graph)
+{
+  typedef typename internal::Spatial_searching_default_distance<typename Tree::Traits>::type Distance;
+  compute_k_neighbor_graph<ConcurrencyTag>(tree, k, index_map, graph, Distance());
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_NEIGHBOR_GRAPH_H
@@ -22,7 +22,9 @@
 #include <CGAL/Spatial_searching/internal/K_neighbor_search.h>
 #include <CGAL/Spatial_searching/internal/Search_helpers.h>
 
+#include <algorithm>
 #include <iterator> // for std::distance
+#include <type_traits>
 
 namespace CGAL {
 
@@ -81,6 +83,50 @@ private:
 
   // With cache
   void search_nearest_in_leaf(typename Tree::Leaf_node_const_handle node, Tag_true)
+  {
+    search_nearest_in_leaf_with_cache(node, internal::Leaf_scan_dimension<Distance>());
+  }
+
+  // With cache, for the Euclidean distance between points with double coordinates
+  // in dimension 2 or 3: the distances to the points of the leaf are computed by blocks
+  // in a loop without branches that compilers vectorize, and only then compared to the
+  // current worst distance
+  template <int dim>
+  void search_nearest_in_leaf_with_cache(typename Tree::Leaf_node_const_handle node,
+                                         std::integral_constant<int, dim>)
+  {
+    constexpr int block_size = 8;
+    double query[dim];
+    for (int j = 0; j < dim; ++j)
+      query[j] = *(query_object_it + j);
+
+    typename Tree::iterator it_node_point = node->begin(), it_node_point_end = node->end();
+    const double* coordinates = &*(m_tree.cache_begin() + dim*(it_node_point - m_tree.begin()));
+    double distances[block_size];
+    while (it_node_point != it_node_point_end)
+    {
+      const int nb_points = static_cast<int>((std::min<std::ptrdiff_t>)(block_size, it_node_point_end - it_node_point));
+      // same operations as Euclidean_distance::transformed_distance_from_coordinates()
+      for (int i = 0; i < nb_points; ++i)
+      {
+        double distance = CGAL::square(query[0] - coordinates[dim*i]);
+        for (int j = 1; j < dim; ++j)
+          distance += CGAL::square(query[j] - coordinates[dim*i+j]);
+        distances[i] = distance;
+      }
+      coordinates += dim*nb_points;
+
+      for (int i = 0; i < nb_points; ++i, ++it_node_point)
+      {
+        this->number_of_items_visited++;
+        if (!this->queue.full() || distances[i] < this->queue.top().second)
+          this->queue.insert(std::make_pair(&(*it_node_point), distances[i]));
+      }
+    }
+  }
+
+  void search_nearest_in_leaf_with_cache(typename Tree::Leaf_node_const_handle node,
+                                         std::integral_constant<int, 0>)
   {
     typename Tree::iterator it_node_point = node->begin(), it_node_point_end = node->end();
     typename std::vector<FT>::const_iterator cache_point_begin = m_tree.cache_begin() + m_dim*(it_node_point - m_tree.begin());
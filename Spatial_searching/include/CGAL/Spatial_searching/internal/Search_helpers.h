@@ -16,10 +16,22 @@
 #include <CGAL/license/Spatial_searching.h>
 
 #include <CGAL/Has_member.h>
+#include <CGAL/Dimension.h>
+#include <CGAL/Spatial_searching/internal/Get_dimension_tag.h>
 
 #include <boost/mpl/has_xxx.hpp>
 
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
+
+template <class SearchTraits>
+class Euclidean_distance;
+
+template <class Point_with_info, class PointPropertyMap, class Base_distance>
+class Distance_adapter;
+
 namespace internal {
 
 // Helper struct to know at compile-time if there is a cache of the points
@@ -234,6 +246,28 @@ private:
     has_interruptible_transformed_distance<Distance>::value> m_itd;
 }; // Distance_helper
 
+// Dimension of the points for which the distances from a query to the points of a leaf
+// can be computed by the blocked leaf scan of `Orthogonal_k_neighbor_search`, that is
+// 2 or 3 for the Euclidean distance between points with `double` coordinates, 0 otherwise
+template <typename Distance>
+struct Leaf_scan_dimension
+  : public std::integral_constant<int, 0>
+{};
+
+template <typename SearchTraits>
+struct Leaf_scan_dimension< ::CGAL::Euclidean_distance<SearchTraits> >
+  : public std::integral_constant<int,
+      (std::is_same<typename SearchTraits::FT, double>::value &&
+       (std::is_same<typename Get_dimension_tag<SearchTraits>::Dimension, Dimension_tag<2> >::value ||
+        std::is_same<typename Get_dimension_tag<SearchTraits>::Dimension, Dimension_tag<3> >::value))
+      ? Get_dimension_tag<SearchTraits>::Dimension::value : 0>
+{};
+
+template <typename Point_with_info, typename PointPropertyMap, typename Base_distance>
+struct Leaf_scan_dimension< ::CGAL::Distance_adapter<Point_with_info, PointPropertyMap, Base_distance> >
+  : public Leaf_scan_dimension<Base_distance>
+{};
+
 
 }} // namespace CGAL::internal
 
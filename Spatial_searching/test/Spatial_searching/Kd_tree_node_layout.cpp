@@ -0,0 +1,114 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Kd_tree.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/K_neighbor_search.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Random_points_in_cube_3<Point_3> Random_points;
+typedef CGAL::Search_traits_3<Kernel> Traits;
+typedef CGAL::Sliding_midpoint<Traits> Splitter;
+
+// Once built, the nodes are stored in depth-first order: the address of each
+// node is larger than the one of the node visited before it.
+template <class Tree>
+std::size_t check_depth_first_order(const Tree& tree)
+{
+  typedef typename Tree::Node_const_handle Node_const_handle;
+  typedef typename Tree::Internal_node_const_handle Internal_node_const_handle;
+
+  const char* previous = nullptr;
+  std::size_t nb_nodes = 0;
+  std::function<void(Node_const_handle)> visit = [&](Node_const_handle n)
+  {
+    const char* address = reinterpret_cast<const char*>(&*n);
+    assert(previous == nullptr || previous < address);
+    previous = address;
+    ++nb_nodes;
+    if(!n->is_leaf())
+    {
+      Internal_node_const_handle nh = static_cast<Internal_node_const_handle>(n);
+      visit(nh->lower());
+      visit(nh->upper());
+    }
+  };
+  visit(tree.root());
+  return nb_nodes;
+}
+
+template <class Tree>
+void check_neighbors(const Tree& tree, const std::vector<Point_3>& points)
+{
+  typedef CGAL::K_neighbor_search<Traits, typename CGAL::internal::Spatial_searching_default_distance<Traits>::type,
+                                  Splitter, Tree> Neighbor_search;
+
+  Random_points queries(1.2);
+  for(int i=0; i<50; ++i)
+  {
+    const Point_3 q = *queries++;
+    Neighbor_search search(tree, q, 5);
+    std::vector<double> distances;
+    for(const auto& n : search)
+      distances.push_back(n.second);
+
+    std::vector<double> expected;
+    for(const Point_3& p : points)
+      expected.push_back(CGAL::squared_distance(p, q));
+    std::partial_sort(expected.begin(), expected.begin() + 5, expected.end());
+    expected.resize(5);
+    assert(distances == expected);
+  }
+}
+
+template <class Tree, class ConcurrencyTag>
+void test(const std::vector<Point_3>& points)
+{
+  Tree tree(points.begin(), points.end());
+  tree.template build<ConcurrencyTag>();
+  const std::size_t nb_nodes = check_depth_first_order(tree);
+  assert(nb_nodes > points.size() / 10);
+  check_neighbors(tree, points);
+
+  // the nodes are stored again after a new construction
+  std::vector<Point_3> more_points(points);
+  Random_points rdpts;
+  for(int i=0; i<1000; ++i)
+  {
+    more_points.push_back(*rdpts++);
+    tree.insert(more_points.back());
+  }
+  tree.template build<ConcurrencyTag>();
+  assert(check_depth_first_order(tree) > nb_nodes);
+  check_neighbors(tree, more_points);
+
+  // removing points modifies the nodes of the buffer
+  for(int i=0; i<1000; ++i)
+  {
+    tree.remove(more_points.back());
+    more_points.pop_back();
+  }
+  check_neighbors(tree, more_points);
+}
+
+int main()
+{
+  Random_points rdpts;
+  std::vector<Point_3> points;
+  for(std::size_t i = 0; i < 20000; ++i)
+    points.push_back(*rdpts++);
+
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false>, CGAL::Sequential_tag>(points);
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_false, CGAL::Tag_false>, CGAL::Sequential_tag>(points);
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_true>, CGAL::Sequential_tag>(points);
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false>, CGAL::Parallel_if_available_tag>(points);
+
+  return 0;
+}
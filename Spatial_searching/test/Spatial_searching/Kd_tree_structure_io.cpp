@@ -0,0 +1,162 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Kd_tree.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/K_neighbor_search.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/property_map.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Random_points_in_cube_3<Point_3> Random_points;
+
+// the points of the tree are indices in a vector of points
+typedef CGAL::Pointer_property_map<Point_3>::const_type Point_map;
+typedef CGAL::Search_traits_adapter<std::size_t, Point_map, CGAL::Search_traits_3<Kernel> > Traits;
+typedef CGAL::Sliding_midpoint<Traits> Splitter;
+typedef CGAL::Distance_adapter<std::size_t, Point_map, CGAL::Euclidean_distance<CGAL::Search_traits_3<Kernel> > > Distance;
+
+// whether the internal nodes of the tree store the extended values
+template <class Tree>
+struct Uses_extended_node;
+
+template <class Tr, class Sp, class UseExtendedNode, class EnablePointsCache>
+struct Uses_extended_node<CGAL::Kd_tree<Tr, Sp, UseExtendedNode, EnablePointsCache> >
+  : public UseExtendedNode
+{};
+
+template <class Tree>
+void test(const std::vector<Point_3>& points)
+{
+  typedef CGAL::K_neighbor_search<Traits, Distance, Splitter, Tree> Neighbor_search;
+
+  Point_map point_map = CGAL::make_property_map(points);
+  Traits traits(point_map);
+  Distance distance(point_map);
+
+  std::vector<std::size_t> indices(points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    indices[i] = i;
+
+  Tree tree(indices.begin(), indices.end(), Splitter(), traits);
+  tree.build();
+
+  std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+  tree.write_structure(ss, CGAL::Identity_property_map<std::size_t>());
+
+  Tree loaded_tree(indices.begin(), indices.end(), Splitter(), traits);
+  assert(loaded_tree.read_structure(ss));
+  assert(loaded_tree.is_built());
+  assert(loaded_tree.size() == tree.size());
+  assert(std::equal(tree.begin(), tree.end(), loaded_tree.begin()));
+  for(int i=0; i<3; ++i)
+  {
+    assert(tree.bounding_box().min_coord(i) == loaded_tree.bounding_box().min_coord(i));
+    assert(tree.bounding_box().max_coord(i) == loaded_tree.bounding_box().max_coord(i));
+  }
+
+  Random_points queries(1.5);
+  for(std::size_t i=0; i<100; ++i)
+  {
+    const Point_3 q = *queries++;
+    Neighbor_search search(tree, q, 5, 0, true, distance);
+    Neighbor_search loaded_search(loaded_tree, q, 5, 0, true, distance);
+    assert(std::equal(search.begin(), search.end(), loaded_search.begin(),
+                      [](const auto& a, const auto& b) { return a.first == b.first; }));
+  }
+
+  // the structure does not match the points of the tree
+  std::stringstream ss2(std::ios::in | std::ios::out | std::ios::binary);
+  tree.write_structure(ss2, CGAL::Identity_property_map<std::size_t>());
+  Tree other_tree(indices.begin(), indices.begin() + 10, Splitter(), traits);
+  assert(!other_tree.read_structure(ss2));
+  assert(!other_tree.is_built());
+
+  // the nodes are truncated: the tree is left unchanged, and can still be built
+  std::stringstream ss4(std::ios::in | std::ios::out | std::ios::binary);
+  tree.write_structure(ss4, CGAL::Identity_property_map<std::size_t>());
+  const std::string structure = ss4.str();
+  std::stringstream truncated(structure.substr(0, structure.size() - 16), std::ios::in | std::ios::binary);
+  Tree truncated_tree(indices.begin(), indices.end(), Splitter(), traits);
+  assert(!truncated_tree.read_structure(truncated));
+  assert(!truncated_tree.is_built());
+  truncated_tree.build();
+  assert(truncated_tree.dim() == 3);
+  const Point_3 q = *queries++;
+  Neighbor_search search(tree, q, 5, 0, true, distance);
+  Neighbor_search truncated_search(truncated_tree, q, 5, 0, true, distance);
+  assert(std::equal(search.begin(), search.end(), truncated_search.begin(),
+                    [](const auto& a, const auto& b) { return a.first == b.first; }));
+
+  // a deep chain of internal nodes whose upper children are empty leaves, which is read without recursion
+  {
+    const std::size_t nb_small = 10;
+    Tree small_tree(indices.begin(), indices.begin() + nb_small, Splitter(), traits);
+    std::stringstream small_ss(std::ios::in | std::ios::out | std::ios::binary);
+    small_tree.write_structure(small_ss, CGAL::Identity_property_map<std::size_t>());
+    const std::size_t header_size = std::strlen("CGAL::Kd_tree 1") + sizeof(std::uint64_t) + sizeof(std::int32_t)
+                                  + nb_small * sizeof(std::uint64_t) + 6 * sizeof(double);
+    std::string deep = small_ss.str().substr(0, header_size);
+    const std::size_t depth = 1000000;
+    auto append = [&deep](const auto& v) { deep.append(reinterpret_cast<const char*>(&v), sizeof(v)); };
+    for(std::size_t i=0; i<depth; ++i)
+    {
+      append(std::uint8_t(0));
+      append(std::int32_t(i % 3));
+      append(double(0));
+      if(Uses_extended_node<Tree>::value)
+        for(int j=0; j<4; ++j)
+          append(double(0));
+    }
+    append(std::uint8_t(1));
+    append(std::int32_t(nb_small));
+    for(std::size_t i=0; i<depth; ++i)
+    {
+      append(std::uint8_t(1));
+      append(std::int32_t(0));
+    }
+
+    std::stringstream deep_ss(deep, std::ios::in | std::ios::binary);
+    Tree deep_tree(indices.begin(), indices.begin() + nb_small, Splitter(), traits);
+    const bool deep_read = deep_tree.read_structure(deep_ss);
+    assert(deep_read && deep_tree.is_built());
+    CGAL_USE(deep_read);
+    std::stringstream deep_out(std::ios::in | std::ios::out | std::ios::binary);
+    deep_tree.write_structure(deep_out, CGAL::Identity_property_map<std::size_t>());
+    assert(deep_out.str() == deep);
+
+    std::stringstream truncated_deep_ss(deep.substr(0, deep.size() - 5), std::ios::in | std::ios::binary);
+    Tree truncated_deep_tree(indices.begin(), indices.begin() + nb_small, Splitter(), traits);
+    const bool truncated_deep_read = truncated_deep_tree.read_structure(truncated_deep_ss);
+    assert(!truncated_deep_read && !truncated_deep_tree.is_built());
+    CGAL_USE(truncated_deep_read);
+  }
+
+  // empty trees
+  std::stringstream ss3(std::ios::in | std::ios::out | std::ios::binary);
+  Tree empty_tree(Splitter(), traits);
+  empty_tree.write_structure(ss3, CGAL::Identity_property_map<std::size_t>());
+  Tree loaded_empty_tree(Splitter(), traits);
+  assert(loaded_empty_tree.read_structure(ss3));
+}
+
+int main()
+{
+  Random_points rdpts;
+  std::vector<Point_3> points;
+  for(std::size_t i = 0; i < 10000; ++i)
+    points.push_back(*rdpts++);
+
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false> >(points);
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_false, CGAL::Tag_false> >(points);
+  test<CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_true> >(points);
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Kd_tree.h>
+#include <CGAL/Neighbor_graph.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <cassert>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Point_3 Point_3;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// the points of the tree are indices in a vector of points
+template <class Point, class Base_traits>
+void test(const std::vector<Point>& points, unsigned int k)
+{
+  typedef typename CGAL::Pointer_property_map<Point>::const_type Point_map;
+  typedef CGAL::Search_traits_adapter<std::size_t, Point_map, Base_traits> Traits;
+  typedef CGAL::Distance_adapter<std::size_t, Point_map, CGAL::Euclidean_distance<Base_traits> > Distance;
+  typedef CGAL::Sliding_midpoint<Traits> Splitter;
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_true> Tree;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits, Distance, Splitter, Tree> Neighbor_search;
+
+  Point_map point_map = CGAL::make_property_map(points);
+  Distance distance(point_map);
+  Tree tree(boost::counting_iterator<std::size_t>(0),
+            boost::counting_iterator<std::size_t>(points.size()),
+            Splitter(), Traits(point_map));
+
+  CGAL::Neighbor_graph graph;
+  CGAL::compute_k_neighbor_graph(tree, k, CGAL::Identity_property_map<std::size_t>(), graph, distance);
+
+  const std::size_t degree = (std::min)(std::size_t(k), points.size());
+  assert(graph.number_of_points() == points.size());
+  assert(graph.offsets().size() == points.size() + 1);
+  assert(graph.neighbor_indices().size() == points.size() * degree);
+
+  // same neighbors, in the same order, as a search per point
+  for(std::size_t i=0; i<points.size() && k != 0; ++i)
+  {
+    assert(graph.number_of_neighbors(i) == degree);
+    Neighbor_search search(tree, points[i], k, 0, true, distance);
+    typename CGAL::Neighbor_graph::Neighbor_iterator nit = graph.neighbors(i).begin();
+    for(const auto& neighbor : search)
+    {
+      assert(*nit == neighbor.first);
+      ++nit;
+    }
+    assert(nit == graph.neighbors(i).end());
+  }
+
+  CGAL::Neighbor_graph parallel_graph;
+  CGAL::compute_k_neighbor_graph<Concurrency_tag>(tree, k, CGAL::Identity_property_map<std::size_t>(),
+                                                  parallel_graph, distance);
+  assert(parallel_graph.offsets() == graph.offsets());
+  assert(parallel_graph.neighbor_indices() == graph.neighbor_indices());
+}
+
+// the points of the tree carry their index
+void test_point_with_index(const std::vector<Point_3>& points, unsigned int k)
+{
+  typedef std::pair<Point_3, std::size_t> Point_with_index;
+  typedef CGAL::First_of_pair_property_map<Point_with_index> Point_map;
+  typedef CGAL::Second_of_pair_property_map<Point_with_index> Index_map;
+  typedef CGAL::Search_traits_adapter<Point_with_index, Point_map, CGAL::Search_traits_3<Kernel> > Traits;
+  typedef CGAL::Kd_tree<Traits> Tree;
+
+  std::vector<Point_with_index> points_with_index;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_index.emplace_back(points[i], i);
+
+  Tree tree(points_with_index.begin(), points_with_index.end());
+  CGAL::Neighbor_graph graph;
+  CGAL::compute_k_neighbor_graph<Concurrency_tag>(tree, k, Index_map(), graph);
+
+  assert(graph.number_of_points() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    // the first neighbor is the point itself
+    assert(*graph.neighbors(i).begin() == i);
+
+    double previous = 0;
+    for(std::size_t n : graph.neighbors(i))
+    {
+      const double d = CGAL::squared_distance(points[i], points[n]);
+      assert(d >= previous);
+      previous = d;
+    }
+  }
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+
+  std::vector<Point_3> points_3;
+  CGAL::Random_points_in_cube_3<Point_3> gen_3(1., rng);
+  std::copy_n(gen_3, 5000, std::back_inserter(points_3));
+  test<Point_3, CGAL::Search_traits_3<Kernel> >(points_3, 10);
+  test<Point_3, CGAL::Search_traits_3<Kernel> >(points_3, 1);
+  test_point_with_index(points_3, 7);
+
+  // each point first among its duplicates, even when there are more than `k` of them
+  std::vector<Point_3> duplicated_points;
+  for(int i=0; i<12; ++i)
+    duplicated_points.insert(duplicated_points.end(), points_3.begin(), points_3.begin() + 100);
+  test_point_with_index(duplicated_points, 7);
+  test_point_with_index(duplicated_points, 20);
+
+  std::vector<Point_2> points_2;
+  CGAL::Random_points_in_square_2<Point_2> gen_2(1., rng);
+  std::copy_n(gen_2, 3000, std::back_inserter(points_2));
+  test<Point_2, CGAL::Search_traits_2<Kernel> >(points_2, 6);
+
+  // more neighbors than points
+  std::vector<Point_3> few_points(points_3.begin(), points_3.begin() + 5);
+  test<Point_3, CGAL::Search_traits_3<Kernel> >(few_points, 8);
+
+  // no neighbors and no points
+  test<Point_3, CGAL::Search_traits_3<Kernel> >(few_points, 0);
+  test<Point_3, CGAL::Search_traits_3<Kernel> >(std::vector<Point_3>(), 4);
+
+  CGAL::Neighbor_graph graph({0, 2, 3}, {0, 1, 1});
+  assert(graph.number_of_points() == 2);
+  assert(graph.number_of_neighbors(0) == 2);
+  assert(*graph.neighbors(1).begin() == 1);
+  graph.clear();
+  assert(graph.number_of_points() == 0);
+
+  return 0;
+}
@@ -3,6 +3,8 @@
 #include <CGAL/Simple_cartesian.h>
 #include <CGAL/point_generators_2.h>
 #include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/point_generators_3.h>
 #include <CGAL/Search_traits_adapter.h>
 #include <CGAL/Orthogonal_k_neighbor_search.h>
 #include "Point_with_info.h"
@@ -20,6 +22,13 @@ typedef Point_property_map<Point>
 typedef CGAL::Search_traits_adapter<Point_with_info,Ppmap,TreeTraits>                        Traits_with_info;
 typedef CGAL::Distance_adapter <Point_with_info,Ppmap,Neighbor_search::Distance>   Distance_adapter;
 typedef CGAL::Orthogonal_k_neighbor_search<Traits_with_info,Distance_adapter>                         Neighbor_search_with_info;
+//typedefs of trees with a cache of the point coordinates
+typedef CGAL::Sliding_midpoint<TreeTraits>                                          Splitter;
+typedef CGAL::Kd_tree<TreeTraits,Splitter,CGAL::Tag_true,CGAL::Tag_true>            Tree_with_cache;
+typedef CGAL::Orthogonal_k_neighbor_search<TreeTraits,Neighbor_search::Distance,Splitter,Tree_with_cache> Neighbor_search_with_cache;
+typedef CGAL::Sliding_midpoint<Traits_with_info>                                    Splitter_with_info;
+typedef CGAL::Kd_tree<Traits_with_info,Splitter_with_info,CGAL::Tag_true,CGAL::Tag_true> Tree_with_info_and_cache;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits_with_info,Distance_adapter,Splitter_with_info,Tree_with_info_and_cache> Neighbor_search_with_info_and_cache;
 
 template <class K_search>
 bool search(bool nearest)
@@ -94,6 +103,47 @@ bool search(bool nearest)
   return res;
 }
 
+// the searches in a tree with a cache of the point coordinates give the same neighbors
+// at the same distances as in a tree without cache, for any number of neighbors
+bool compare_with_and_without_cache_3()
+{
+  typedef K::Point_3 Point_3;
+  typedef CGAL::Search_traits_3<K> Traits_3;
+  typedef CGAL::Sliding_midpoint<Traits_3> Splitter_3;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits_3> Search_3;
+  typedef CGAL::Kd_tree<Traits_3,Splitter_3,CGAL::Tag_true,CGAL::Tag_true> Tree_3_with_cache;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits_3,Search_3::Distance,Splitter_3,Tree_3_with_cache> Search_3_with_cache;
+
+  CGAL::Random_points_in_cube_3<Point_3> gen(1.);
+  std::vector<Point_3> points;
+  std::copy_n(gen, 2000, std::back_inserter(points));
+  // duplicated points
+  points.insert(points.end(), points.begin(), points.begin() + 100);
+
+  Search_3::Tree tree(points.begin(), points.end(), Splitter_3(25));
+  Tree_3_with_cache tree_with_cache(points.begin(), points.end(), Splitter_3(25));
+  bool res = true;
+  for(unsigned int k : {1, 7, 30})
+  {
+    for(int i=0; i<100; ++i)
+    {
+      const Point_3 query = (i % 2 == 0) ? *gen++ : points[i];
+      Search_3 search(tree, query, k);
+      Search_3_with_cache search_with_cache(tree_with_cache, query, k);
+      std::vector<std::pair<Point_3, double> > result(search.begin(), search.end()),
+                                                result_with_cache(search_with_cache.begin(), search_with_cache.end());
+      if(result.size() != k || result.size() != result_with_cache.size())
+        res = false;
+      for(std::size_t j=0; res && j<result.size(); ++j)
+        if(result[j].second != result_with_cache[j].second)
+          res = false;
+    }
+  }
+  if(!res)
+    std::cout << "Error: different results with the cache of coordinates" << std::endl;
+  return res;
+}
+
 int main()
 {
   bool res=true;
@@ -101,6 +151,11 @@ int main()
   res&=search<Neighbor_search>(false);
   res&=search<Neighbor_search_with_info>(true);
   res&=search<Neighbor_search_with_info>(false);
+  res&=search<Neighbor_search_with_cache>(true);
+  res&=search<Neighbor_search_with_cache>(false);
+  res&=search<Neighbor_search_with_info_and_cache>(true);
+  res&=search<Neighbor_search_with_info_and_cache>(false);
+  res&=compare_with_and_without_cache_3();
   std::cout << "done" << std::endl;
   return res ? 0 : 1;
 }
@@ -96,6 +96,18 @@ the number of edges effectively removed.
                      However, the ordering of the priority queue is no longer strict and there is a possibility
                      that some elements that ought to have been collapsed are not actually collapsed.}
    \cgalParamNEnd
+
+  \cgalParamNBegin{concurrency_tag}
+     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+     \cgalParamDefault{`CGAL::Sequential_tag`}
+     \cgalParamExtra{With `CGAL::Parallel_tag`, the priority queue is not used: edges are collapsed in rounds.
+                     At each round, some of the cheapest edges are selected such that no two of them have
+                     a common vertex or adjacent vertices, their costs, placements and filters are evaluated
+                     concurrently, and they are collapsed. The result thus differs from the sequential one,
+                     but it does not depend on the number of threads. The policies must be safe to call concurrently,
+                     and `use_relaxed_order` is ignored.}
+   \cgalParamNEnd
 \cgalNamedParamsEnd
 
 \cgalHeading{Semantics}
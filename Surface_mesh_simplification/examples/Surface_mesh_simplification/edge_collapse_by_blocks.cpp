@@ -0,0 +1,50 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse_by_blocks.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                Kernel;
+typedef Kernel::Point_3                                               Point_3;
+typedef CGAL::Surface_mesh<Point_3>                                   Surface_mesh;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef SMS::GarlandHeckbert_plane_policies<Surface_mesh, Kernel>     GH_policies;
+
+// Usage:
+// ./edge_collapse_by_blocks [ratio] [block_0.ply block_1.ply ...]
+int main(int argc, char** argv)
+{
+  const double ratio = (argc > 1) ? std::stod(argv[1]) : 0.1;
+
+  // the blocks of the mesh, which share their common borders
+  std::vector<std::string> blocks;
+  for(int i=2; i<argc; ++i)
+    blocks.push_back(argv[i]);
+  if(blocks.empty())
+    blocks.push_back(CGAL::data_file_path("meshes/elephant.off"));
+
+  // only one block is in memory at any time
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(ratio);
+
+  std::vector<std::string> outputs;
+  if(!SMS::edge_collapse_by_blocks<Surface_mesh, GH_policies>(blocks, stop, "simplified_",
+                                                              std::back_inserter(outputs)))
+  {
+    std::cerr << "Error: the blocks could not be simplified" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "The simplified mesh is made of " << outputs.size() << " blocks:" << std::endl;
+  for(const std::string& filename : outputs)
+    std::cout << "  " << filename << std::endl;
+
+  return EXIT_SUCCESS;
+}
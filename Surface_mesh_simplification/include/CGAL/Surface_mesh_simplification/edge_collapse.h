@@ -26,6 +26,7 @@ namespace Surface_mesh_simplification {
 namespace internal {
 
 template<bool use_relaxed_order,
+         class ConcurrencyTag,
          class TM,
          class GT,
          class ShouldStop,
@@ -57,7 +58,7 @@ int edge_collapse(TM& tmesh,
 
   Algorithm algorithm(tmesh, traits, should_stop, vim, vpm, him, ecm, get_cost, get_placement, should_ignore, visitor);
 
-  return algorithm.run();
+  return algorithm.template run<ConcurrencyTag>();
 }
 
 struct Dummy_visitor
@@ -93,8 +94,10 @@ int edge_collapse(TM& tmesh,
   typedef typename GetGeomTraits<TM, NamedParameters>::type                   Geom_traits;
   typedef typename internal_np::Lookup_named_param_def <
     internal_np::use_relaxed_order_t, NamedParameters, Tag_false> ::type  Use_relaxed_order;
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t, NamedParameters, Sequential_tag> ::type Concurrency_tag;
 
-  return internal::edge_collapse<Use_relaxed_order::value>
+  return internal::edge_collapse<Use_relaxed_order::value, Concurrency_tag>
                                 (tmesh, should_stop,
                                  choose_parameter<Geom_traits>(get_parameter(np, internal_np::geom_traits)),
                                  CGAL::get_initialized_vertex_index_map(tmesh, np),
@@ -0,0 +1,506 @@
+// Copyright (c) 2025  GeometryFactory (France). All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mael Rouxel-Labbé
+//
+#ifndef CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_BY_BLOCKS_H
+#define CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_BY_BLOCKS_H
+
+#include <CGAL/license/Surface_mesh_simplification.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Constrained_placement.h>
+
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/property_map.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace CGAL {
+namespace Surface_mesh_simplification {
+namespace internal {
+
+// Rejects the collapses that would create an edge between two border vertices:
+// such an edge might already exist in the adjacent block
+template <typename BaseFilter>
+struct Block_border_filter
+{
+  Block_border_filter(const BaseFilter& base) : m_base(base) { }
+
+  template <typename Profile>
+  std::optional<typename Profile::Point>
+  operator()(const Profile& profile, std::optional<typename Profile::Point> op) const
+  {
+    op = m_base(profile, op);
+    if(!op)
+      return op;
+
+    const typename Profile::TM& tm = profile.surface_mesh();
+    const bool is_v0_on_border = bool(is_border(profile.v0(), tm));
+    if(is_v0_on_border == bool(is_border(profile.v1(), tm)))
+      return op;
+
+    const auto kept = is_v0_on_border ? profile.v0() : profile.v1();
+    const auto removed = is_v0_on_border ? profile.v1() : profile.v0();
+    for(auto w : vertices_around_target(removed, tm))
+    {
+      if(w != kept && is_border(w, tm) && !halfedge(w, kept, tm).second)
+        return std::nullopt;
+    }
+
+    return op;
+  }
+
+private:
+  BaseFilter m_base;
+};
+
+// Calls the user stop predicate as if the mesh only had the edges of the region to simplify
+template <typename ShouldStop>
+struct Region_stop_predicate
+{
+  Region_stop_predicate(const ShouldStop& should_stop, const std::size_t region_edge_count)
+    : m_should_stop(should_stop), m_region_edge_count(region_edge_count)
+  { }
+
+  template <typename F, typename Profile, typename Size_type>
+  bool operator()(const F& current_cost,
+                  const Profile& profile,
+                  const Size_type initial_edge_count,
+                  const Size_type current_edge_count) const
+  {
+    const Size_type removed = initial_edge_count - current_edge_count;
+    const Size_type region_count = Size_type(m_region_edge_count);
+    return m_should_stop(current_cost, profile, region_count,
+                         (removed < region_count) ? region_count - removed : Size_type(0));
+  }
+
+private:
+  const ShouldStop& m_should_stop;
+  const std::size_t m_region_edge_count;
+};
+
+// Triangles are exchanged between the passes through temporary binary files:
+// three points in double precision, and a bit per vertex telling whether
+// the vertex was on the border of the block that produced the triangle
+struct Block_triangle
+{
+  std::array<double, 9> coordinates;
+  unsigned char on_block_border;
+};
+
+// returns `false` if the file could not be opened or written
+inline bool write_block_triangles(const std::string& filename,
+                                  const std::vector<Block_triangle>& triangles,
+                                  const bool append)
+{
+  std::ofstream os(filename, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+  for(const Block_triangle& t : triangles)
+  {
+    os.write(reinterpret_cast<const char*>(t.coordinates.data()), 9 * sizeof(double));
+    os.write(reinterpret_cast<const char*>(&t.on_block_border), 1);
+  }
+  os.close();
+  return !os.fail();
+}
+
+inline std::vector<Block_triangle> read_block_triangles(const std::string& filename)
+{
+  std::vector<Block_triangle> triangles;
+  std::ifstream is(filename, std::ios::binary);
+  Block_triangle t;
+  while(is.read(reinterpret_cast<char*>(t.coordinates.data()), 9 * sizeof(double)) &&
+        is.read(reinterpret_cast<char*>(&t.on_block_border), 1))
+    triangles.push_back(t);
+
+  return triangles;
+}
+
+// Collapses the edges of `tm` with a vertex in the region, keeping the border fixed.
+// The constrained edges are marked before the simplification, as the region changes
+// with the collapses. The stop predicate only sees the edges of the region, that is
+// three edges per vertex (a triangle mesh has about three times as many edges as vertices)
+template <typename Policies, typename TM, typename ShouldStop, typename InRegionMap, typename NamedParameters>
+void simplify_block(TM& tm,
+                    const ShouldStop& should_stop,
+                    const InRegionMap& in_region,
+                    const NamedParameters& np)
+{
+  typedef typename boost::property_map<TM, CGAL::dynamic_edge_property_t<bool> >::type ECM;
+  typedef Constrained_placement<typename Policies::Get_placement, ECM>                  Placement;
+  typedef typename internal_np::Lookup_named_param_def<
+    internal_np::filter_t, NamedParameters, Dummy_filter>::type                        Base_filter;
+
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  ECM ecm = get(CGAL::dynamic_edge_property_t<bool>(), tm, false);
+  for(auto e : edges(tm))
+    if(is_border(e, tm) || (!get(in_region, source(e, tm)) && !get(in_region, target(e, tm))))
+      put(ecm, e, true);
+
+  std::size_t region_edge_count = 0;
+  for(auto v : vertices(tm))
+    if(get(in_region, v) && !is_border(v, tm))
+      region_edge_count += 3;
+
+  if(region_edge_count == 0)
+    return;
+
+  Policies policies(tm);
+  Placement placement(ecm, policies.get_placement());
+  Block_border_filter<Base_filter> filter(choose_parameter<Dummy_filter>(get_parameter(np, internal_np::filter)));
+
+  edge_collapse(tm, Region_stop_predicate<ShouldStop>(should_stop, region_edge_count),
+                np.edge_is_constrained_map(ecm)
+                  .get_cost(policies.get_cost())
+                  .get_placement(placement)
+                  .filter(filter));
+}
+
+template <typename TM, typename VPM>
+std::vector<Block_triangle> block_triangles(const TM& tm, const VPM vpm)
+{
+  std::vector<Block_triangle> triangles;
+  triangles.reserve(num_faces(tm));
+  for(auto f : faces(tm))
+  {
+    Block_triangle t;
+    t.on_block_border = 0;
+    int i = 0;
+    for(auto h : halfedges_around_face(halfedge(f, tm), tm))
+    {
+      const auto& p = get(vpm, target(h, tm));
+      t.coordinates[3*i] = CGAL::to_double(p.x());
+      t.coordinates[3*i + 1] = CGAL::to_double(p.y());
+      t.coordinates[3*i + 2] = CGAL::to_double(p.z());
+      if(is_border(target(h, tm), tm))
+        t.on_block_border |= (1 << i);
+      ++i;
+    }
+    triangles.push_back(t);
+  }
+
+  return triangles;
+}
+
+// Positions along each axis of the borders of the cells of the second pass. Two blocks are
+// side by side along an axis if their bounding boxes overlap by less than half their extents
+// along this axis, and by at least half their extents along the two other axes: they then
+// have a common border, which lies where their boxes meet. The cells are delimited halfway
+// between consecutive such borders, and between the first and last ones and the ends of the
+// blocks, so that each border is inside a cell. An axis along which the blocks are not split
+// gets no cell border.
+inline std::array<std::vector<double>, 3> cell_borders(const std::vector<Bbox_3>& block_bboxes)
+{
+  auto overlap = [](const Bbox_3& a, const Bbox_3& b, int i)
+  {
+    return (std::min)(a.max(i), b.max(i)) - (std::max)(a.min(i), b.min(i));
+  };
+  auto smallest_extent = [](const Bbox_3& a, const Bbox_3& b, int i)
+  {
+    return (std::min)(a.max(i) - a.min(i), b.max(i) - b.min(i));
+  };
+
+  std::array<std::vector<std::pair<double, double> >, 3> block_borders;
+  for(std::size_t a=0; a<block_bboxes.size(); ++a)
+  {
+    for(std::size_t b=a+1; b<block_bboxes.size(); ++b)
+    {
+      const Bbox_3& ba = block_bboxes[a];
+      const Bbox_3& bb = block_bboxes[b];
+      for(int i=0; i<3; ++i)
+      {
+        const double o = overlap(ba, bb, i);
+        if(o < 0 || !(o < 0.5 * smallest_extent(ba, bb, i)))
+          continue;
+
+        bool side_by_side = true;
+        for(int j=1; j<3; ++j)
+          if(overlap(ba, bb, (i+j)%3) < 0.5 * smallest_extent(ba, bb, (i+j)%3))
+            side_by_side = false;
+
+        if(side_by_side)
+          block_borders[i].emplace_back((std::max)(ba.min(i), bb.min(i)), (std::min)(ba.max(i), bb.max(i)));
+      }
+    }
+  }
+
+  Bbox_3 bbox;
+  for(const Bbox_3& bb : block_bboxes)
+    bbox += bb;
+
+  std::array<std::vector<double>, 3> borders;
+  for(int i=0; i<3; ++i)
+  {
+    if(block_borders[i].empty())
+      continue;
+
+    // the borders of the blocks along a same plane overlap, and are merged
+    std::sort(block_borders[i].begin(), block_borders[i].end());
+    double previous_max = bbox.min(i);
+    for(const std::pair<double, double>& border : block_borders[i])
+    {
+      if(border.first > previous_max)
+        borders[i].push_back(0.5 * (previous_max + border.first));
+      previous_max = (std::max)(previous_max, border.second);
+    }
+    borders[i].push_back(0.5 * (previous_max + bbox.max(i)));
+  }
+
+  return borders;
+}
+
+} // namespace internal
+
+/*!
+\ingroup PkgSurfaceMeshSimplificationRef
+
+simplifies a triangle mesh which is given as a set of blocks stored in files, such as the tiles
+of a large photogrammetry mesh, without ever loading the whole mesh in memory.
+The simplified mesh is written into a new set of files.
+
+Adjacent blocks must share their common border: the vertices of the border of a block
+must have the same coordinates as the corresponding vertices of the adjacent blocks.
+The output files share their common border in the same way.
+
+The simplification is done in three passes, and at most one block (or one cell, see below)
+is in memory at any time:
+- each block is read and simplified with `edge_collapse()`, using the cost and placement
+  of `Policies`. The border edges of the block are constrained with the named parameter `edge_is_constrained_map`,
+  and their vertices do not move (see `Constrained_placement`), so that adjacent blocks still match.
+  The simplified block is written to a temporary file;
+- the triangles of the simplified blocks are distributed into cells, which are derived from
+  the bounding boxes of the blocks: along each axis, the borders of the cells are halfway between
+  the consecutive borders of blocks that are side by side along this axis, and between the first
+  and last of these borders and the ends of the blocks. When the blocks are the tiles
+  of a grid, whose sizes may differ, each cell thus contains a border of the grid along each axis
+  that splits the blocks, and no cell border is placed along an axis that does not split them,
+  such as the vertical axis of the tiles of a terrain. Otherwise, for example if the rows of blocks
+  are shifted, the parts of the borders of the blocks that are on a border of a cell are not simplified;
+- each cell is read, and its triangles are stitched into a mesh: the borders of the blocks
+  that are inside the cell are thus merged. The edges around these former borders, which could not be
+  simplified during the first pass, are then simplified, with the border of the cell constrained.
+  The mesh is finally written to the file `output_prefix` followed by the index of the cell and `.ply`.
+
+In both simplification passes, the collapses which would create an edge between two vertices
+of the border are rejected, as such an edge might already exist in the adjacent block or cell.
+
+The stop predicate is evaluated for each block and each cell independently, and only counts the edges
+which can be collapsed: the interior edges of a block, and the edges around the former borders
+of the blocks in a cell. Their number is taken as three times the number of vertices that can be removed.
+Predicates such as `Edge_count_ratio_stop_predicate` and `Edge_length_stop_predicate` thus keep their meaning,
+but `Edge_count_stop_predicate` applies to each block.
+
+The temporary files are named after `output_prefix`, and are removed before the function returns.
+The points are stored in double precision in these files.
+
+@tparam TriangleMesh a model of `MutableFaceGraph` and `HalfedgeListGraph`, with an internal property map
+                     for `CGAL::vertex_point_t`, used to store each block in memory
+@tparam Policies a class that can be constructed from a `TriangleMesh&` and which provides
+                 the member functions `get_cost()` and `get_placement()`, which return models
+                 of `GetCost` and `GetPlacement`, such as `GarlandHeckbert_plane_policies`
+@tparam InputFileRange a model of `ConstRange` with `std::string` as value type
+@tparam StopPolicy a model of `StopPredicate`
+@tparam OutputIterator an output iterator accepting `std::string`
+@tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+@param input_files the names of the files storing the blocks, in a format supported by
+                   `CGAL::Polygon_mesh_processing::IO::read_polygon_mesh()`
+@param should_stop the stop-condition policy
+@param output_prefix the prefix of the names of the output files
+@param output_files the output iterator into which the names of the output files are written
+@param np an optional sequence of \ref bgl_namedparameters "Named Parameters", which are passed to `edge_collapse()`.
+          The named parameters `vertex_point_map`, `edge_is_constrained_map`, `get_cost`, and `get_placement` are ignored.
+
+@return `false` if a block could not be read or is not a triangle mesh, or if a file could not be written, and `true` otherwise
+
+\sa `CGAL::Surface_mesh_simplification::edge_collapse()`
+*/
+template <typename TriangleMesh,
+          typename Policies,
+          typename InputFileRange,
+          typename StopPolicy,
+          typename OutputIterator,
+          typename NamedParameters = parameters::Default_named_parameters>
+bool edge_collapse_by_blocks(const InputFileRange& input_files,
+                             const StopPolicy& should_stop,
+                             const std::string& output_prefix,
+                             OutputIterator output_files,
+                             const NamedParameters& np = parameters::default_values())
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+
+  typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor       vertex_descriptor;
+  typedef typename GetVertexPointMap<TriangleMesh>::const_type               VPM;
+  typedef typename boost::property_traits<VPM>::value_type                   Point;
+  typedef std::array<double, 3>                                              Coordinates;
+  typedef std::array<long, 3>                                                Cell;
+
+  std::vector<std::string> temporary_files;
+  auto remove_temporary_files = [&temporary_files]()
+  {
+    for(const std::string& name : temporary_files)
+      std::remove(name.c_str());
+  };
+
+  // first pass: simplify the interior of each block
+  std::vector<Bbox_3> block_bboxes;
+  for(const std::string& filename : input_files)
+  {
+    TriangleMesh tm;
+    if(!PMP::IO::read_polygon_mesh(filename, tm) || !is_triangle_mesh(tm))
+    {
+      remove_temporary_files();
+      return false;
+    }
+
+    internal::simplify_block<Policies>(tm, should_stop,
+                                       Constant_property_map<vertex_descriptor, bool>(true), np);
+
+    const VPM vpm = get_const_property_map(vertex_point, tm);
+    Bbox_3 bb;
+    for(vertex_descriptor v : vertices(tm))
+      bb += get(vpm, v).bbox();
+    block_bboxes.push_back(bb);
+
+    temporary_files.push_back(output_prefix + "_block_" + std::to_string(temporary_files.size()) + ".tmp");
+    if(!internal::write_block_triangles(temporary_files.back(), internal::block_triangles(tm, vpm), false /*append*/))
+    {
+      remove_temporary_files();
+      return false;
+    }
+  }
+
+  if(block_bboxes.empty())
+    return true;
+
+  // second pass: distribute the triangles into cells which contain the borders of the blocks
+  const std::array<std::vector<double>, 3> borders = internal::cell_borders(block_bboxes);
+
+  std::map<Cell, std::size_t> cell_ids;
+  std::vector<std::string> cell_files;
+  const std::size_t nb_blocks = temporary_files.size();
+  for(std::size_t b=0; b<nb_blocks; ++b)
+  {
+    std::map<std::size_t, std::vector<internal::Block_triangle> > triangles_per_cell;
+    for(const internal::Block_triangle& t : internal::read_block_triangles(temporary_files[b]))
+    {
+      Cell c;
+      for(int i=0; i<3; ++i)
+      {
+        const double centroid = (t.coordinates[i] + t.coordinates[3 + i] + t.coordinates[6 + i]) / 3.;
+        c[i] = static_cast<long>(std::upper_bound(borders[i].begin(), borders[i].end(), centroid) -
+                                 borders[i].begin());
+      }
+
+      auto res = cell_ids.emplace(c, cell_ids.size());
+      if(res.second)
+        cell_files.push_back(output_prefix + "_cell_" + std::to_string(res.first->second) + ".tmp");
+      triangles_per_cell[res.first->second].push_back(t);
+    }
+
+    std::remove(temporary_files[b].c_str());
+    for(const auto& cell_triangles : triangles_per_cell)
+    {
+      if(!internal::write_block_triangles(cell_files[cell_triangles.first], cell_triangles.second, true /*append*/))
+      {
+        temporary_files.erase(temporary_files.begin(), temporary_files.begin() + b + 1);
+        temporary_files.insert(temporary_files.end(), cell_files.begin(), cell_files.end());
+        remove_temporary_files();
+        return false;
+      }
+    }
+  }
+
+  temporary_files = cell_files;
+
+  // third pass: stitch the blocks within each cell, and simplify around their former borders
+  for(std::size_t c=0; c<cell_files.size(); ++c)
+  {
+    std::map<Coordinates, std::size_t> point_ids;
+    std::vector<Point> points;
+    std::vector<bool> on_block_border;
+    std::vector<std::array<std::size_t, 3> > triangles;
+    for(const internal::Block_triangle& t : internal::read_block_triangles(cell_files[c]))
+    {
+      std::array<std::size_t, 3> triangle;
+      for(int i=0; i<3; ++i)
+      {
+        const Coordinates p = { t.coordinates[3*i], t.coordinates[3*i + 1], t.coordinates[3*i + 2] };
+        auto res = point_ids.emplace(p, points.size());
+        if(res.second)
+        {
+          points.emplace_back(p[0], p[1], p[2]);
+          on_block_border.push_back(false);
+        }
+        if(t.on_block_border & (1 << i))
+          on_block_border[res.first->second] = true;
+        triangle[i] = res.first->second;
+      }
+      triangles.push_back(triangle);
+    }
+    std::remove(cell_files[c].c_str());
+
+    if(!PMP::is_polygon_soup_a_polygon_mesh(triangles))
+      PMP::orient_polygon_soup(points, triangles);
+
+    TriangleMesh tm;
+    PMP::polygon_soup_to_polygon_mesh(points, triangles, tm);
+
+    // the region to simplify is made of the vertices of the borders of the blocks
+    // which are now inside the cell. Their neighbors have already been simplified:
+    // they are incident to constrained edges, and thus do not move
+    typedef typename boost::property_map<TriangleMesh, CGAL::dynamic_vertex_property_t<bool> >::type In_region_map;
+    In_region_map in_region = get(CGAL::dynamic_vertex_property_t<bool>(), tm, false);
+
+    const VPM vpm = get_const_property_map(vertex_point, tm);
+    for(vertex_descriptor v : vertices(tm))
+    {
+      const Point& p = get(vpm, v);
+      const Coordinates pc = { CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()) };
+      if(on_block_border[point_ids.at(pc)] && !is_border(v, tm))
+        put(in_region, v, true);
+    }
+
+    internal::simplify_block<Policies>(tm, should_stop, in_region, np);
+
+    const std::string filename = output_prefix + std::to_string(c) + ".ply";
+    if(!CGAL::IO::write_polygon_mesh(filename, tm, parameters::stream_precision(17)))
+    {
+      temporary_files.erase(temporary_files.begin(), temporary_files.begin() + c + 1);
+      remove_temporary_files();
+      return false;
+    }
+
+    *output_files++ = filename;
+  }
+
+  return true;
+}
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_BY_BLOCKS_H
@@ -19,10 +19,20 @@
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/scoped_array.hpp>
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -212,6 +222,8 @@ public:
                const Should_ignore& should_ignore,
                Visitor visitor);
 
+  // With `Parallel_tag`, the edges are collapsed in rounds (see `loop_in_rounds()`)
+  template <typename ConcurrencyTag = Sequential_tag>
   int run();
 
 public:
@@ -221,14 +233,20 @@ public:
   const Vertex_point_map& vpm() const { return m_vpm; }
 
 private:
+  template <typename ConcurrencyTag>
   void collect();
   void loop();
+  template <typename ConcurrencyTag>
+  void loop_in_rounds();
+  bool lock_collapse_region(const halfedge_descriptor h,
+                            std::vector<size_type>& vertex_rounds,
+                            const size_type round) const;
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
-  void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
 
   Profile create_profile(const halfedge_descriptor h) {
@@ -446,6 +464,7 @@ EdgeCollapse(Triangle_mesh& tmesh,
 }
 
 template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template <typename ConcurrencyTag>
 int
 EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
 run()
@@ -457,11 +476,14 @@ run()
   // this is similar to the visitor, but for the cost/stop/placement oracles
   internal::Oracles_initializer<Self>(*this)();
 
-  // First collect all candidate edges in a PQ
-  collect();
+  // First collect all candidate edges (in a PQ, if sequential)
+  collect<ConcurrencyTag>();
 
-  // Then proceed to collapse each edge in turn
-  loop();
+  // Then proceed to collapse each edge in turn, or independent edges in rounds
+  if constexpr(std::is_same_v<ConcurrencyTag, Parallel_tag>)
+    loop_in_rounds<ConcurrencyTag>();
+  else
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -473,6 +495,7 @@ run()
 }
 
 template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template <typename ConcurrencyTag>
 void
 EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
 collect()
@@ -484,8 +507,29 @@ collect()
   const size_type ne = num_edges(m_tm); // if the mesh has garbage, you might have "ne > edges(tm).size()"
   m_initial_edge_count = m_current_edge_count = size_type(edges(m_tm).size());
 
+  constexpr bool parallel_execution = std::is_same_v<ConcurrencyTag, Parallel_tag>;
+
   m_edge_data.reset(new Edge_data[ne]);
-  mPQ.reset(new PQ(ne, Compare_cost(this), edge_id(this)));
+  if(!parallel_execution) // no PQ when collapsing in rounds
+    mPQ.reset(new PQ(ne, Compare_cost(this), edge_id(this)));
+
+  if constexpr(parallel_execution)
+  {
+    // the costs are computed concurrently, and then collected below
+    std::vector<halfedge_descriptor> hs;
+    hs.reserve(size_type(edges(m_tm).size()));
+    for(edge_descriptor e : edges(m_tm))
+      if(!is_constrained(halfedge(e, m_tm)))
+        hs.push_back(halfedge(e, m_tm));
+
+    CGAL::for_each<ConcurrencyTag>(hs, [&](const halfedge_descriptor h)
+    {
+      const Profile profile = create_profile(h);
+      if(!m_traits.equal_3_object()(profile.p0(), profile.p1()))
+        get_data(h).cost() = cost(profile);
+      return true;
+    });
+  }
 
   CGAL_assertion_code(size_type num_inserted = 0);
   CGAL_assertion_code(size_type num_not_inserted = 0);
@@ -507,8 +551,11 @@ collect()
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
-      insert_in_PQ(h, data);
+      if(!parallel_execution)
+      {
+        data.cost() = cost(profile);
+        insert_in_PQ(h, data);
+      }
 
       m_visitor.OnCollected(profile, data.cost());
 
@@ -631,7 +678,7 @@ loop()
                                        << " " << get(m_vpm, target(*h, m_tm)) << "\n";
 #endif
           if(m_should_ignore(profile, placement)!= std::nullopt){
-            collapse(profile, placement);
+            update_neighbors(collapse(profile, placement));
           }
           else
           {
@@ -670,6 +717,197 @@ loop()
   }
 }
 
+// Collapses edges in rounds, instead of one at a time in the order of the PQ.
+// At each round, the cheapest candidate edges are selected greedily, such that the regions
+// of their collapses (their vertices and the neighbors of these) are pairwise disjoint.
+// A collapse then neither reads nor modifies the region of another collapse of the round:
+// their validity and placement are computed concurrently, and they are performed in turn.
+// Only the costs of the edges around the modified regions are updated for the next round.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template <typename ConcurrencyTag>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+loop_in_rounds()
+{
+  CGAL_SMS_TRACE(0, "Collapsing edges in rounds...");
+
+  enum Collapse_status { COLLAPSIBLE, NON_COLLAPSIBLE, GEOMETRICALLY_INVALID };
+
+  struct Selected_edge
+  {
+    Selected_edge(const Profile& profile) : profile(profile), status(NON_COLLAPSIBLE) { }
+
+    Profile profile;
+    Placement_type placement;
+    Collapse_status status;
+  };
+
+  size_type nb_vertex_ids = 0;
+  for(vertex_descriptor v : vertices(m_tm))
+    nb_vertex_ids = (std::max)(nb_vertex_ids, size_type(get(m_vim, v)) + 1);
+  std::vector<size_type> vertex_rounds(nb_vertex_ids, 0);
+
+  auto is_cheaper = [&](const halfedge_descriptor a, const halfedge_descriptor b)
+  {
+    const FT& ca = *(get_data(a).cost());
+    const FT& cb = *(get_data(b).cost());
+    return ca < cb || (!(cb < ca) && get_halfedge_id(a) < get_halfedge_id(b));
+  };
+
+  std::vector<halfedge_descriptor> candidates, edges_to_update;
+  std::vector<Selected_edge> selected_edges;
+  std::vector<vertex_descriptor> kept_vertices;
+
+  for(size_type round = 1; ; ++round)
+  {
+    // (A) the candidates are the unconstrained edges with a cost, the cheapest are considered first
+    candidates.clear();
+    for(edge_descriptor e : edges(m_tm))
+    {
+      const halfedge_descriptor h = primary_edge(halfedge(e, m_tm));
+      if(!is_constrained(h) && get_data(h).cost())
+        candidates.push_back(h);
+    }
+
+    if(candidates.empty())
+      break;
+
+    // only the cheapest quarter is considered, so that the order of the collapses stays close
+    // to the sequential one while keeping rounds large
+    const std::size_t nb_considered = (std::max)(std::size_t(1), candidates.size() / 4);
+    std::nth_element(candidates.begin(), candidates.begin() + (nb_considered - 1), candidates.end(), is_cheaper);
+    candidates.resize(nb_considered);
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr(std::is_same_v<ConcurrencyTag, Parallel_tag>)
+      tbb::parallel_sort(candidates.begin(), candidates.end(), is_cheaper);
+    else
+#endif
+      std::sort(candidates.begin(), candidates.end(), is_cheaper);
+
+    // (B) greedy selection of independent edges
+    selected_edges.clear();
+    size_type expected_edge_count = m_current_edge_count;
+    bool stop = false;
+
+    for(halfedge_descriptor h : candidates)
+    {
+      if(!lock_collapse_region(h, vertex_rounds, round))
+        continue;
+
+      const Profile profile = create_profile(h);
+      const Cost_type& cost = get_data(h).cost();
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, expected_edge_count);
+
+      if(m_should_stop(*cost, profile, m_initial_edge_count, expected_edge_count))
+      {
+        if(selected_edges.empty())
+        {
+          m_visitor.OnStopConditionReached(profile);
+
+          CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                              << " current edge count=" << m_current_edge_count
+                              << " current edge: " << edge_to_string(h));
+          stop = true;
+        }
+        break;
+      }
+
+      selected_edges.emplace_back(profile);
+      expected_edge_count -= 1 + (profile.left_face_exists() ? 1 : 0) + (profile.right_face_exists() ? 1 : 0);
+    }
+
+    if(stop)
+      break;
+
+    CGAL_SMS_TRACE(1, "Round " << round << ": " << selected_edges.size() << " selected edges");
+
+    // (C) validity and placement of the selected edges
+    CGAL::for_each<ConcurrencyTag>(selected_edges, [&](Selected_edge& se)
+    {
+      if(!is_collapse_topologically_valid(se.profile))
+        return true;
+
+      se.placement = get_placement(se.profile);
+      if(!is_collapse_geometrically_valid(se.profile, se.placement))
+        se.status = GEOMETRICALLY_INVALID;
+      else if(m_should_ignore(se.profile, se.placement) != std::nullopt)
+        se.status = COLLAPSIBLE;
+
+      return true;
+    });
+
+    // (D) collapses
+    kept_vertices.clear();
+    for(const Selected_edge& se : selected_edges)
+    {
+      if(se.status == COLLAPSIBLE)
+      {
+        kept_vertices.push_back(collapse(se.profile, se.placement));
+      }
+      else
+      {
+        // as in the PQ, the edge is no longer a candidate until its cost is updated
+        get_data(se.profile.v0_v1()).cost() = std::nullopt;
+
+        if(se.status == NON_COLLAPSIBLE)
+        {
+          m_visitor.OnNonCollapsable(se.profile);
+
+          CGAL_SMS_TRACE(1, edge_to_string(se.profile.v0_v1()) << " NOT Collapsible" );
+        }
+      }
+    }
+
+    // (E) update the costs of the edges around the vertices adjacent to the vertices kept
+    edges_to_update.clear();
+    for(vertex_descriptor v_kept : kept_vertices)
+    {
+      for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
+      {
+        for(halfedge_descriptor h2 : halfedges_around_target(source(h, m_tm), m_tm))
+        {
+          h2 = primary_edge(h2);
+          if(!is_constrained(h2))
+            edges_to_update.push_back(h2);
+        }
+      }
+    }
+
+    std::sort(edges_to_update.begin(), edges_to_update.end(), Compare_id(this));
+    edges_to_update.erase(std::unique(edges_to_update.begin(), edges_to_update.end()), edges_to_update.end());
+
+    CGAL::for_each<ConcurrencyTag>(edges_to_update, [&](const halfedge_descriptor h)
+    {
+      get_data(h).cost() = cost(create_profile(h));
+      return true;
+    });
+  }
+}
+
+// Marks the region of the collapse of `h` (its vertices and their neighbors) as used in `round`,
+// if none of its vertices is already used in `round`.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+bool
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+lock_collapse_region(const halfedge_descriptor h,
+                     std::vector<size_type>& vertex_rounds,
+                     const size_type round) const
+{
+  const vertex_descriptor vs[2] = { source(h, m_tm), target(h, m_tm) };
+
+  for(vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+      if(vertex_rounds[get(m_vim, source(hv, m_tm))] == round)
+        return false;
+
+  for(vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+      vertex_rounds[get(m_vim, source(hv, m_tm))] = round;
+
+  return true;
+}
+
 template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
 bool
 EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
@@ -1117,7 +1355,7 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 }
 
 template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-void
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
 EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
 collapse(const Profile& profile,
          Placement_type placement)
@@ -1214,9 +1452,9 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
 template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
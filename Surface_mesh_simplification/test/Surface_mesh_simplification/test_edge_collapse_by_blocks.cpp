@@ -0,0 +1,203 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse_by_blocks.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_normal_change_filter.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>
+
+#include <CGAL/Polygon_mesh_processing/distance.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+typedef CGAL::Surface_mesh<Point_3>                         Surface_mesh;
+
+typedef std::array<std::size_t, 3>                          Triangle;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+typedef SMS::GarlandHeckbert_plane_policies<Surface_mesh, K> GH_policies;
+
+// splits the mesh into blocks along x and y, using the centroids of the faces.
+// The splits are given as fractions of the extent of the mesh along each axis
+std::vector<std::string> write_blocks(const Surface_mesh& sm,
+                                      const std::vector<double>& x_splits,
+                                      const std::vector<double>& y_splits)
+{
+  const CGAL::Bbox_3 bb = PMP::bbox(sm);
+  const int nb_x = int(x_splits.size()) + 1;
+  const int nb_y = int(y_splits.size()) + 1;
+
+  std::vector<std::vector<Point_3> > points(nb_x * nb_y);
+  std::vector<std::vector<Triangle> > triangles(nb_x * nb_y);
+  std::vector<std::map<Surface_mesh::Vertex_index, std::size_t> > ids(nb_x * nb_y);
+  for(Surface_mesh::Face_index f : faces(sm))
+  {
+    const Point_3 c = CGAL::centroid(sm.point(source(halfedge(f, sm), sm)),
+                                     sm.point(target(halfedge(f, sm), sm)),
+                                     sm.point(target(next(halfedge(f, sm), sm), sm)));
+    const double fx = (c.x() - bb.xmin()) / (bb.xmax() - bb.xmin());
+    const double fy = (c.y() - bb.ymin()) / (bb.ymax() - bb.ymin());
+    const int i = int(std::upper_bound(x_splits.begin(), x_splits.end(), fx) - x_splits.begin());
+    const int j = int(std::upper_bound(y_splits.begin(), y_splits.end(), fy) - y_splits.begin());
+    const int b = i * nb_y + j;
+
+    Triangle t;
+    int k = 0;
+    for(Surface_mesh::Vertex_index v : vertices_around_face(halfedge(f, sm), sm))
+    {
+      auto res = ids[b].emplace(v, points[b].size());
+      if(res.second)
+        points[b].push_back(sm.point(v));
+      t[k++] = res.first->second;
+    }
+    triangles[b].push_back(t);
+  }
+
+  std::vector<std::string> filenames;
+  for(int b=0; b<nb_x*nb_y; ++b)
+  {
+    if(triangles[b].empty())
+      continue;
+
+    filenames.push_back("block_" + std::to_string(b) + ".ply");
+    bool ok = CGAL::IO::write_polygon_soup(filenames.back(), points[b], triangles[b]);
+    assert(ok);
+    CGAL_USE(ok);
+  }
+
+  return filenames;
+}
+
+// merges the output files into a single mesh, with no tolerance
+Surface_mesh read_output(const std::vector<std::string>& filenames)
+{
+  std::map<Point_3, std::size_t> ids;
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  for(const std::string& filename : filenames)
+  {
+    Surface_mesh block;
+    bool ok = CGAL::IO::read_polygon_mesh(filename, block);
+    assert(ok);
+    CGAL_USE(ok);
+
+    for(Surface_mesh::Face_index f : faces(block))
+    {
+      Triangle t;
+      int k = 0;
+      for(Surface_mesh::Vertex_index v : vertices_around_face(halfedge(f, block), block))
+      {
+        auto res = ids.emplace(block.point(v), points.size());
+        if(res.second)
+          points.push_back(block.point(v));
+        t[k++] = res.first->second;
+      }
+      triangles.push_back(t);
+    }
+  }
+
+  assert(PMP::is_polygon_soup_a_polygon_mesh(triangles));
+  Surface_mesh sm;
+  PMP::polygon_soup_to_polygon_mesh(points, triangles, sm);
+  return sm;
+}
+
+void test(const Surface_mesh& input,
+          const std::vector<double>& x_splits,
+          const std::vector<double>& y_splits,
+          const double ratio)
+{
+  std::cout << "  " << x_splits.size() + 1 << "x" << y_splits.size() + 1 << " blocks" << std::endl;
+
+  const std::vector<std::string> blocks = write_blocks(input, x_splits, y_splits);
+
+  std::vector<std::string> outputs;
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(ratio);
+  bool ok = SMS::edge_collapse_by_blocks<Surface_mesh, GH_policies>(blocks, stop, "simplified_",
+                                                                    std::back_inserter(outputs),
+                                                                    CGAL::parameters::filter(SMS::Bounded_normal_change_filter<>()));
+  assert(ok);
+  CGAL_USE(ok);
+  assert(!outputs.empty());
+
+  // the temporary files are removed
+  assert(!std::ifstream("simplified__block_0.tmp") && !std::ifstream("simplified__cell_0.tmp"));
+
+  // the output blocks match exactly
+  Surface_mesh sm = read_output(outputs);
+  std::cout << "  " << input.number_of_faces() << " -> " << sm.number_of_faces() << " faces" << std::endl;
+  assert(CGAL::is_valid_polygon_mesh(sm) && CGAL::is_triangle_mesh(sm));
+  assert(CGAL::is_closed(sm) == CGAL::is_closed(input));
+  assert(sm.number_of_faces() < 1.25 * ratio * input.number_of_faces());
+
+  const double d = PMP::approximate_Hausdorff_distance<CGAL::Sequential_tag>(
+                     sm, input, CGAL::parameters::number_of_points_per_area_unit(1000));
+  std::cout << "  distance to the input: " << d << std::endl;
+  const CGAL::Bbox_3 bb = PMP::bbox(input);
+  const double diagonal = std::sqrt(CGAL::square(bb.xmax() - bb.xmin()) +
+                                    CGAL::square(bb.ymax() - bb.ymin()) +
+                                    CGAL::square(bb.zmax() - bb.zmin()));
+  assert(d < 0.01 * diagonal);
+
+  for(const std::string& filename : blocks)
+    std::remove(filename.c_str());
+  for(const std::string& filename : outputs)
+    std::remove(filename.c_str());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  Surface_mesh sm;
+  if(!CGAL::IO::read_polygon_mesh(filename, sm))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  test(sm, {}, {}, 0.2);
+  test(sm, {0.5}, {0.5}, 0.2);
+  test(sm, {1./3., 2./3.}, {1./3., 2./3.}, 0.2);
+
+  // blocks of different sizes
+  test(sm, {0.2, 0.7}, {0.6}, 0.2);
+
+  // a block that cannot be read
+  std::vector<std::string> outputs;
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(0.2);
+  const std::vector<std::string> missing_blocks(1, "no_such_file.ply");
+  bool ok = SMS::edge_collapse_by_blocks<Surface_mesh, GH_policies>(missing_blocks, stop, "simplified_",
+                                                                    std::back_inserter(outputs));
+  assert(!ok);
+  CGAL_USE(ok);
+  assert(outputs.empty());
+
+  // temporary files that cannot be written
+  const std::vector<std::string> blocks = write_blocks(sm, {}, {});
+  ok = SMS::edge_collapse_by_blocks<Surface_mesh, GH_policies>(blocks, stop, "no_such_directory/simplified_",
+                                                               std::back_inserter(outputs));
+  assert(!ok);
+  assert(outputs.empty());
+  for(const std::string& filename : blocks)
+    std::remove(filename.c_str());
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
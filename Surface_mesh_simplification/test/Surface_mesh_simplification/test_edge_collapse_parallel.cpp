@@ -0,0 +1,115 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_normal_change_filter.h>
+
+#include <CGAL/IO/polygon_mesh_io.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                      Surface_mesh;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+struct Counting_visitor
+  : SMS::Edge_collapse_visitor_base<Surface_mesh>
+{
+  Counting_visitor(int& nb_collapses) : nb_collapses(&nb_collapses) { }
+
+  void OnCollapsed(const Profile&, vertex_descriptor) { ++(*nb_collapses); }
+
+  int* nb_collapses;
+};
+
+template <typename ConcurrencyTag>
+Surface_mesh simplify(const Surface_mesh& input, const double ratio)
+{
+  Surface_mesh sm = input;
+  int nb_collapses = 0;
+
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(ratio);
+  const int r = SMS::edge_collapse(sm, stop,
+                                   CGAL::parameters::visitor(Counting_visitor(nb_collapses))
+                                                    .concurrency_tag(ConcurrencyTag()));
+
+  // r is the number of removed edges
+  assert(nb_collapses > 0 && r >= nb_collapses);
+  assert(CGAL::is_valid_polygon_mesh(sm) && CGAL::is_triangle_mesh(sm));
+  sm.collect_garbage();
+  assert(num_edges(sm) + r == num_edges(input));
+
+  std::cout << "  " << num_edges(input) << " -> " << num_edges(sm) << " edges" << std::endl;
+  return sm;
+}
+
+template <typename ConcurrencyTag>
+void test(const Surface_mesh& input)
+{
+  const Surface_mesh sm = simplify<ConcurrencyTag>(input, 0.1);
+
+  // the ratio is reached (up to the edges removed in the last round)
+  const Surface_mesh sm_sequential = simplify<CGAL::Sequential_tag>(input, 0.1);
+  assert(num_edges(sm) <= num_edges(sm_sequential) + num_edges(input) / 20);
+
+  // policies other than the default ones
+  Surface_mesh sm2 = input;
+  SMS::Edge_length_stop_predicate<double> stop(0.05);
+  SMS::edge_collapse(sm2, stop,
+                     CGAL::parameters::get_cost(SMS::Edge_length_cost<Surface_mesh>())
+                                      .get_placement(SMS::Midpoint_placement<Surface_mesh>())
+                                      .filter(SMS::Bounded_normal_change_filter<>())
+                                      .concurrency_tag(ConcurrencyTag()));
+  assert(CGAL::is_valid_polygon_mesh(sm2) && CGAL::is_triangle_mesh(sm2));
+  assert(sm2.number_of_edges() < input.number_of_edges());
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // the result does not depend on the number of threads
+  if(std::is_same<ConcurrencyTag, CGAL::Parallel_tag>::value)
+  {
+    for(int nb_threads : { 1, 2, 4 })
+    {
+      tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+      const Surface_mesh sm_t = simplify<ConcurrencyTag>(input, 0.1);
+      assert(num_vertices(sm_t) == num_vertices(sm));
+      auto vit = vertices(sm).begin();
+      for(auto v : vertices(sm_t))
+        assert(sm_t.point(v) == sm.point(*vit++));
+    }
+  }
+#endif
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::string filename_with_holes = (argc > 2) ? argv[2]
+                                                     : CGAL::data_file_path("meshes/elephant-with-holes.off");
+
+  Surface_mesh sm, sm_with_holes;
+  if(!CGAL::IO::read_polygon_mesh(filename, sm) ||
+     !CGAL::IO::read_polygon_mesh(filename_with_holes, sm_with_holes))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Parallel_if_available_tag" << std::endl;
+  test<CGAL::Parallel_if_available_tag>(sm);
+  test<CGAL::Parallel_if_available_tag>(sm_with_holes);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
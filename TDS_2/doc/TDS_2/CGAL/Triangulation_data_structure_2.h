@@ -18,6 +18,16 @@ additional template parameters.
 
 \tparam FaceBase  must be a model of `TriangulationDSFaceBase_2`. The default is `Triangulation_ds_face_base_2<TDS>`.
 
+\tparam ConcurrencyTag enables the use of a concurrent
+container to store vertices and faces. It can be `Sequential_tag` (use of a
+`Compact_container` to store vertices and faces) or `Parallel_tag`
+(use of a `Concurrent_compact_container`). If it is
+`Parallel_tag`, the following functions can be called concurrently:
+`create_vertex()`, `create_face()`, `delete_vertex()`, and `delete_face()`,
+and the range insertion of `Delaunay_triangulation_2` and
+`Regular_triangulation_2` is performed in parallel.
+`Sequential_tag` is the default value.
+
 \cgalModels{TriangulationDataStructure_2}
 
 \cgalHeading{Modifiers}
@@ -37,7 +47,7 @@ guarantee the combinatorial validity of the resulting data structure.
 \image html tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 \image latex tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 */
-template< typename VertexBase, typename FaceBase >
+template< typename VertexBase, typename FaceBase, typename ConcurrencyTag >
 class Triangulation_data_structure_2 {
 public:
 /// \name Types
@@ -65,12 +75,14 @@ public:
 /// @{
 
 /*!
-Vertex container type.
+Vertex container type. If `ConcurrencyTag` is `Parallel_tag`, a
+`Concurrent_compact_container` is used instead of a `Compact_container`.
 */
 typedef Compact_container<Vertex> Vertex_range;
 
 /*!
-Face container type.
+Face container type. If `ConcurrencyTag` is `Parallel_tag`, a
+`Concurrent_compact_container` is used instead of a `Compact_container`.
 */
 typedef Compact_container<Face> Face_range;
 
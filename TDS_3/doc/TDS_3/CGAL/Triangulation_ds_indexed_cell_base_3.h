@@ -0,0 +1,53 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Triangulation_ds_indexed_cell_base_3<>` is a model for the concept
+`TriangulationDSCellBase_3` to be used by
+`Triangulation_data_structure_3`, which stores its vertices and its neighbors
+as 32-bit indices instead of handles.
+
+A cell stores four vertex indices and four neighbor indices. The two least
+significant bits of a neighbor index give the index of the cell in this
+neighbor, so that `Triangulation_data_structure_3::mirror_index()` does
+not have to search it. The connectivity of a cell takes 36 bytes instead
+of 72 bytes with `Triangulation_ds_cell_base_3` on a 64-bit platform.
+
+It must be used together with `Triangulation_ds_indexed_vertex_base_3`: the
+triangulation data structure then stores the vertices and the cells in
+blocks where the handle of an element is found from its index in constant
+time. A triangulation data structure can hold at most \f$ 2^{30}-1\f$ cells
+and \f$ 2^{30}-1\f$ vertices, and cannot use `Parallel_tag`.
+
+The handles stored in a cell are only valid relatively to the triangulation
+data structure which contains the cell, so the functions of a cell
+should not be called on a copy of this cell which is not in a triangulation
+data structure.
+
+\cgalModels{TriangulationDSCellBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_cell_base_3`
+\sa `CGAL::Triangulation_ds_indexed_vertex_base_3`
+
+*/
+template< typename TDS = void >
+class Triangulation_ds_indexed_cell_base_3 {
+public:
+
+/// \name Access Functions
+/// @{
+
+/*!
+returns the index of this cell in `neighbor(i)`.
+\pre `neighbor(i)` is not the default constructed handle.
+*/
+int mirror_index(int i) const;
+
+/// @}
+
+}; /* end Triangulation_ds_indexed_cell_base_3 */
+} /* end namespace CGAL */
@@ -0,0 +1,29 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Triangulation_ds_indexed_vertex_base_3` can be used as the base vertex
+for a 3D-triangulation data structure, it is a model of the concept
+`TriangulationDSVertexBase_3`. It stores its incident cell as a 32-bit index,
+and must be used together with `Triangulation_ds_indexed_cell_base_3`.
+
+As for `Triangulation_ds_vertex_base_3`, if the triangulation data structure
+is used as a parameter of a geometric triangulation, the vertex base class
+has to be wrapped in a model of the concept `TriangulationVertexBase_3`,
+such as `Triangulation_vertex_base_3`.
+
+\cgalModels{TriangulationDSVertexBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_vertex_base_3`
+\sa `CGAL::Triangulation_ds_indexed_cell_base_3`
+
+*/
+template< typename TDS = void >
+class Triangulation_ds_indexed_vertex_base_3 {
+
+}; /* end Triangulation_ds_indexed_vertex_base_3 */
+} /* end namespace CGAL */
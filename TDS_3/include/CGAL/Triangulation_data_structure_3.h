@@ -44,6 +44,7 @@
 
 #include <CGAL/Concurrent_compact_container.h>
 #include <CGAL/Compact_container.h>
+#include <CGAL/Indexed_compact_container.h>
 #include <CGAL/Small_unordered_map.h>
 
 #include <CGAL/Triangulation_ds_cell_base_3.h>
@@ -62,6 +63,17 @@
 
 namespace CGAL {
 
+namespace internal { namespace TDS_3 {
+  // Whether a vertex or cell base class refers to the other
+  // elements with indices (see Triangulation_ds_indexed_cell_base_3).
+  template <class B, class = void>
+  struct Has_indexed_storage : public std::false_type {};
+
+  template <class B>
+  struct Has_indexed_storage<B, std::void_t<typename B::Has_indexed_storage> >
+    : public std::true_type {};
+} } //namespace internal::TDS_3
+
 // TODO : noms : Vb != Vertex_base : clarifier.
 
 template < class Vb = Triangulation_ds_vertex_base_3<>,
@@ -122,14 +134,31 @@ private:
 
 public:
 
+  // The vertices and cells refer to each other with 32-bit indices
+  // instead of handles, and are stored in Indexed_compact_containers.
+  static constexpr bool has_indexed_storage =
+    internal::TDS_3::Has_indexed_storage<Cb>::value;
+
+  static_assert
+    (has_indexed_storage == internal::TDS_3::Has_indexed_storage<Vb>::value,
+     "The vertex and cell base classes must both use indices, or both use handles.");
+  static_assert
+    (!(has_indexed_storage && std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+     "The indexed vertex and cell base classes cannot be used with `Parallel_tag`.");
+
   // Cells
   // N.B.: Concurrent_compact_container requires TBB
 #ifdef CGAL_LINKED_WITH_TBB
   typedef typename std::conditional
   <
-    std::is_convertible<Concurrency_tag, Parallel_tag>::value,
-    Concurrent_compact_container<Cell, tbb::scalable_allocator<Cell> >,
-    Compact_container<Cell>
+    has_indexed_storage,
+    Indexed_compact_container<Cell>,
+    typename std::conditional
+    <
+      std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+      Concurrent_compact_container<Cell, tbb::scalable_allocator<Cell> >,
+      Compact_container<Cell>
+    >::type
   >::type                                                Cell_range;
 
 # else
@@ -137,7 +166,12 @@ public:
     (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
      "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
      "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
-  typedef Compact_container<Cell>                        Cell_range;
+  typedef typename std::conditional
+  <
+    has_indexed_storage,
+    Indexed_compact_container<Cell>,
+    Compact_container<Cell>
+  >::type                                                Cell_range;
 #endif
 
   // Vertices
@@ -145,13 +179,23 @@ public:
 #ifdef CGAL_LINKED_WITH_TBB
   typedef typename std::conditional
   <
-    std::is_convertible<Concurrency_tag, Parallel_tag>::value,
-    Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
-    Compact_container<Vertex>
+    has_indexed_storage,
+    Indexed_compact_container<Vertex>,
+    typename std::conditional
+    <
+      std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+      Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
+      Compact_container<Vertex>
+    >::type
   >::type                                                Vertex_range;
 
 # else
-  typedef Compact_container<Vertex>                      Vertex_range;
+  typedef typename std::conditional
+  <
+    has_indexed_storage,
+    Indexed_compact_container<Vertex>,
+    Compact_container<Vertex>
+  >::type                                                Vertex_range;
 #endif
 
 
@@ -231,10 +275,13 @@ public:
 public:
   Triangulation_data_structure_3()
     : _dimension(-2)
-  {}
+  {
+    associate_containers();
+  }
 
   Triangulation_data_structure_3(const Tds & tds)
   {
+    associate_containers();
     copy_tds(tds);
   }
 
@@ -245,6 +292,7 @@ public:
     , _cells(std::move(tds._cells))
     , _vertices(std::move(tds._vertices))
   {
+    tds.associate_containers();
   }
 
   Tds & operator= (const Tds & tds)
@@ -262,6 +310,7 @@ public:
     _cells = std::move(tds._cells);
     _vertices = std::move(tds._vertices);
     _dimension = std::exchange(tds._dimension, -2);
+    tds.associate_containers();
     return *this;
   }
 
@@ -1562,7 +1611,10 @@ public:
   int mirror_index(Cell_handle c, int i) const
   {
       CGAL_precondition ( i>=0 && i<4 );
-      return c->neighbor(i)->index(c);
+      if constexpr (has_indexed_storage)
+        return c->mirror_index(i);
+      else
+        return c->neighbor(i)->index(c);
   }
 
   Vertex_handle mirror_vertex(Cell_handle c, int i) const
@@ -1573,7 +1625,7 @@ public:
   Facet mirror_facet(Facet f) const
   {
     Cell_handle neighbor_cell = f.first->neighbor(f.second);
-    const int opposite_index = neighbor_cell->index(f.first);
+    const int opposite_index = mirror_index(f.first, f.second);
     return Facet(neighbor_cell, opposite_index);
   }
 
@@ -1678,6 +1730,16 @@ private:
   Cell_range   _cells;
   Vertex_range _vertices;
 
+  // The indexed cells find their vertices from the container of the
+  // cells, and conversely.
+  void associate_containers()
+  {
+    if constexpr (has_indexed_storage) {
+      _cells.set_associated_container(_vertices);
+      _vertices.set_associated_container(_cells);
+    }
+  }
+
   // used by is-valid :
   bool count_vertices(size_type &i, bool verbose = false, int level = 0) const;
   // counts AND checks the validity
@@ -2265,7 +2327,7 @@ has_vertex(Cell_handle c, int i, Vertex_handle v) const
   // checks whether the query facet (c,i) has vertex v
 {
   CGAL_precondition( dimension() == 3 );
-  int j;
+  int j = -1;
   return ( c->has_vertex(v,j) && (j != i) );
 }
 
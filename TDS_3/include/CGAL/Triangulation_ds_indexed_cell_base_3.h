@@ -0,0 +1,310 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Sylvain Pion
+
+// cell of a triangulation data structure of any dimension <=3,
+// which refers to its vertices and neighbors with 32-bit indices
+
+#ifndef CGAL_TRIANGULATION_DS_INDEXED_CELL_BASE_3_H
+#define CGAL_TRIANGULATION_DS_INDEXED_CELL_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+// The cells and the vertices are stored in Indexed_compact_containers.
+// A vertex is stored as its index, shifted by 2 bits, the 2 least significant
+// bits of the first vertex being used by the container.
+// A neighbor is stored as its index, shifted by 2 bits, the 2 least
+// significant bits giving the index of this cell in the neighbor
+// (see `mirror_index()`).
+//
+// The indices are relative to the containers of the TDS, so that the
+// functions returning or setting handles must be called on cells which
+// are in these containers, and not on copies.
+template < typename TDS = void >
+class Triangulation_ds_indexed_cell_base_3
+{
+  typedef Triangulation_ds_indexed_cell_base_3<TDS> Self;
+
+public:
+  typedef TDS                           Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle   Vertex_handle;
+  typedef typename TDS::Cell_handle     Cell_handle;
+  typedef typename TDS::Vertex          Vertex;
+  typedef typename TDS::Cell            Cell;
+  typedef typename TDS::Cell_data       TDS_data;
+
+  typedef Tag_true                      Has_indexed_storage;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_indexed_cell_base_3<TDS2> Other; };
+
+  Triangulation_ds_indexed_cell_base_3()
+    : N{null_word, null_word, null_word, null_word},
+      V{null_word, null_word, null_word, null_word}
+  {}
+
+  Triangulation_ds_indexed_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3)
+    : N{null_word, null_word, null_word, null_word},
+      V{word(v0), word(v1), word(v2), word(v3)}
+  {}
+
+  // The mirror indices are found when the neighbors are set again.
+  Triangulation_ds_indexed_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3,
+                                       Cell_handle   n0, Cell_handle   n1,
+                                       Cell_handle   n2, Cell_handle   n3)
+    : N{word(n0), word(n1), word(n2), word(n3)},
+      V{word(v0), word(v1), word(v2), word(v3)}
+  {}
+
+  // ACCESS FUNCTIONS
+
+  Vertex_handle vertex(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3 );
+    CGAL_assume( i >= 0 && i <= 3 );
+    const std::uint32_t k = V[i] >> 2;
+    if (k == null_index)
+      return Vertex_handle();
+    return Cell_range::template associated_element<Vertex_range>(self(), k);
+  }
+
+  bool has_vertex(Vertex_handle v) const
+  {
+    const std::uint32_t w = word(v);
+    return (V[0] == w) || (V[1] == w) || (V[2] == w) || (V[3] == w);
+  }
+
+  bool has_vertex(Vertex_handle v, int & i) const
+    {
+      const std::uint32_t w = word(v);
+      if (w == V[0]) { i = 0; return true; }
+      if (w == V[1]) { i = 1; return true; }
+      if (w == V[2]) { i = 2; return true; }
+      if (w == V[3]) { i = 3; return true; }
+      return false;
+    }
+
+  int index(Vertex_handle v) const
+  {
+    const std::uint32_t w = word(v);
+    if (w == V[0]) { return 0; }
+    if (w == V[1]) { return 1; }
+    if (w == V[2]) { return 2; }
+    CGAL_assertion( w == V[3] );
+    return 3;
+  }
+
+  Cell_handle neighbor(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    const std::uint32_t k = N[i] >> 2;
+    if (k == null_index)
+      return Cell_handle();
+    return Cell_range::element(self(), k);
+  }
+
+  bool has_neighbor(Cell_handle n) const
+  {
+    const std::uint32_t w = word(n);
+    return (key(N[0]) == w) || (key(N[1]) == w) ||
+           (key(N[2]) == w) || (key(N[3]) == w);
+  }
+
+  bool has_neighbor(Cell_handle n, int & i) const
+  {
+    const std::uint32_t w = word(n);
+    if(w == key(N[0])){ i = 0; return true; }
+    if(w == key(N[1])){ i = 1; return true; }
+    if(w == key(N[2])){ i = 2; return true; }
+    if(w == key(N[3])){ i = 3; return true; }
+    return false;
+  }
+
+  int index(Cell_handle n) const
+  {
+    const std::uint32_t w = word(n);
+    return index_of_neighbor(w);
+  }
+
+  // Returns the index of this cell in `neighbor(i)`, usually
+  // without reading the vertices of the neighbor.
+  int mirror_index(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    CGAL_precondition( neighbor(i) != Cell_handle() );
+    const Self& n = *neighbor(i);
+    const std::uint32_t w = std::uint32_t(Cell_range::index(self())) << 2;
+    const int j = int(N[i] & 3);
+    if (key(n.N[j]) == w)
+      return j;
+    return n.index_of_neighbor(w);
+  }
+
+  // SETTING
+
+  void set_vertex(int i, Vertex_handle v)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    V[i] = word(v);
+  }
+
+  // If `n` already has this cell as neighbor, the mirror indices
+  // of both cells are updated.
+  void set_neighbor(int i, Cell_handle n)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    CGAL_precondition( this != n.operator->() );
+    N[i] = word(n);
+    if (n == Cell_handle())
+      return;
+
+    Self& other = *n;
+    const std::uint32_t w = std::uint32_t(Cell_range::index(self())) << 2;
+    for (int j = 0; j < 4; ++j) {
+      if (key(other.N[j]) == w) {
+        N[i] |= std::uint32_t(j);
+        other.N[j] = w | std::uint32_t(i);
+        return;
+      }
+    }
+  }
+
+  void set_vertices()
+  {
+    V[0] = V[1] = V[2] = V[3] = null_word;
+  }
+
+  void set_vertices(Vertex_handle v0, Vertex_handle v1,
+                    Vertex_handle v2, Vertex_handle v3)
+  {
+    V[0] = word(v0);
+    V[1] = word(v1);
+    V[2] = word(v2);
+    V[3] = word(v3);
+  }
+
+  void set_neighbors()
+  {
+    N[0] = N[1] = N[2] = N[3] = null_word;
+  }
+
+  void set_neighbors(Cell_handle n0, Cell_handle n1,
+                     Cell_handle n2, Cell_handle n3)
+  {
+    set_neighbor(0, n0);
+    set_neighbor(1, n1);
+    set_neighbor(2, n2);
+    set_neighbor(3, n3);
+  }
+
+  // CHECKING
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  { return true; }
+
+  // For use by Indexed_compact_container.
+  std::uint32_t for_indexed_compact_container() const { return V[0]; }
+  void for_indexed_compact_container(std::uint32_t w) { V[0] = w; }
+
+  // TDS internal data access functions.
+        TDS_data& tds_data()       { return _tds_data; }
+  const TDS_data& tds_data() const { return _tds_data; }
+
+private:
+  typedef typename TDS::Cell_range      Cell_range;
+  typedef typename TDS::Vertex_range    Vertex_range;
+
+  static constexpr std::uint32_t null_index = (std::uint32_t(1) << 30) - 1;
+  static constexpr std::uint32_t null_word = null_index << 2;
+
+  static std::uint32_t key(std::uint32_t w) { return w & ~std::uint32_t(3); }
+
+  static std::uint32_t word(Vertex_handle v)
+  {
+    if (v == Vertex_handle())
+      return null_word;
+    return std::uint32_t(Vertex_range::index(v)) << 2;
+  }
+
+  static std::uint32_t word(Cell_handle c)
+  {
+    if (c == Cell_handle())
+      return null_word;
+    return std::uint32_t(Cell_range::index(c)) << 2;
+  }
+
+  typename Cell_range::const_iterator self() const
+  {
+    return typename Cell_range::const_iterator(static_cast<const Cell*>(this));
+  }
+
+  int index_of_neighbor(std::uint32_t w) const
+  {
+    if (w == key(N[0])) return 0;
+    if (w == key(N[1])) return 1;
+    if (w == key(N[2])) return 2;
+    CGAL_assertion( w == key(N[3]) );
+    return 3;
+  }
+
+  std::uint32_t N[4];
+  std::uint32_t V[4];
+  TDS_data      _tds_data;
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Triangulation_ds_indexed_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Triangulation_ds_indexed_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Triangulation_ds_indexed_cell_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Has_indexed_storage;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_indexed_cell_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_TRIANGULATION_DS_INDEXED_CELL_BASE_3_H
@@ -0,0 +1,137 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Sylvain Pion
+
+#ifndef CGAL_TRIANGULATION_DS_INDEXED_VERTEX_BASE_3_H
+#define CGAL_TRIANGULATION_DS_INDEXED_VERTEX_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/tags.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+// The vertex stores the index of its cell, shifted by 2 bits, the 2 least
+// significant bits being used by Indexed_compact_container.
+// `cell()` must be called on vertices which are in the container of the TDS.
+template < typename TDS = void >
+class Triangulation_ds_indexed_vertex_base_3
+{
+public:
+  typedef TDS                          Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle  Vertex_handle;
+  typedef typename TDS::Cell_handle    Cell_handle;
+
+  typedef Tag_true                     Has_indexed_storage;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_indexed_vertex_base_3<TDS2> Other; };
+
+
+  Triangulation_ds_indexed_vertex_base_3()
+    : _c(null_word), visited_for_vertex_extractor(false)
+  {}
+
+  Triangulation_ds_indexed_vertex_base_3(Cell_handle c)
+    : _c(word(c)), visited_for_vertex_extractor(false)
+  {}
+
+  Cell_handle cell() const
+  {
+    const std::uint32_t k = _c >> 2;
+    if (k == null_index)
+      return Cell_handle();
+    typedef typename TDS::Vertex Vertex;
+    return Vertex_range::template associated_element<Cell_range>(
+             typename Vertex_range::const_iterator(static_cast<const Vertex*>(this)), k);
+  }
+
+  void set_cell(Cell_handle c)
+  {
+    _c = word(c);
+  }
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  {
+    return cell() != Cell_handle();
+  }
+
+  // For use by Indexed_compact_container.
+  std::uint32_t for_indexed_compact_container() const
+  { return _c; }
+  void for_indexed_compact_container(std::uint32_t w)
+  { _c = w; }
+
+private:
+  typedef typename TDS::Cell_range     Cell_range;
+  typedef typename TDS::Vertex_range   Vertex_range;
+
+  static constexpr std::uint32_t null_index = (std::uint32_t(1) << 30) - 1;
+  static constexpr std::uint32_t null_word = null_index << 2;
+
+  static std::uint32_t word(Cell_handle c)
+  {
+    if (c == Cell_handle())
+      return null_word;
+    return std::uint32_t(Cell_range::index(c)) << 2;
+  }
+
+  std::uint32_t _c;
+
+  // The typedef and the bool are used by Triangulation_data_structure::Vertex_extractor
+  // The names are chooses complicated so that we do not have to document them
+  // (privacy by obfuscation)
+  public:
+  typedef bool Has_visited_for_vertex_extractor;
+  bool visited_for_vertex_extractor;
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Triangulation_ds_indexed_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Triangulation_ds_indexed_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Triangulation_ds_indexed_vertex_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Has_indexed_storage;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Triangulation_ds_indexed_vertex_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_TRIANGULATION_DS_INDEXED_VERTEX_BASE_3_H
@@ -14,6 +14,7 @@
 #include <cassert>
 #include <iostream>
 #include <fstream>
+#include <new>
 
 #include "_test_cls_tds_vertex.h"
 #include "_test_cls_tds_cell.h"
@@ -146,6 +147,8 @@ _test_cls_tds_3( const Tds &)
     // check tds12 is still valid after the destruction of tds11
     assert(tds12.is_valid());
     assert(tds12.dimension()==2);
+    // tds11 is destroyed again at the end of the scope
+    new (&tds11) Tds();
   }
 
   std::cout << "  Insert are tested in test_triangulation_3  " << std::endl;
@@ -0,0 +1,60 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sylvain Pion
+
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_ds_indexed_cell_base_3.h>
+#include <CGAL/Triangulation_ds_indexed_vertex_base_3.h>
+
+#include <CGAL/_test_cls_tds_3.h>
+
+#include <cassert>
+
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL::Triangulation_ds_indexed_vertex_base_3<>,
+  CGAL::Triangulation_ds_indexed_cell_base_3<> >       Tds;
+
+// Explicit instantiation :
+template class CGAL::Triangulation_data_structure_3<
+  CGAL::Triangulation_ds_indexed_vertex_base_3<>,
+  CGAL::Triangulation_ds_indexed_cell_base_3<> >;
+
+static_assert(Tds::has_indexed_storage);
+static_assert(2 * sizeof(Tds::Cell) <= sizeof(CGAL::Triangulation_data_structure_3<>::Cell));
+
+int main()
+{
+  _test_cls_tds_3(Tds());
+
+  // The mirror indices are kept by the cells.
+  Tds tds;
+  Tds::Vertex_handle v = tds.insert_increase_dimension();
+  for(int i=0; i<4; ++i)
+    tds.insert_increase_dimension(v);
+  assert(tds.dimension() == 3);
+  for(int i=0; i<20; ++i)
+    tds.insert_in_cell(tds.cells_begin());
+  assert(tds.is_valid());
+  for(Tds::Cell_iterator cit = tds.cells_begin(); cit != tds.cells_end(); ++cit)
+    for(int i=0; i<4; ++i)
+      assert(tds.mirror_index(cit, i) == cit->neighbor(i)->index(cit));
+
+  // The containers stay associated when the TDS is moved.
+  Tds tds2(std::move(tds));
+  assert(tds2.is_valid());
+  tds.insert_increase_dimension();
+  tds.insert_increase_dimension(tds.vertices_begin());
+  assert(tds.is_valid());
+  tds = std::move(tds2);
+  assert(tds.is_valid() && tds.number_of_vertices() == 25);
+
+  return 0;
+}
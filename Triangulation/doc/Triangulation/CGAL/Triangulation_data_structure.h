@@ -34,6 +34,14 @@ third parameter be specified. It also accepts the tag `CGAL::Default` as
 third parameter. In both cases, `TriangulationDSFullCell_` defaults to
 `CGAL::Triangulation_ds_full_cell<>`.
 
+\tparam ConcurrencyTag enables the use of a concurrent
+container to store vertices and full cells. It can be `Sequential_tag` (use of a
+`Compact_container` to store vertices and full cells) or `Parallel_tag`
+(use of a `Concurrent_compact_container`). If it is
+`Parallel_tag`, the functions inserting a range of points in a
+`Delaunay_triangulation` can use several threads.
+The default value is `Sequential_tag`.
+
 \cgalModels{TriangulationDataStructure. In addition, the class
 `Triangulation_data_structure` provides the following types and
 methods.}
@@ -41,7 +49,7 @@ methods.}
 \sa `Triangulation_ds_vertex`
 \sa `Triangulation_ds_full_cell`
 */
-template< typename Dimensionality, typename TriangulationDSVertex_, typename TriangulationDSFullCell_ >
+template< typename Dimensionality, typename TriangulationDSVertex_, typename TriangulationDSFullCell_, typename ConcurrencyTag >
 class Triangulation_data_structure {
 public:
 
@@ -101,6 +109,11 @@ as full cell type.
 template <typename Fcb2>
 using Rebind_full_cell = unspecified_type;
 
+/*!
+The concurrency tag, `ConcurrencyTag`.
+*/
+typedef ConcurrencyTag Concurrency_tag;
+
 /// @}
 
 /// \name Vertex insertion
@@ -37,7 +37,16 @@ indices are not stored).
 <LI>`CGAL::TDS_full_cell_default_storage_policy`. In that case, the mirror
 indices are not stored.
 <LI>`CGAL::TDS_full_cell_mirror_storage_policy`. In that case, the mirror
-indices are stored. This last policy is not supported when the dimension is larger than 127.
+indices are stored. This policy is not supported when the dimension is larger than 127.
+<LI>`CGAL::TDS_full_cell_indexed_storage_policy`. In that case, the vertices
+and the neighbors are stored as 32-bit indices instead of handles, which
+halves the memory used by the full cells on 64-bit platforms. The triangulation
+data structure then stores its vertices and its full cells in
+`Indexed_compact_container`s instead of `Compact_container`s, and can contain at most
+\f$ 2^{30}-1\f$ full cells. As the handles are computed from the address of the full cell,
+the functions accessing vertices and neighbors can only be called on full cells that are
+in a triangulation data structure. This policy cannot be used with a
+triangulation data structure whose concurrency tag is `Parallel_tag`.
 </UL>
 See the user manual for how to choose the second option.
 
@@ -18,6 +18,7 @@
 
 #include <CGAL/tss.h>
 #include <CGAL/Triangulation.h>
+#include <CGAL/Triangulation/internal/Parallel_insert.h>
 #include <CGAL/Dimension.h>
 #include <CGAL/Default.h>
 
@@ -25,6 +26,7 @@
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 
 #include <algorithm>
+#include <type_traits>
 
 namespace CGAL {
 
@@ -219,6 +221,14 @@ public:
         size_type n = number_of_vertices();
         std::vector<Point> points(start, end);
         spatial_sort(points.begin(), points.end(), geom_traits());
+#ifdef CGAL_LINKED_WITH_TBB
+        if constexpr( std::is_convertible<
+            typename internal::Triangulation::Tds_concurrency_tag<TDS>::type, Parallel_tag>::value )
+        {
+            internal::Triangulation::parallel_insert(*this, points);
+            return number_of_vertices() - n;
+        }
+#endif
         Full_cell_handle hint;
         for( typename std::vector<Point>::const_iterator p = points.begin(); p != points.end(); ++p )
         {
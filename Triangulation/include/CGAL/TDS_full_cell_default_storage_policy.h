@@ -37,12 +37,20 @@ struct TFC_data< Vertex_handle, Full_cell_handle, Dimen, TDS_full_cell_default_s
     typedef typename internal::S_or_D_array< Vertex_handle, Dimen_plus, true >     Vertex_handle_array;
     typedef typename internal::S_or_D_array< Full_cell_handle, Dimen_plus >    Full_cell_handle_array;
 
+    typedef typename Vertex_handle_array::const_iterator Vertex_handle_const_iterator;
+
     Vertex_handle_array  vertices_;
     Full_cell_handle_array neighbors_;
 
     TFC_data(const int dmax)
     : vertices_(dmax+1), neighbors_(dmax+1)
     {}
+    Vertex_handle vertex(const int i) const { return vertices_[i]; }
+    Full_cell_handle neighbor(const int i) const { return neighbors_[i]; }
+    void set_vertex(const int i, Vertex_handle v) { vertices_[i] = v; }
+    void set_neighbor(const int i, Full_cell_handle s) { neighbors_[i] = s; }
+    Vertex_handle_const_iterator vertices_begin() const { return vertices_.begin(); }
+    Vertex_handle_const_iterator vertices_end() const { return vertices_.end(); }
     void*   for_compact_container() const { return vertices_.for_compact_container(); }
     void    for_compact_container(void *p){ vertices_.for_compact_container(p); }
     int dimension() const { return ( vertices_.size() - 1 ); }
@@ -75,12 +83,9 @@ struct TFC_data< Vertex_handle, Full_cell_handle, Dimen, TDS_full_cell_default_s
         Xor_type opp_vertex = xor_of_vertices(cur_dim)
             ^ neighbors_[i]->xor_of_vertices(cur_dim)
             ^ reinterpret_cast<Xor_type>(&(*vertices_[i]));
-        Vertex_handle mirror;
         typedef typename Vertex_handle::pointer pointer;
-        // mirror.set_pointer(reinterpret_cast<pointer>(opp_vertex));
-        mirror = Compact_container<typename Vertex_handle::value_type>
-            ::s_iterator_to(*(reinterpret_cast<pointer>(opp_vertex)));
-        return mirror;
+        // works for all the containers of the TDS
+        return Vertex_handle(reinterpret_cast<pointer>(opp_vertex));
     }
     void swap_vertices(const int d1, const int d2)
     {
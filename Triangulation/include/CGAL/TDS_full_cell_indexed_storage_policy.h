@@ -0,0 +1,234 @@
+// Copyright (c) 2025 INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)    : Samuel Hornus
+
+#ifndef CGAL_TDS_FULL_CELL_INDEXED_STORAGE_POLICY_H
+#define CGAL_TDS_FULL_CELL_INDEXED_STORAGE_POLICY_H
+
+#include <CGAL/license/Triangulation.h>
+
+#include <CGAL/TDS_full_cell_default_storage_policy.h>
+#include <CGAL/Indexed_compact_container.h>
+#include <CGAL/Triangulation/internal/Static_or_dynamic_array.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace CGAL {
+
+// POLICY TAG
+
+// Stores the vertices and the neighbors as 32-bit indices in the containers
+// of the TDS, which must be Indexed_compact_containers.
+struct TDS_full_cell_indexed_storage_policy {};
+
+namespace internal {
+namespace Triangulation {
+
+// An array of 32-bit words, whose first word can be used by
+// Indexed_compact_container (its 2 least significant bits must be 0 when
+// the full cell is used).
+template< typename Dimen >
+struct Indexed_TFC_array
+: public S_or_D_array< std::uint32_t, Dimen >
+{
+    typedef S_or_D_array< std::uint32_t, Dimen > Base;
+    Indexed_TFC_array(const int d)
+    : Base(d)
+    {}
+    std::uint32_t for_indexed_compact_container() const { return (*this)[0]; }
+    void for_indexed_compact_container(std::uint32_t w) { (*this)[0] = w; }
+};
+
+// The words of a dynamic array are not in the full cell: the container
+// uses a separate word, which is still valid once the full cell is destroyed.
+template<>
+struct Indexed_TFC_array< Dynamic_dimension_tag >
+: public S_or_D_array< std::uint32_t, Dynamic_dimension_tag >
+{
+    typedef S_or_D_array< std::uint32_t, Dynamic_dimension_tag > Base;
+    Indexed_TFC_array(const int d)
+    : Base(d), word_(0)
+    {}
+    std::uint32_t word_;
+    std::uint32_t for_indexed_compact_container() const { return word_; }
+    void for_indexed_compact_container(std::uint32_t w) { word_ = w; }
+};
+
+// Iterates over the vertices of a full cell from their indices.
+template< typename Vertex_handle, typename Full_cell_container >
+class Indexed_vertex_handle_iterator
+{
+    typedef Indexed_vertex_handle_iterator<Vertex_handle, Full_cell_container> Self;
+    typedef typename Vertex_handle::CC  Vertex_container;
+
+    const std::uint32_t * w_;
+    const void * member_; // the address of a member of the full cell
+
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef Vertex_handle                   value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    // The handles are returned by value: these types only tell that the
+    // iterator is constant (e.g., to Iterator_project)
+    typedef const Vertex_handle *           pointer;
+    typedef const Vertex_handle &           reference;
+
+    Indexed_vertex_handle_iterator() : w_(nullptr), member_(nullptr) {}
+    Indexed_vertex_handle_iterator(const std::uint32_t * w, const void * member)
+    : w_(w), member_(member) {}
+
+    Vertex_handle operator*() const
+    {
+        const std::uint32_t k = *w_ >> 2;
+        if( k == Vertex_container::null_index )
+            return Vertex_handle();
+        return Full_cell_container::template
+            associated_element_of_member<Vertex_container>(member_, k);
+    }
+    Vertex_handle operator[](difference_type n) const { return *(*this + n); }
+
+    Self & operator++() { ++w_; return *this; }
+    Self & operator--() { --w_; return *this; }
+    Self operator++(int) { Self tmp(*this); ++w_; return tmp; }
+    Self operator--(int) { Self tmp(*this); --w_; return tmp; }
+    Self & operator+=(difference_type n) { w_ += n; return *this; }
+    Self & operator-=(difference_type n) { w_ -= n; return *this; }
+    Self operator+(difference_type n) const { return Self(w_ + n, member_); }
+    Self operator-(difference_type n) const { return Self(w_ - n, member_); }
+    friend Self operator+(difference_type n, const Self & it) { return it + n; }
+    difference_type operator-(const Self & it) const { return w_ - it.w_; }
+
+    bool operator==(const Self & it) const { return w_ == it.w_; }
+    bool operator!=(const Self & it) const { return w_ != it.w_; }
+    bool operator<(const Self & it) const { return w_ < it.w_; }
+    bool operator>(const Self & it) const { return w_ > it.w_; }
+    bool operator<=(const Self & it) const { return w_ <= it.w_; }
+    bool operator>=(const Self & it) const { return w_ >= it.w_; }
+};
+
+} // namespace Triangulation
+} // namespace internal
+
+// A vertex and a neighbor are stored as their index, shifted by 2 bits.
+// The indices are relative to the containers of the TDS, that the full cell
+// finds from its own address: the functions returning or setting handles
+// must be called on full cells which are in these containers.
+template< typename Vertex_handle, typename Full_cell_handle, typename Dimen >
+struct TFC_data< Vertex_handle, Full_cell_handle, Dimen, TDS_full_cell_indexed_storage_policy >
+{
+    typedef typename internal::Dimen_plus_one<Dimen>::type Dimen_plus;
+    typedef typename Vertex_handle::CC      Vertex_container;
+    typedef typename Full_cell_handle::CC   Full_cell_container;
+    typedef internal::Triangulation::Indexed_TFC_array<Dimen_plus>  Index_array;
+    typedef internal::Triangulation::
+        Indexed_vertex_handle_iterator<Vertex_handle, Full_cell_container>
+                                                    Vertex_handle_const_iterator;
+
+    static_assert(internal::Is_indexed_compact_container<Full_cell_container>::value &&
+                  internal::Is_indexed_compact_container<Vertex_container>::value,
+                  "TDS_full_cell_indexed_storage_policy requires a TDS storing its vertices "
+                  "and full cells in Indexed_compact_containers.");
+
+    Index_array vertices_;
+    Index_array neighbors_;
+
+    TFC_data(const int dmax)
+    : vertices_(dmax+1), neighbors_(dmax+1)
+    {
+        for( int i = 0; i <= dmax; ++i )
+            vertices_[i] = neighbors_[i] = null_word;
+    }
+    std::uint32_t for_indexed_compact_container() const
+    { return vertices_.for_indexed_compact_container(); }
+    void for_indexed_compact_container(std::uint32_t w)
+    { vertices_.for_indexed_compact_container(w); }
+    int dimension() const { return ( vertices_.size() - 1 ); }
+
+    Vertex_handle vertex(const int i) const
+    {
+        return vertex_of_index(vertices_[i] >> 2);
+    }
+    Full_cell_handle neighbor(const int i) const
+    {
+        const std::uint32_t k = neighbors_[i] >> 2;
+        if( k == null_index )
+            return Full_cell_handle();
+        return Full_cell_container::element_of_member(this, k);
+    }
+    void set_vertex(const int i, Vertex_handle v)
+    {
+        vertices_[i] = ( v == Vertex_handle() ) ? null_word
+                                                : std::uint32_t(Vertex_container::index(v)) << 2;
+    }
+    void set_neighbor(const int i, Full_cell_handle s)
+    {
+        neighbors_[i] = ( s == Full_cell_handle() ) ? null_word
+                                                    : std::uint32_t(Full_cell_container::index(s)) << 2;
+    }
+    Vertex_handle_const_iterator vertices_begin() const
+    {
+        return Vertex_handle_const_iterator(vertices_.data(), this);
+    }
+    Vertex_handle_const_iterator vertices_end() const
+    {
+        return Vertex_handle_const_iterator(vertices_.data() + vertices_.size(), this);
+    }
+
+    void set_mirror_index(const int, const int) {}
+    // The vertices are xored by index.
+    typedef std::uint32_t Xor_type;
+    Xor_type xor_of_vertices(const int cur_dim) const
+    {
+        Xor_type result(0);
+        for( int i = 0; i <= cur_dim; ++i )
+            result ^= vertices_[i] >> 2;
+        return result;
+    }
+    // ASSUMES |*this| is indeed a neighbor of neighbor(i):
+    int mirror_index(const int i) const
+    {
+        const std::uint32_t self = std::uint32_t(Full_cell_container::index_of_member(this));
+        const TFC_data & n = neighbor(i)->combinatorics_;
+        int index = 0;
+        while( (n.neighbors_[index] >> 2) != self )
+            ++index;
+        return index;
+    }
+    Vertex_handle mirror_vertex(const int i, const int cur_dim) const
+    {
+        return vertex_of_index(xor_of_vertices(cur_dim)
+                               ^ neighbor(i)->xor_of_vertices(cur_dim)
+                               ^ (vertices_[i] >> 2));
+    }
+    void swap_vertices(const int d1, const int d2)
+    {
+        std::swap(vertices_[d1], vertices_[d2]);
+        std::swap(neighbors_[d1], neighbors_[d2]);
+    }
+
+private:
+    static constexpr std::uint32_t null_index = Full_cell_container::null_index;
+    static constexpr std::uint32_t null_word = null_index << 2;
+
+    Vertex_handle vertex_of_index(const std::uint32_t k) const
+    {
+        if( k == null_index )
+            return Vertex_handle();
+        return Full_cell_container::template
+            associated_element_of_member<Vertex_container>(this, k);
+    }
+};
+
+} //namespace CGAL
+
+#endif // CGAL_TDS_FULL_CELL_INDEXED_STORAGE_POLICY_H
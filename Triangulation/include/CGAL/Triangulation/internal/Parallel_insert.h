@@ -0,0 +1,385 @@
+// Copyright (c) 2025 INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)    : Samuel Hornus
+
+#ifndef CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERT_H
+#define CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERT_H
+
+#include <CGAL/license/Triangulation.h>
+
+#include <CGAL/tags.h>
+#include <CGAL/enum.h>
+#include <CGAL/assertions.h>
+#include <CGAL/boost/iterator/transform_iterator.hpp>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/enumerable_thread_specific.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+namespace Triangulation {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Concurrency_tag, Concurrency_tag, false)
+
+// The concurrency tag of a model of `TriangulationDataStructure`:
+// `Sequential_tag` if it does not define any.
+template< class TDS, bool = Has_nested_type_Concurrency_tag<TDS>::value >
+struct Tds_concurrency_tag
+{
+    typedef Sequential_tag type;
+};
+
+template< class TDS >
+struct Tds_concurrency_tag<TDS, true>
+{
+    typedef typename TDS::Concurrency_tag type;
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// A table of locks on the vertices. A vertex is locked through the lock of
+// the hash of its address, so that different vertices may share a lock.
+// A lock stores the (non-zero) id of the thread which owns it.
+class Vertex_lock_table
+{
+    std::unique_ptr<std::atomic<int>[]> owners_;
+    int shift_;
+
+public:
+    explicit Vertex_lock_table(const int log2_size)
+    : owners_(new std::atomic<int>[std::size_t(1) << log2_size]), shift_(64 - log2_size)
+    {
+        for( std::size_t i = 0; i < (std::size_t(1) << log2_size); ++i )
+            owners_[i].store(0, std::memory_order_relaxed);
+    }
+
+    std::size_t index(const void * p) const
+    {
+        const std::uint64_t h = std::uint64_t(reinterpret_cast<std::uintptr_t>(p) >> 4);
+        return std::size_t((h * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    // Returns `true` if the lock is owned by `id`, after the call.
+    // `newly_locked` tells if it was not before.
+    bool try_lock(const std::size_t i, const int id, bool & newly_locked)
+    {
+        newly_locked = false;
+        int owner = owners_[i].load(std::memory_order_relaxed);
+        if( owner == id )
+            return true;
+        if( owner != 0 )
+            return false;
+        newly_locked = owners_[i].compare_exchange_strong(owner, id, std::memory_order_acquire);
+        return newly_locked;
+    }
+
+    void unlock(const std::size_t i)
+    {
+        owners_[i].store(0, std::memory_order_release);
+    }
+};
+
+// Inserts the points `points[first, last)` in the Delaunay triangulation
+// `dt`, whose TDS must use concurrent containers. The points are split in
+// blocks inserted by different threads.
+//
+// A thread owns a full cell when it has locked its finite vertices. A point
+// is inserted by walking from the last vertex inserted by the thread, and by
+// starring the zone of the full cells in conflict with it, while all the
+// full cells that are visited are locked. This is sufficient, as an insertion
+// only creates full cells, deletes the full cells of the zone and modifies
+// the neighbors of the full cells around the zone. If a lock cannot be
+// taken, the locks of the thread are released and the insertion is retried.
+//
+// The infinite full cells are never modified: a point for which an infinite
+// full cell is met is deferred, as well as the points which are equal to a
+// vertex and the points whose insertion failed too many times. The indices
+// of the deferred points are returned, in increasing order, and must be
+// inserted sequentially afterwards.
+template< class DT, class PointRange >
+std::vector<std::size_t>
+insert_in_parallel(DT & dt,
+                   const PointRange & points,
+                   std::size_t first, std::size_t last,
+                   typename DT::Vertex_handle hint,
+                   const int log2_nb_locks = 16)
+{
+    typedef typename DT::Vertex_handle                  Vertex_handle;
+    typedef typename DT::Full_cell_handle               Full_cell_handle;
+    typedef typename DT::Full_cell                      Full_cell;
+    typedef typename DT::Facet                          Facet;
+    typedef typename DT::Point                          Point;
+    typedef typename DT::Geom_traits::Orientation_d     Orientation_d;
+    typedef typename DT::Geom_traits::Side_of_oriented_sphere_d
+                                                        Side_of_oriented_sphere_d;
+    typedef typename DT::template
+        Conflict_predicate<Orientation_d, Side_of_oriented_sphere_d>
+                                                        Conflict_pred;
+    typedef Substitute_point_in_vertex_iterator<
+        typename Full_cell::Vertex_handle_const_iterator>
+                                                        Substitute;
+
+    CGAL_precondition( dt.current_dimension() == dt.maximal_dimension() );
+    CGAL_precondition( hint != Vertex_handle() && ! dt.is_infinite(hint) );
+
+    if( first >= last )
+        return std::vector<std::size_t>();
+
+    const int cur_dim = dt.current_dimension();
+    const Orientation_d ori = dt.geom_traits().orientation_d_object();
+    const Side_of_oriented_sphere_d side = dt.geom_traits().side_of_oriented_sphere_d_object();
+    const int max_nb_failures = 100;
+
+    Vertex_lock_table locks(log2_nb_locks);
+    std::atomic<int> nb_threads(0);
+
+    enum Insertion_result { INSERTED, DEFERRED, LOCK_FAILED };
+
+    struct Thread_data
+    {
+        int id;
+        Vertex_handle hint;
+        std::uint32_t random_state;
+        std::vector<std::size_t> locked;
+        std::vector<Full_cell_handle> cells;
+        std::vector<std::size_t> deferred;
+    };
+
+    tbb::enumerable_thread_specific<Thread_data> tls_data(
+        [&]() { return Thread_data{++nb_threads, hint, 1u, {}, {}, {}}; });
+
+    auto try_lock_vertex = [&](Vertex_handle v, Thread_data & data) -> bool
+    {
+        const std::size_t i = locks.index(&*v);
+        bool newly_locked;
+        if( ! locks.try_lock(i, data.id, newly_locked) )
+            return false;
+        if( newly_locked )
+            data.locked.push_back(i);
+        return true;
+    };
+
+    auto try_lock_full_cell = [&](Full_cell_handle c, Thread_data & data) -> bool
+    {
+        for( int i = 0; i <= cur_dim; ++i )
+        {
+            Vertex_handle v = c->vertex(i);
+            if( ! dt.is_infinite(v) && ! try_lock_vertex(v, data) )
+                return false;
+        }
+        return true;
+    };
+
+    auto unlock_all = [&](Thread_data & data)
+    {
+        for( std::size_t i : data.locked )
+            locks.unlock(i);
+        data.locked.clear();
+    };
+
+    // Marks the full cells of the conflict zone as visited, and returns a
+    // facet of its boundary. The marks are left if the zone is complete.
+    auto gather_conflict_zone = [&](const Conflict_pred & pred, Full_cell_handle c,
+                                    Facet & boundary, Thread_data & data) -> Insertion_result
+    {
+        data.cells.clear();
+        data.cells.push_back(c);
+        c->tds_data().mark_visited();
+        bool has_boundary = false;
+        Insertion_result result = INSERTED;
+        for( std::size_t k = 0; k < data.cells.size() && result == INSERTED; ++k )
+        {
+            Full_cell_handle h = data.cells[k];
+            for( int i = 0; i <= cur_dim; ++i )
+            {
+                Full_cell_handle n = h->neighbor(i);
+                if( dt.is_infinite(n) )
+                {
+                    result = DEFERRED;
+                    break;
+                }
+                // the marks of |n| are only read once |n| is locked
+                if( ! try_lock_full_cell(n, data) )
+                {
+                    result = LOCK_FAILED;
+                    break;
+                }
+                if( n->tds_data().is_visited() )
+                    continue;
+                if( pred(n) )
+                {
+                    n->tds_data().mark_visited();
+                    data.cells.push_back(n);
+                }
+                else if( ! has_boundary )
+                {
+                    boundary = Facet(h, i);
+                    has_boundary = true;
+                }
+            }
+        }
+        if( result != INSERTED )
+            for( Full_cell_handle h : data.cells )
+                h->tds_data().clear_visited();
+        return result;
+    };
+
+    auto try_insert = [&](std::size_t i, Thread_data & data) -> Insertion_result
+    {
+        const Point & p = points[i];
+
+        // the full cell of the hint is only modified by a thread which has locked the hint
+        if( ! try_lock_vertex(data.hint, data) )
+            return LOCK_FAILED;
+        Full_cell_handle c = data.hint->full_cell();
+        if( dt.is_infinite(c) )
+            c = c->neighbor(c->index(dt.infinite_vertex()));
+        if( ! try_lock_full_cell(c, data) )
+            return LOCK_FAILED;
+
+        // Remembering stochastic walk, as in Triangulation::do_locate()
+        Full_cell_handle previous;
+        for( ;; )
+        {
+            data.random_state ^= data.random_state << 13;
+            data.random_state ^= data.random_state >> 17;
+            data.random_state ^= data.random_state << 5;
+            const int start = static_cast<int>(data.random_state % (cur_dim + 1));
+
+            Full_cell_handle next;
+            for( int j = 0; j <= cur_dim; ++j )
+            {
+                const int f = ( start + j ) % ( cur_dim + 1 );
+                Full_cell_handle n = c->neighbor(f);
+                if( n == previous )
+                    continue;
+                Substitute spivi(c->vertex(f), &p);
+                if( NEGATIVE == ori(boost::make_transform_iterator(c->vertices_begin(), spivi),
+                                    boost::make_transform_iterator(c->vertices_begin() + cur_dim + 1,
+                                                                   spivi)) )
+                {
+                    next = n;
+                    break;
+                }
+            }
+            if( Full_cell_handle() == next )
+                break;
+            if( dt.is_infinite(next) )
+                return DEFERRED;
+            if( ! try_lock_full_cell(next, data) )
+                return LOCK_FAILED;
+            previous = c;
+            c = next;
+        }
+
+        // |p| is in the closure of |c|: |c| is in conflict with |p|
+        // unless |p| is one of its vertices
+        Conflict_pred pred(dt, p, ori, side);
+        if( ! pred(c) )
+            return DEFERRED;
+
+        Facet boundary;
+        const Insertion_result result = gather_conflict_zone(pred, c, boundary, data);
+        if( result != INSERTED )
+            return result;
+
+        // the new full cells have all their vertices but the new one locked
+        data.hint = dt.insert_in_hole(p, data.cells.begin(), data.cells.end(), boundary);
+        return INSERTED;
+    };
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(first, last),
+                      [&](const tbb::blocked_range<std::size_t> & r)
+                      {
+                          Thread_data & data = tls_data.local();
+                          for( std::size_t i = r.begin(); i != r.end(); ++i )
+                          {
+                              Insertion_result result;
+                              int nb_failures = 0;
+                              do
+                              {
+                                  result = try_insert(i, data);
+                                  unlock_all(data);
+                                  if( result == LOCK_FAILED && ++nb_failures >= max_nb_failures )
+                                      result = DEFERRED;
+                                  else if( result == LOCK_FAILED )
+                                      std::this_thread::yield();
+                              }
+                              while( result == LOCK_FAILED );
+
+                              if( result == DEFERRED )
+                                  data.deferred.push_back(i);
+                          }
+                      });
+
+    std::vector<std::size_t> deferred;
+    for( const Thread_data & data : tls_data )
+        deferred.insert(deferred.end(), data.deferred.begin(), data.deferred.end());
+    std::sort(deferred.begin(), deferred.end());
+    return deferred;
+}
+
+// Inserts the points `points`, sorted spatially, in the Delaunay
+// triangulation `dt`. A sample of points is inserted sequentially, then
+// the rest in parallel, except the points deferred by `insert_in_parallel()`,
+// which are inserted sequentially at the end.
+template< class DT, class PointRange >
+void parallel_insert(DT & dt, const PointRange & points)
+{
+    typedef typename DT::Vertex_handle                  Vertex_handle;
+    typedef typename DT::Full_cell_handle               Full_cell_handle;
+
+    const std::size_t nb_points = points.size();
+    std::size_t i = 0;
+    Vertex_handle v;
+    Full_cell_handle hint;
+
+    // The first points are a random sample (see `spatial_sort()`), whose
+    // convex hull is almost the one of all the points
+    const std::size_t nb_points_seq = (std::min)(nb_points, std::size_t(1000));
+    while( i < nb_points_seq
+        || ( dt.current_dimension() < dt.maximal_dimension() && i < nb_points ) )
+    {
+        v = dt.insert(points[i++], hint);
+        hint = v->full_cell();
+    }
+    if( i == nb_points )
+        return;
+
+    std::vector<std::size_t> deferred = insert_in_parallel(dt, points, i, nb_points, v);
+
+    // the full cell |hint| may have been deleted
+    hint = Full_cell_handle();
+    for( std::size_t j : deferred )
+        hint = dt.insert(points[j], hint)->full_cell();
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace Triangulation
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERT_H
@@ -20,6 +20,9 @@
 #include <CGAL/Default.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Compact_container.h>
+#include <CGAL/Concurrent_compact_container.h>
+#include <CGAL/Indexed_compact_container.h>
+#include <CGAL/tags.h>
 #include <CGAL/Triangulation_face.h>
 #include <CGAL/Triangulation_ds_vertex.h>
 #include <CGAL/Triangulation_ds_full_cell.h>
@@ -31,31 +34,53 @@
 #include <vector>
 #include <queue>
 #include <set>
+#include <type_traits>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/scalable_allocator.h>
+#endif
 
 namespace CGAL {
 
+namespace internal {
+namespace Triangulation {
+
+// Whether a full cell base class stores indices instead of handles
+// (see TDS_full_cell_indexed_storage_policy).
+template< class Fcb, class = void >
+struct Has_indexed_storage : public std::false_type {};
+
+template< class Fcb >
+struct Has_indexed_storage< Fcb, std::void_t<typename Fcb::Has_indexed_storage> >
+: public std::bool_constant<Fcb::Has_indexed_storage::value> {};
+
+} // namespace Triangulation
+} // namespace internal
+
 template<   class Dimen,
             class Vb = Default,
-            class Fcb = Default >
+            class Fcb = Default,
+            class Concurrency_tag_ = Sequential_tag >
 class Triangulation_data_structure
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb>                     Self;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Concurrency_tag_>   Self;
     typedef typename Default::Get<Vb, Triangulation_ds_vertex<> >::type     V_base;
     typedef typename Default::Get<Fcb, Triangulation_ds_full_cell<> >::type  FC_base;
 
 public:
     typedef typename V_base::template Rebind_TDS<Self>::Other   Vertex; /* Concept */
     typedef typename FC_base::template Rebind_TDS<Self>::Other  Full_cell; /* Concept */
+    typedef Concurrency_tag_                                    Concurrency_tag;
 
   // Tools to change the Vertex and Cell types of the TDS.
   template < typename Vb2 >
   struct Rebind_vertex {
-    typedef Triangulation_data_structure<Dimen, Vb2, Fcb>  Other;
+    typedef Triangulation_data_structure<Dimen, Vb2, Fcb, Concurrency_tag>  Other;
   };
 
   template < typename Fcb2 >
   struct Rebind_full_cell {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb2>  Other;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb2, Concurrency_tag>  Other;
   };
 
 
@@ -79,9 +104,41 @@ public:
         // affectation.
     };
 
+    // The full cells refer to the vertices and to their neighbors with 32-bit
+    // indices, and the vertices and full cells are stored in
+    // Indexed_compact_containers (NOT DOCUMENTED).
+    static constexpr bool has_indexed_storage =
+        internal::Triangulation::Has_indexed_storage<FC_base>::value;
+
+    static_assert
+      (!(has_indexed_storage && std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+       "TDS_full_cell_indexed_storage_policy cannot be used with `Parallel_tag`.");
+
 protected:
-    typedef Compact_container<Vertex>   Vertex_container;
-    typedef Compact_container<Full_cell>  Full_cell_container;
+    // N.B.: Concurrent_compact_container requires TBB
+#ifdef CGAL_LINKED_WITH_TBB
+    template < class T >
+    using Container = std::conditional_t<
+        has_indexed_storage,
+        Indexed_compact_container<T>,
+        std::conditional_t<
+            std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+            Concurrent_compact_container<T, tbb::scalable_allocator<T> >,
+            Compact_container<T> > >;
+#else
+    static_assert
+      (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+       "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
+       "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
+    template < class T >
+    using Container = std::conditional_t<
+        has_indexed_storage,
+        Indexed_compact_container<T>,
+        Compact_container<T> >;
+#endif
+
+    typedef Container<Vertex>           Vertex_container;
+    typedef Container<Full_cell>        Full_cell_container;
 
 public:
     typedef Dimen                      Maximal_dimension;
@@ -147,6 +204,17 @@ private:
         full_cells_.clear();
     }
 
+    // The indexed full cells find their vertices from the container of the
+    // full cells, and conversely.
+    void associate_containers()
+    {
+        if constexpr (has_indexed_storage)
+        {
+            full_cells_.set_associated_container(vertices_);
+            vertices_.set_associated_container(full_cells_);
+        }
+    }
+
     template < class Dim_tag >
     struct get_maximal_dimension
     {
@@ -165,6 +233,7 @@ public:
           vertices_(), full_cells_()
     {
         CGAL_assertion_msg(dmax_ > 0, "maximal dimension must be positive.");
+        associate_containers();
     }
 
     ~Triangulation_data_structure()
@@ -174,29 +243,29 @@ public:
 
     Triangulation_data_structure(const Triangulation_data_structure & tds)
         : dmax_(tds.dmax_), dcur_(tds.dcur_),
-        vertices_(tds.vertices_), full_cells_(tds.full_cells_)
+        vertices_(), full_cells_()
     {
+        associate_containers();
         typedef std::map<Vertex_const_handle, Vertex_handle> V_map;
         typedef std::map<Full_cell_const_handle, Full_cell_handle> C_map;
         V_map vmap;
         C_map cmap;
+        // The copies are stored in the same order as the originals. Their
+        // handles are set from the originals, as indices cannot be copied.
         Vertex_const_iterator vfrom = tds.vertices_begin();
-        Vertex_iterator vto = vertices_begin();
         Full_cell_const_iterator cfrom = tds.full_cells_begin();
-        Full_cell_iterator cto = full_cells_begin();
-        while( vfrom != tds.vertices_end() )
-            vmap[vfrom++] = vto++;
-        while( cfrom != tds.full_cells_end() )
-            cmap[cfrom++] = cto++;
-        cto = full_cells_begin();
-        while( cto != full_cells_end() )
+        for( ; vfrom != tds.vertices_end(); ++vfrom )
+            vmap[vfrom] = vertices_.emplace(*vfrom);
+        for( ; cfrom != tds.full_cells_end(); ++cfrom )
+            cmap[cfrom] = full_cells_.emplace(*cfrom);
+        for( cfrom = tds.full_cells_begin(); cfrom != tds.full_cells_end(); ++cfrom )
         {
+            Full_cell_handle cto = cmap[cfrom];
             for( int i = 0; i <= (std::max)(0, current_dimension()); ++i )
             {
-                associate_vertex_with_full_cell(cto, i, vmap[cto->vertex(i)]);
-                cto->set_neighbor(i, cmap[cto->neighbor(i)]);
+                associate_vertex_with_full_cell(cto, i, vmap[cfrom->vertex(i)]);
+                cto->set_neighbor(i, cmap[cfrom->neighbor(i)]);
             }
-            ++cto;
         }
     }
 
@@ -622,10 +691,10 @@ public:
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE GATHERING METHODS
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_full_cells(const Face & f, OutputIterator out) const /* Concept */
 {
     // CGAL_expensive_precondition_msg(is_full_cell(f.full_cell()), "the facet does not belong to the Triangulation");
@@ -634,10 +703,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return out;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_full_cells(Vertex_const_handle v, OutputIterator out) const /* Concept */
 {
 //    CGAL_expensive_precondition(is_vertex(v));
@@ -647,10 +716,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return incident_full_cells(f, out);
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::star(const Face & f, OutputIterator out) const /* Concept */
 {
     // CGAL_precondition_msg(is_full_cell(f.full_cell()), "the facet does not belong to the Triangulation");
@@ -659,10 +728,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return out;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename TraversalPredicate, typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Facet
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Facet
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::gather_full_cells(Full_cell_handle start,
                     TraversalPredicate & tp,
                     OutputIterator & out) const /* Concept */
@@ -695,10 +764,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return ft;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator, typename Comparator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_faces(Vertex_const_handle v, int dim, OutputIterator out, Comparator cmp, bool upper_faces) const
 {
     CGAL_precondition( 0 < dim );
@@ -773,9 +842,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE REMOVAL METHODS
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::collapse_face(const Face & f) /* Concept */
 {
     const int fd = f.face_dimension();
@@ -795,9 +864,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return v;
 }
 
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 void
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::remove_decrease_dimension(Vertex_handle v, Vertex_handle star) /* Concept */
 {
     CGAL_assertion( current_dimension() >= -1 );
@@ -866,9 +935,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE INSERTION METHODS
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_full_cell(Full_cell_handle s) /* Concept */
 {
     CGAL_precondition(0 < current_dimension());
@@ -878,29 +947,31 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     const int cur_dim = current_dimension();
     Vertex_handle v = new_vertex();
     // the full_cell 'fc' is just used to store the handle to all the new full_cells.
-    Full_cell fc(maximal_dimension());
+    // the full cells of the star of v, as a full cell can only store its
+    // neighbors when it is in the container (see TDS_full_cell_indexed_storage_policy)
+    std::vector<Full_cell_handle> fc(cur_dim + 1);
     for( int i = 1; i <= cur_dim; ++i )
     {
         Full_cell_handle new_s = new_full_cell(s);
-        fc.set_neighbor(i, new_s);
+        fc[i] = new_s;
         associate_vertex_with_full_cell(new_s, i, v);
         s->vertex(i-1)->set_full_cell(new_s);
         set_neighbors(new_s, i, neighbor(s, i), mirror_index(s, i));
     }
-    fc.set_neighbor(0, s);
+    fc[0] = s;
     associate_vertex_with_full_cell(s, 0, v);
     for( int i = 0; i <= cur_dim; ++i )
         for( int j = 0; j <= cur_dim; ++j )
         {
             if( j == i ) continue;
-            set_neighbors(fc.neighbor(i), j, fc.neighbor(j), i);
+            set_neighbors(fc[i], j, fc[j], i);
         }
     return v;
 }
 
-template <class Dim, class Vb, class Fcb >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct >
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_face(const Face & f) /* Concept */
 {
     std::vector<Full_cell_handle> simps;
@@ -909,9 +980,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     incident_full_cells(f, out);
     return insert_in_hole(simps.begin(), simps.end(), Facet(f.full_cell(), f.index(0)));
 }
-template <class Dim, class Vb, class Fcb >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct >
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_facet(const Facet & ft) /* Concept */
 {
     Full_cell_handle s[2];
@@ -922,10 +993,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return insert_in_hole(s, s+2, Facet(s[0], i));
 }
 
-template <class Dim, class Vb, class Fcb >
+template <class Dim, class Vb, class Fcb, class Ct >
 template < typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Full_cell_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Full_cell_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_tagged_hole(Vertex_handle v, Facet f,
                         OutputIterator new_full_cells)
 {
@@ -1024,10 +1095,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
   return new_s;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename Forward_iterator, typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_hole(Forward_iterator start, Forward_iterator end, Facet f,
                  OutputIterator out) /* Concept */
 {
@@ -1043,19 +1114,19 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return v;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename Forward_iterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_hole(Forward_iterator start, Forward_iterator end, Facet f) /* Concept */
 {
     Emptyset_iterator out;
     return insert_in_hole(start, end, f, out);
 }
 
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 void
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::clear_visited_marks(Full_cell_handle start) const // NOT DOCUMENTED
 {
     CGAL_precondition(start != Full_cell_handle());
@@ -1079,8 +1150,8 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     }
 }
 
-template <class Dim, class Vb, class Fcb>
-void Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+void Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::do_insert_increase_dimension(Vertex_handle x, Vertex_handle star)
 {
     Full_cell_handle start = full_cells_begin();
@@ -1153,9 +1224,9 @@ void Triangulation_data_structure<Dim, Vb, Fcb>
         swap_me->swap_vertices(1, 2);
 }
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_increase_dimension(Vertex_handle star) /* Concept */
 {
     const int prev_cur_dim = current_dimension();
@@ -1198,8 +1269,8 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - VALIDITY CHECKS
 
-template <class Dimen, class Vb, class Fcb>
-bool Triangulation_data_structure<Dimen, Vb, Fcb>
+template <class Dimen, class Vb, class Fcb, class Ct>
+bool Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::is_valid(bool verbose, int /* level */) const /* Concept */
 {
     Full_cell_const_handle s, t;
@@ -1287,9 +1358,9 @@ bool Triangulation_data_structure<Dimen, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - INPUT / OUTPUT
 
 // NOT DOCUMENTED
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 template <class OutStream>
-void Triangulation_data_structure<Dim, Vb, Fcb>
+void Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::write_graph(OutStream & os)
 {
     std::vector<std::set<int> > edges;
@@ -1334,9 +1405,9 @@ void Triangulation_data_structure<Dim, Vb, Fcb>
 }
 
 // NOT DOCUMENTED...
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::istream &
-Triangulation_data_structure<Dimen, Vb, Fcb>
+Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::read_full_cells(std::istream & is, const std::vector<Vertex_handle> & vertices)
 {
     std::size_t m; // number of full_cells
@@ -1415,9 +1486,9 @@ Triangulation_data_structure<Dimen, Vb, Fcb>
 }
 
 // NOT DOCUMENTED...
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::ostream &
-Triangulation_data_structure<Dimen, Vb, Fcb>
+Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::write_full_cells(std::ostream & os, std::map<Vertex_const_handle, int> & index_of_vertex) const
 {
     std::map<Full_cell_const_handle, int> index_of_full_cell;
@@ -1472,9 +1543,9 @@ Triangulation_data_structure<Dimen, Vb, Fcb>
 
 // FUNCTIONS THAT ARE NOT MEMBER FUNCTIONS:
 
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::istream &
-operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
+operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb, Ct> & tr)
   // reads :
   // - the dimensions (maximal and current)
   // - the number of finite vertices
@@ -1484,7 +1555,7 @@ operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
   // of vertices, plus the non combinatorial information on each full_cell
   // - the neighbors of each full_cell by their index in the preceding list
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb> TDS;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Ct> TDS;
     typedef typename TDS::Vertex_handle         Vertex_handle;
 
     // read current dimension and number of vertices
@@ -1522,9 +1593,9 @@ operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
     return tr.read_full_cells(is, vertices);
 }
 
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::ostream &
-operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
+operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb, Ct> & tr)
   // writes :
   // - the dimensions (maximal and current)
   // - the number of finite vertices
@@ -1534,7 +1605,7 @@ operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb>
   // of vertices, plus the non combinatorial information on each full_cell
   // - the neighbors of each full_cell by their index in the preceding list
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb> TDS;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Ct> TDS;
     typedef typename TDS::Vertex_const_handle         Vertex_handle;
     typedef typename TDS::Vertex_const_iterator       Vertex_iterator;
 
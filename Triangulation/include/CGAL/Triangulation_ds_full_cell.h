@@ -18,10 +18,14 @@
 
 #include <CGAL/TDS_full_cell_default_storage_policy.h>
 #include <CGAL/TDS_full_cell_mirror_storage_policy.h>
+#include <CGAL/TDS_full_cell_indexed_storage_policy.h>
 #include <CGAL/Triangulation/internal/Dummy_TDS.h>
 #include <CGAL/Dimension.h>
 #include <CGAL/Default.h>
 #include <CGAL/array.h>
+#include <CGAL/tags.h>
+
+#include <type_traits>
 
 namespace CGAL {
 
@@ -46,17 +50,16 @@ public:
     {
         typedef Triangulation_ds_full_cell<TDS2, FullCellStoragePolicy> Other;
     };
+    // NOT DOCUMENTED: whether the TDS must use Indexed_compact_containers
+    typedef Boolean_tag<std::is_same<Storage_policy,
+                                     TDS_full_cell_indexed_storage_policy>::value>
+                                                   Has_indexed_storage;
 
 private: // STORAGE
     typedef TFC_data< Vertex_handle, Full_cell_handle,
                       Maximal_dimension, Storage_policy >   Combinatorics;
     friend struct TFC_data< Vertex_handle, Full_cell_handle,
                       Maximal_dimension, Storage_policy >;
-    // array of vertices
-    typedef typename Combinatorics::Vertex_handle_array     Vertex_handle_array;
-    // neighbor simplices
-    typedef typename Combinatorics::Full_cell_handle_array    Full_cell_handle_array;
-
     // NOT DOCUMENTED...
     typename Combinatorics::Xor_type xor_of_vertices(const int cur_dim) const
     {
@@ -64,7 +67,7 @@ private: // STORAGE
     }
 
 public:
-    typedef typename Vertex_handle_array::const_iterator    Vertex_handle_const_iterator;
+    typedef typename Combinatorics::Vertex_handle_const_iterator Vertex_handle_const_iterator;
     typedef Vertex_handle_const_iterator    Vertex_handle_iterator; /* Concept */
 
     Triangulation_ds_full_cell(const int dmax) /* Concept */
@@ -87,29 +90,29 @@ public:
 
     int maximal_dimension() const /* Concept */
     {
-        return static_cast<int>(vertices().size() - 1);
+        return combinatorics_.dimension();
     }
 
     Vertex_handle_const_iterator vertices_begin() const /* Concept */
     {
-        return vertices().begin();
+        return combinatorics_.vertices_begin();
     }
 
     Vertex_handle_const_iterator vertices_end() const /* Concept */
     {
-        return vertices().end();
+        return combinatorics_.vertices_end();
     }
 
     Vertex_handle vertex(const int i) const /* Concept */
     {
         CGAL_precondition(0<=i && i<=maximal_dimension());
-        return vertices()[i];
+        return combinatorics_.vertex(i);
     }
 
     Full_cell_handle neighbor(const int i) const /* Concept */
     {
         CGAL_precondition(0<=i && i<=maximal_dimension());
-        return neighbors()[i];
+        return combinatorics_.neighbor(i);
     }
 
     int mirror_index(const int i) const /* Concept */
@@ -148,13 +151,13 @@ public:
     void set_vertex(const int i, Vertex_handle v) /* Concept */
     {
         CGAL_precondition(0<=i && i<=maximal_dimension());
-        vertices()[i] = v;
+        combinatorics_.set_vertex(i, v);
     }
 
     void set_neighbor(const int i, Full_cell_handle s) /* Concept */
     {
         CGAL_precondition(0<=i && i<=maximal_dimension());
-        neighbors()[i] = s;
+        combinatorics_.set_neighbor(i, s);
     }
 
     void set_mirror_index(const int i, const int index) /* Concept */
@@ -205,6 +208,10 @@ public:
 
     void*   for_compact_container() const { return combinatorics_.for_compact_container(); }
     void    for_compact_container(void* p){ combinatorics_.for_compact_container(p); }
+    std::uint32_t for_indexed_compact_container() const
+    { return combinatorics_.for_indexed_compact_container(); }
+    void for_indexed_compact_container(std::uint32_t w)
+    { combinatorics_.for_indexed_compact_container(w); }
 
     bool is_valid(bool verbose = false, int = 0) const /* Concept */
     {
@@ -242,12 +249,6 @@ public:
     }
 
 private:
-    // access to data members:
-    Full_cell_handle_array & neighbors() {return combinatorics_.neighbors_; }
-    const Full_cell_handle_array & neighbors() const {return combinatorics_.neighbors_; }
-    Vertex_handle_array & vertices() {return combinatorics_.vertices_; }
-    const Vertex_handle_array & vertices() const {return combinatorics_.vertices_; }
-
     // DATA MEMBERS
     // With the Itanium ABI, [[no_unique_address]] allows tda_data_ to reuse the
     // padding bytes at the end of combinatorics_ when using the mirror policy.
@@ -300,6 +301,9 @@ public:
     {
         typedef Triangulation_ds_full_cell<TDS2, StoragePolicy> Other;
     };
+    typedef Boolean_tag<std::is_same<StoragePolicy,
+                                     TDS_full_cell_indexed_storage_policy>::value>
+                                                Has_indexed_storage;
     Vertex_handle_const_iterator vertices_begin();
     Vertex_handle_const_iterator vertices_end();
 };
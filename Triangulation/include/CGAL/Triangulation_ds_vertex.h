@@ -17,10 +17,75 @@
 #include <CGAL/disable_warnings.h>
 
 #include <CGAL/Compact_container.h>
+#include <CGAL/Indexed_compact_container.h>
 #include <CGAL/Triangulation/internal/Dummy_TDS.h>
 
+#include <cstdint>
+#include <type_traits>
+
 namespace CGAL {
 
+namespace internal {
+namespace Triangulation {
+
+template< typename Handle, typename = void >
+struct Is_indexed_handle : public std::false_type {};
+
+template< typename Handle >
+struct Is_indexed_handle< Handle, std::void_t<typename Handle::CC> >
+: public Is_indexed_compact_container<typename Handle::CC> {};
+
+// The incident full cell of a vertex, stored as a handle...
+template< typename Vertex_handle, typename Full_cell_handle,
+          bool = Is_indexed_handle<Full_cell_handle>::value >
+class Vertex_full_cell_storage
+{
+    Full_cell_handle s_;
+public:
+    Vertex_full_cell_storage(Full_cell_handle s) : s_(s) {}
+    Full_cell_handle get() const { return s_; }
+    void set(Full_cell_handle s) { s_ = s; }
+
+    void*   for_compact_container() const { return s_.for_compact_container(); }
+    void    for_compact_container(void *p){ s_.for_compact_container(p); }
+};
+
+// ... or as its index, shifted by 2 bits, when the vertices and the full
+// cells are stored in Indexed_compact_containers (see
+// TDS_full_cell_indexed_storage_policy). The 2 least significant bits are
+// used by the container, and the full cell is found from the address of
+// the vertex, which must be in the container of the TDS.
+template< typename Vertex_handle, typename Full_cell_handle >
+class Vertex_full_cell_storage< Vertex_handle, Full_cell_handle, true >
+{
+    typedef typename Vertex_handle::CC      Vertex_container;
+    typedef typename Full_cell_handle::CC   Full_cell_container;
+    static constexpr std::uint32_t null_index = Full_cell_container::null_index;
+
+    std::uint32_t w_;
+public:
+    Vertex_full_cell_storage(Full_cell_handle s) { set(s); }
+    Full_cell_handle get() const
+    {
+        const std::uint32_t k = w_ >> 2;
+        if( k == null_index )
+            return Full_cell_handle();
+        return Vertex_container::template
+            associated_element_of_member<Full_cell_container>(this, k);
+    }
+    void set(Full_cell_handle s)
+    {
+        w_ = ( s == Full_cell_handle() ) ? (null_index << 2)
+                                         : std::uint32_t(Full_cell_container::index(s)) << 2;
+    }
+
+    std::uint32_t for_indexed_compact_container() const { return w_; }
+    void for_indexed_compact_container(std::uint32_t w) { w_ = w; }
+};
+
+} // namespace Triangulation
+} // namespace internal
+
 /* The template parameter TDS must be a model of the concept
  * 'TriangulationDataStructure' that stores vertices of type
  * 'Triangulation_ds_vertex<TDS>'
@@ -33,6 +98,7 @@ class Triangulation_ds_vertex
 public:
     typedef TDS                             Triangulation_data_structure;
     typedef typename TDS::Full_cell_handle  Full_cell_handle; /* Concept */
+    typedef typename TDS::Vertex_handle     Vertex_handle;
 
     template <typename TDS2>
     struct Rebind_TDS /* Concept */
@@ -41,7 +107,8 @@ public:
     };
 
 protected: // DATA MEMBERS
-    Full_cell_handle full_cell_; // A handle to an incident full_cell
+    internal::Triangulation::
+        Vertex_full_cell_storage<Vertex_handle, Full_cell_handle> full_cell_; // An incident full_cell
 
 public:
     // Constructs a vertex with incident full_cell 's'
@@ -50,20 +117,20 @@ public:
         CGAL_assertion( Full_cell_handle() != s );
     }
     // Constructs a vertex with no incident full_cell
-    Triangulation_ds_vertex() : full_cell_() {} /* Concept */
+    Triangulation_ds_vertex() : full_cell_(Full_cell_handle()) {} /* Concept */
 
     ~Triangulation_ds_vertex() {}
 
     /// Set 's' as an incident full_cell
     void set_full_cell(Full_cell_handle s) /* Concept */
     {
-        full_cell_ = s;
+        full_cell_.set(s);
     }
 
     /// Returns a full_cell incident to the vertex
     Full_cell_handle full_cell() const /* Concept */
     {
-        return full_cell_;
+        return full_cell_.get();
     }
 
     bool is_valid(bool verbose = false, int /* level */ = 0) const /* Concept */
@@ -103,6 +170,10 @@ public: // FOR MEMORY MANAGEMENT
 
     void*   for_compact_container() const { return full_cell_.for_compact_container(); }
     void    for_compact_container(void *p){ full_cell_.for_compact_container(p); }
+    std::uint32_t for_indexed_compact_container() const
+    { return full_cell_.for_indexed_compact_container(); }
+    void for_indexed_compact_container(std::uint32_t w)
+    { full_cell_.for_indexed_compact_container(w); }
 
 };  // end of Triangulation_ds_vertex
 
@@ -0,0 +1,137 @@
+#include <CGAL/config.h>
+
+#include <CGAL/Epick_d.h>
+#include <CGAL/Delaunay_triangulation.h>
+#include <CGAL/Triangulation_data_structure.h>
+#include <CGAL/point_generators_d.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <tbb/global_control.h>
+
+template< typename DT >
+std::set<std::vector<double> > full_cell_set(const DT & dt)
+{
+    // the finite full cells, as sorted lists of coordinates of their vertices
+    std::set<std::vector<double> > cells;
+    for( auto c = dt.finite_full_cells_begin(); c != dt.finite_full_cells_end(); ++c )
+    {
+        std::vector<std::vector<double> > vertices;
+        for( int i = 0; i <= dt.current_dimension(); ++i )
+        {
+            const auto & p = c->vertex(i)->point();
+            vertices.emplace_back(p.cartesian_begin(), p.cartesian_end());
+        }
+        std::sort(vertices.begin(), vertices.end());
+        std::vector<double> key;
+        for( const auto & v : vertices )
+            key.insert(key.end(), v.begin(), v.end());
+        cells.insert(key);
+    }
+    return cells;
+}
+
+template< typename DT, typename DT_other >
+void check_same(const DT & dt, const DT_other & other)
+{
+    assert(other.is_valid());
+    assert(other.current_dimension() == dt.current_dimension());
+    assert(other.number_of_vertices() == dt.number_of_vertices());
+    assert(other.number_of_finite_full_cells() == dt.number_of_finite_full_cells());
+    assert(full_cell_set(other) == full_cell_set(dt));
+}
+
+template< int D >
+void test(const int N, CGAL::Random & rng)
+{
+    typedef CGAL::Epick_d<CGAL::Dimension_tag<D> >              K;
+    typedef typename K::Point_d                                 Point;
+    typedef CGAL::Delaunay_triangulation<K>                     DT;
+    typedef CGAL::Triangulation_data_structure<CGAL::Dimension_tag<D>,
+                CGAL::Triangulation_vertex<K>,
+                CGAL::Triangulation_full_cell<K>,
+                CGAL::Parallel_tag>                             TDS_parallel;
+    typedef CGAL::Delaunay_triangulation<K, TDS_parallel>       DT_parallel;
+    typedef CGAL::Triangulation_data_structure<CGAL::Dimension_tag<D>,
+                CGAL::Triangulation_vertex<K>,
+                CGAL::Triangulation_full_cell<K, CGAL::No_full_cell_data,
+                    CGAL::Triangulation_ds_full_cell<void,
+                        CGAL::TDS_full_cell_indexed_storage_policy> > >
+                                                                TDS_indexed;
+    typedef CGAL::Delaunay_triangulation<K, TDS_indexed>        DT_indexed;
+
+    std::cout << "Testing dimension " << D << " with " << N << " points" << std::endl;
+
+    // random points, duplicates and cospherical points
+    std::vector<Point> points;
+    CGAL::Random_points_in_cube_d<Point> gen(D, 1., rng);
+    for( int i = 0; i < N; ++i )
+        points.push_back(*gen++);
+    for( int i = 0; i < N / 20; ++i )
+        points.push_back(points[7 * i]);
+    for( int i = 0; i < N / 10; ++i )
+    {
+        std::vector<double> coords(D);
+        for( int j = 0; j < D; ++j )
+            coords[j] = double(rng.get_int(0, 5)) / 4.;
+        points.push_back(Point(coords.begin(), coords.end()));
+    }
+
+    DT dt(D);
+    dt.insert(points.begin(), points.end());
+    assert(dt.is_valid());
+
+    DT_parallel dt_parallel(D);
+    dt_parallel.insert(points.begin(), points.end());
+    check_same(dt, dt_parallel);
+
+    DT_indexed dt_indexed(D);
+    dt_indexed.insert(points.begin(), points.end());
+    check_same(dt, dt_indexed);
+
+    // copies keep the indexed storage consistent
+    DT_indexed dt_indexed_copy(dt_indexed);
+    check_same(dt, dt_indexed_copy);
+
+    // small inputs are inserted sequentially
+    DT_parallel dt_small(D);
+    dt_small.insert(points.begin(), points.begin() + 10);
+    assert(dt_small.is_valid());
+    assert(dt_small.number_of_vertices() == 10);
+}
+
+int main()
+{
+    CGAL::Random rng(0);
+    std::cout << "Random seed: " << rng.get_seed() << std::endl;
+
+    for( int nb_threads : { 1, 2, 4 } )
+    {
+        std::cout << "Testing with " << nb_threads << " threads" << std::endl;
+        tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+
+        test<2>(5000, rng);
+        test<3>(5000, rng);
+        test<4>(2000, rng);
+    }
+
+    std::cout << "done" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+    std::cout << "TBB not found, skipping the test of parallel insertion" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif
@@ -142,6 +142,19 @@ void test(const int d, const string & type)
                                               My_ds_full_cell> My_tds;  \
         test<My_tds>(DIM, string("mirror&dynamic")+string(#DIM)) ;}
 
+#define test_indexed_static(DIM) {  \
+    typedef CGAL::Triangulation_ds_full_cell<void, CGAL::TDS_full_cell_indexed_storage_policy> My_ds_full_cell;  \
+    typedef CGAL::Triangulation_data_structure<CGAL::Dimension_tag<DIM>, \
+                                              CGAL::Triangulation_ds_vertex<>, \
+                                              My_ds_full_cell> My_tds;  \
+        test<My_tds>(DIM, string("indexed&static")+string(#DIM)); }
+#define test_indexed_dyn(DIM) { \
+    typedef CGAL::Triangulation_ds_full_cell<void, CGAL::TDS_full_cell_indexed_storage_policy> My_ds_full_cell;  \
+    typedef CGAL::Triangulation_data_structure<CGAL::Dynamic_dimension_tag, \
+                                              CGAL::Triangulation_ds_vertex<>, \
+                                              My_ds_full_cell> My_tds;  \
+        test<My_tds>(DIM, string("indexed&dynamic")+string(#DIM)) ;}
+
 
 int main()
 {
@@ -173,6 +186,16 @@ int main()
     test_mirror_dyn(2);
     test_mirror_dyn(1);
 
+    test_indexed_static(4);
+    test_indexed_static(3);
+    test_indexed_static(2);
+    test_indexed_static(1);
+
+    test_indexed_dyn(4);
+    test_indexed_dyn(3);
+    test_indexed_dyn(2);
+    test_indexed_dyn(1);
+
     cout << std::endl;
     return 0;
 }
@@ -149,6 +149,10 @@ Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
 following the order of `PointInputIterator`, as `spatial_sort()`
 is used to improve efficiency.
+If the triangulation data structure has `Parallel_tag` as `Concurrency_tag`
+(see `Triangulation_data_structure_2`) and TBB is available, the insertion is
+performed in parallel. The resulting triangulation is the same as the one obtained
+with a sequential insertion.
 \tparam PointInputIterator must be an input iterator with the value type `Point`.
 */
 template < class PointInputIterator >
@@ -163,6 +167,10 @@ is used to improve efficiency.
 Given a pair `(p,i)`, the vertex `v` storing `p` also stores `i`, that is
 `v.point() == p` and `v.info() == i`. If several pairs have the same point,
 only one vertex is created, and one of the objects of type `Vertex::Info` will be stored in the vertex.
+If the triangulation data structure has `Parallel_tag` as `Concurrency_tag`
+(see `Triangulation_data_structure_2`) and TBB is available, the insertion is
+performed in parallel. The resulting triangulation is the same as the one obtained
+with a sequential insertion.
 \pre `Vertex` must be model of the concept `TriangulationVertexBaseWithInfo_2`.
 
 \tparam PointWithInfoInputIterator must be an input iterator with the value type `std::pair<Point,Vertex::Info>`.
@@ -177,6 +185,21 @@ removes the vertex from the triangulation.
 */
 void remove(Vertex_handle v);
 
+/*!
+removes the vertices in the range `[first, beyond)` from the triangulation,
+and returns the number of vertices removed.
+
+If the triangulation data structure has `Parallel_tag` as `Concurrency_tag`
+and TBB is available, the vertices are removed in parallel, each thread locking the incident faces
+of the vertex it removes. The vertices of the convex hull are removed
+sequentially afterwards.
+
+\tparam InputIterator must be an input iterator with value type `Vertex_handle`.
+\pre The vertices of the range are distinct and finite.
+*/
+template < class InputIterator >
+size_type remove(InputIterator first, InputIterator beyond);
+
 /// @}
 
 /// \name Displacement
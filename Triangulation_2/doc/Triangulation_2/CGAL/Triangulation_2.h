@@ -640,6 +640,27 @@ Locate_type& lt,
 int& li,
 Face_handle h =Face_handle() ) const;
 
+/*!
+Locates all the points of `points`, as the function above, and writes
+for each of them a `std::tuple<Face_handle, Locate_type, int>`, made of
+the returned face, `lt`, and `li`, to `out`, in the order of `points`.
+
+The points are spatially sorted, so that each point is located starting from
+the face of the previous one. If `ConcurrencyTag` is `Parallel_tag`,
+the sorted points are split between several threads, and the triangulation
+must not be modified until the function returns.
+
+\tparam ConcurrencyTag enables sequential versus parallel location.
+Possible values are `Sequential_tag` and `Parallel_tag`.
+\tparam PointRange is a model of `ConstRange` with value type `Point`.
+\tparam OutputIterator is an output iterator accepting `std::tuple<Face_handle, Locate_type, int>`.
+
+Returns the past-the-end output iterator.
+*/
+template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+OutputIterator
+locate(const PointRange& points, OutputIterator out, ConcurrencyTag tag) const;
+
 /*!
 Returns on which side of the oriented boundary of `f` lies
 the point `p`. \pre `f` is finite.
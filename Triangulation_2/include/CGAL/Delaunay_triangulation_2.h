@@ -17,6 +17,8 @@
 #include <CGAL/license/Triangulation_2.h>
 
 #include <CGAL/Triangulation_2.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insert_2.h>
+#include <CGAL/Triangulation_2/internal/Parallel_remove_2.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Object.h>
 
@@ -66,6 +68,11 @@ public:
                                                         Finite_vertices_iterator;
   typedef typename Triangulation::All_faces_iterator    All_faces_iterator;
 
+  // `Parallel_tag` if the data structure uses concurrent containers, in
+  // which case ranges of points are inserted in parallel
+  typedef typename internal::Tds_2_concurrency_tag<Tds>::type
+                                                        Concurrency_tag;
+
   //Tag to distinguish Delaunay from regular triangulations
   typedef Tag_false                                     Weighted_tag;
 
@@ -149,6 +156,35 @@ public:
 
   void remove(Vertex_handle v);
 
+  // removes the vertices of the range, in parallel
+  // if the data structure uses concurrent containers
+  template < class InputIterator >
+  size_type remove(InputIterator first, InputIterator beyond)
+  {
+    size_type n = this->number_of_vertices();
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      std::vector<Vertex_handle> vertices(first, beyond);
+      if (this->dimension() == 2)
+      {
+        Parallel_removal_policy policy { *this };
+        vertices = internal::remove_in_parallel_2(*this, vertices, policy);
+      }
+      for (Vertex_handle v : vertices)
+        remove(v);
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      for (; first != beyond; ++first)
+        remove(*first);
+    }
+
+    return n - this->number_of_vertices();
+  }
+
   // DISPLACEMENT
   void restore_Delaunay(Vertex_handle v);
 
@@ -315,15 +351,72 @@ public:
     size_type n = this->number_of_vertices();
 
     std::vector<Point> points (first, last);
-    spatial_sort (points.begin(), points.end(), geom_traits());
-    Face_handle f;
-    for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
-         p != end; ++p)
-      f = insert (*p, f)->face();
+    spatial_sort<Concurrency_tag> (points.begin(), points.end(), geom_traits());
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      parallel_insert(points.size(),
+                      [&](std::size_t i) -> const Point& { return points[i]; },
+                      [](std::size_t, Vertex_handle) {});
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      Face_handle f;
+      for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
+           p != end; ++p)
+        f = insert (*p, f)->face();
+    }
 
     return this->number_of_vertices() - n;
   }
 
+private:
+#ifdef CGAL_LINKED_WITH_TBB
+  // Used by `internal::parallel_insert_2()`. `new_vertex(i, v)` is called
+  // for each point `i` inserted as the vertex `v`, or equal to the vertex
+  // `v` (if `skip_duplicates` is `false`, the duplicates are inserted sequentially).
+  template <class NewVertex>
+  struct Parallel_insertion_policy
+  {
+    const Delaunay_triangulation_2& dt;
+    const NewVertex& new_vertex_visitor;
+    bool skip;
+
+    bool test_conflict(const Point& p, Face_handle f) const { return dt.test_conflict(p, f); }
+    bool accept_zone(const std::vector<Face_handle>&) const { return true; }
+    bool skip_duplicates() const { return skip; }
+    bool is_valid_hint(Vertex_handle) const { return true; }
+    void new_vertex(std::size_t i, Vertex_handle v) const { new_vertex_visitor(i, v); }
+  };
+
+  template <class PointOf, class NewVertex>
+  void parallel_insert(std::size_t nb_points,
+                       const PointOf& point_of,
+                       const NewVertex& new_vertex,
+                       bool skip_duplicates = true)
+  {
+    Parallel_insertion_policy<NewVertex> policy { *this, new_vertex, skip_duplicates };
+    internal::parallel_insert_2(*this, nb_points, point_of, policy);
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Used by `internal::remove_in_parallel_2()`: the removal of a vertex
+  // which is not on the convex hull only modifies its incident faces.
+  struct Parallel_removal_policy
+  {
+    Delaunay_triangulation_2& dt;
+
+    bool accept_vertex(Vertex_handle) const { return true; }
+    bool accept_star(const std::vector<Face_handle>&) const { return true; }
+    void remove(Vertex_handle v) const { dt.remove(v); }
+  };
+#endif // CGAL_LINKED_WITH_TBB
+
+public:
+
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
 private:
@@ -349,17 +442,36 @@ private:
     typedef typename Pointer_property_map<Point>::type Pmap;
     typedef Spatial_sort_traits_adapter_2<Geom_traits,Pmap> Search_traits;
 
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits(make_property_map(points),geom_traits()));
-
-    Vertex_handle v_hint;
-    Face_handle hint;
-    for (typename std::vector<std::size_t>::const_iterator
-      it = indices.begin(), end = indices.end();
-      it != end; ++it) {
-      v_hint = insert(points[*it], hint);
-      v_hint->info()=infos[*it];
-      hint=v_hint->face();
+    spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits(make_property_map(points),geom_traits()));
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      // Any of the points equal to a vertex may be the one inserted by the
+      // threads: the infos are assigned afterwards, in the order of `indices`,
+      // so that the info of a vertex is that of its last point, as in the
+      // sequential version.
+      std::vector<Vertex_handle> vertices(indices.size());
+      parallel_insert(indices.size(),
+                      [&](std::size_t i) -> const Point& { return points[indices[i]]; },
+                      [&](std::size_t i, Vertex_handle v) { vertices[i] = v; },
+                      false);
+      for(std::size_t i = 0; i < indices.size(); ++i)
+        vertices[i]->info() = infos[indices[i]];
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      Vertex_handle v_hint;
+      Face_handle hint;
+      for (typename std::vector<std::size_t>::const_iterator
+        it = indices.begin(), end = indices.end();
+        it != end; ++it) {
+        v_hint = insert(points[*it], hint);
+        v_hint->info()=infos[*it];
+        hint=v_hint->face();
+      }
     }
 
     return this->number_of_vertices() - n;
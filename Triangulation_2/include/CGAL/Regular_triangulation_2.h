@@ -15,6 +15,8 @@
 #include <CGAL/license/Triangulation_2.h>
 
 #include <CGAL/Triangulation_2.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insert_2.h>
+#include <CGAL/Triangulation_2/internal/Parallel_remove_2.h>
 #include <CGAL/Regular_triangulation_face_base_2.h>
 #include <CGAL/Regular_triangulation_vertex_base_2.h>
 
@@ -81,6 +83,11 @@ public:
   typedef typename Base::Face::Vertex_list     Vertex_list;
   typedef typename Vertex_list::iterator       Vertex_list_iterator;
 
+  // `Parallel_tag` if the data structure uses concurrent containers, in
+  // which case ranges of points are inserted in parallel
+  typedef typename internal::Tds_2_concurrency_tag<Tds>::type
+                                               Concurrency_tag;
+
 #ifndef CGAL_CFG_USING_BASE_MEMBER_BUG_2
   using Base::cw;
   using Base::ccw;
@@ -337,6 +344,35 @@ public:
                        Face_handle f = Face_handle());
   void remove(Vertex_handle v);
 
+  // removes the vertices of the range, in parallel
+  // if the data structure uses concurrent containers
+  template < class InputIterator >
+  size_type remove(InputIterator first, InputIterator beyond)
+  {
+    size_type n = number_of_vertices() + number_of_hidden_vertices();
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      std::vector<Vertex_handle> vertices(first, beyond);
+      if(dimension() == 2)
+      {
+        Parallel_removal_policy policy { *this };
+        vertices = internal::remove_in_parallel_2(*this, vertices, policy);
+      }
+      for(Vertex_handle v : vertices)
+        remove(v);
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      for(; first != beyond; ++first)
+        remove(*first);
+    }
+
+    return n - number_of_vertices() - number_of_hidden_vertices();
+  }
+
   All_vertices_iterator all_vertices_begin() const;
   All_vertices_iterator all_vertices_end() const;
   All_vertex_handles all_vertex_handles() const;
@@ -418,20 +454,101 @@ public:
     typedef boost::function_property_map<Construct_point_2, Weighted_point, Ret> fpmap;
     typedef CGAL::Spatial_sort_traits_adapter_2<Geom_traits, fpmap> Search_traits_2;
 
-    spatial_sort(points.begin(), points.end(),
-                 Search_traits_2(
-                   boost::make_function_property_map<Weighted_point, Ret, Construct_point_2>(
-                     geom_traits().construct_point_2_object()), geom_traits()));
+    spatial_sort<Concurrency_tag>(points.begin(), points.end(),
+                                  Search_traits_2(
+                                    boost::make_function_property_map<Weighted_point, Ret, Construct_point_2>(
+                                      geom_traits().construct_point_2_object()), geom_traits()));
 
-    Face_handle hint;
-    for(typename std::vector<Weighted_point>::const_iterator p = points.begin(),
-         end = points.end();
-         p != end; ++p)
-      hint = insert(*p, hint)->face();
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      parallel_insert(points.size(),
+                      [&](std::size_t i) -> const Weighted_point& { return points[i]; },
+                      [](std::size_t, Vertex_handle) {});
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      Face_handle hint;
+      for(typename std::vector<Weighted_point>::const_iterator p = points.begin(),
+           end = points.end();
+           p != end; ++p)
+        hint = insert(*p, hint)->face();
+    }
 
     return number_of_vertices() - n;
   }
 
+private:
+#ifdef CGAL_LINKED_WITH_TBB
+  // Used by `internal::parallel_insert_2()`: the points that would hide
+  // a vertex, or would be hidden, are inserted sequentially, as well as
+  // the points whose zone in conflict contains hidden vertices.
+  // `new_vertex(i, v)` is called for each point `i` inserted as the
+  // vertex `v` (possibly hidden).
+  template <class NewVertex>
+  struct Parallel_insertion_policy
+  {
+    const Regular_triangulation_2& rt;
+    const NewVertex& new_vertex_visitor;
+
+    bool test_conflict(const Weighted_point& p, Face_handle f) const
+    {
+      return rt.power_test(f, p, true) == ON_POSITIVE_SIDE;
+    }
+
+    bool accept_zone(const std::vector<Face_handle>& faces) const
+    {
+      for(Face_handle f : faces)
+        if(!f->vertex_list().empty())
+          return false;
+      return true;
+    }
+
+    bool skip_duplicates() const { return false; }
+    bool is_valid_hint(Vertex_handle v) const { return v != Vertex_handle() && !v->is_hidden(); }
+    void new_vertex(std::size_t i, Vertex_handle v) const { new_vertex_visitor(i, v); }
+  };
+
+  template <class PointOf, class NewVertex>
+  void parallel_insert(std::size_t nb_points,
+                       const PointOf& point_of,
+                       const NewVertex& new_vertex)
+  {
+    Parallel_insertion_policy<NewVertex> policy { *this, new_vertex };
+    internal::parallel_insert_2(*this, nb_points, point_of, policy);
+  }
+
+  // Used by `internal::remove_in_parallel_2()`. The vertices whose removal
+  // would reveal hidden vertices are deferred, so that the removal of a
+  // vertex which is not on the convex hull only modifies its incident faces.
+  struct Parallel_removal_policy
+  {
+    Regular_triangulation_2& rt;
+
+    bool accept_vertex(Vertex_handle v) const { return !v->is_hidden(); }
+
+    bool accept_star(const std::vector<Face_handle>& faces) const
+    {
+      for(Face_handle f : faces)
+        if(!f->vertex_list().empty())
+          return false;
+      return true;
+    }
+
+    // as `remove_2D()`, without `test_dim_down()`, which visits other faces
+    void remove(Vertex_handle v) const
+    {
+      std::list<Edge> hole;
+      rt.make_hole(v, hole);
+      rt.fill_hole_regular(hole);
+      rt.delete_vertex(v);
+    }
+  };
+#endif // CGAL_LINKED_WITH_TBB
+
+public:
+
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 private:
   //top stands for tuple-or-pair
@@ -487,23 +604,40 @@ private:
     typedef CGAL::Spatial_sort_traits_adapter_2<Gt, fpmap> Search_traits_2;
 
     Access_bare_point accessor(points, geom_traits().construct_point_2_object());
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits_2(
-                   boost::make_function_property_map<
-                     std::size_t, Ret, Access_bare_point>(accessor),
-                   geom_traits()));
-
-    Face_handle hint;
-    Vertex_handle v_hint;
-    for(typename std::vector<std::size_t>::const_iterator
-      it = indices.begin(), end = indices.end();
-      it != end; ++it)
+    spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits_2(
+                                    boost::make_function_property_map<
+                                      std::size_t, Ret, Access_bare_point>(accessor),
+                                    geom_traits()));
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      // the infos are assigned afterwards, in the order of `indices`, as
+      // the threads may insert any of the points equal to a vertex
+      std::vector<Vertex_handle> vertices(indices.size());
+      parallel_insert(indices.size(),
+                      [&](std::size_t i) -> const Weighted_point& { return points[indices[i]]; },
+                      [&](std::size_t i, Vertex_handle v) { vertices[i] = v; });
+      for(std::size_t i = 0; i < indices.size(); ++i)
+        if(vertices[i] != Vertex_handle())
+          vertices[i]->info() = infos[indices[i]];
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
     {
-      v_hint = insert(points[*it], hint);
+      Face_handle hint;
+      Vertex_handle v_hint;
+      for(typename std::vector<std::size_t>::const_iterator
+        it = indices.begin(), end = indices.end();
+        it != end; ++it)
+      {
+        v_hint = insert(points[*it], hint);
 
-      if(v_hint!=Vertex_handle()){
-        v_hint->info()=infos[*it];
-        hint=v_hint->face();
+        if(v_hint!=Vertex_handle()){
+          v_hint->info()=infos[*it];
+          hint=v_hint->face();
+        }
       }
     }
 
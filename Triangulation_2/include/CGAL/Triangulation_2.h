@@ -20,6 +20,9 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <iostream>
 
@@ -46,6 +49,12 @@
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 #include <boost/iterator/zip_iterator.hpp>
 #include <boost/utility/result_of.hpp>
+#include <boost/property_map/function_property_map.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/parallel_for.h>
+# include <tbb/blocked_range.h>
+#endif
 
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 #include <CGAL/STL_Extension/internal/info_check.h>
@@ -541,6 +550,89 @@ public:
 
 #endif // no CGAL_NO_STRUCTURAL_FILTERING
 
+  // Locates the points of the range `points`, and writes for each of them,
+  // in the order of the range, a `std::tuple<Face_handle, Locate_type, int>`
+  // giving the face, `lt`, and `li`, as the function above, to `out`.
+  // The points are spatially sorted, each one being located from the face of
+  // the previous one. With `Parallel_tag`, the sorted points are split
+  // between threads, and the triangulation must not be modified meanwhile.
+  template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  std::enable_if_t<std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+                   std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                   OutputIterator>
+  locate(const PointRange& points, OutputIterator out, ConcurrencyTag) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef decltype(*std::begin(points)) Reference;
+    if constexpr (std::is_lvalue_reference<Reference>::value)
+    {
+      std::vector<const Point*> pts;
+      for (const Point& p : points)
+        pts.push_back(std::addressof(p));
+      return locate_points<ConcurrencyTag>(
+               pts.size(), [&](std::size_t i) -> const Point& { return *pts[i]; }, out);
+    }
+    else
+    {
+      std::vector<Point> pts(std::begin(points), std::end(points));
+      return locate_points<ConcurrencyTag>(
+               pts.size(), [&](std::size_t i) -> const Point& { return pts[i]; }, out);
+    }
+  }
+
+private:
+  template <typename ConcurrencyTag, typename PointOf, typename OutputIterator>
+  OutputIterator locate_points(std::size_t n, const PointOf& point_of, OutputIterator out) const
+  {
+    typedef std::tuple<Face_handle, Locate_type, int>          Location;
+
+    // spatial sorting can only be applied to bare points
+    typedef typename boost::result_of<const Construct_point_2(const Point&)>::type Ret;
+    auto bare_point = [&](std::size_t i) -> Ret { return construct_point(point_of(i)); };
+    typedef boost::function_property_map<decltype(bare_point), std::size_t, Ret> Pmap;
+    typedef Spatial_sort_traits_adapter_2<Geom_traits, Pmap>   Search_traits_2;
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    spatial_sort<ConcurrencyTag>(order.begin(), order.end(),
+                                 Search_traits_2(Pmap(bare_point), geom_traits()));
+
+    std::vector<Location> locations(n);
+    auto locate_sorted = [&](std::size_t begin, std::size_t end)
+    {
+      Face_handle hint;
+      for (std::size_t k = begin; k < end; ++k)
+      {
+        Location& l = locations[order[k]];
+        hint = locate(point_of(order[k]), std::get<1>(l), std::get<2>(l), hint);
+        std::get<0>(l) = hint;
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_same<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, 256),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          locate_sorted(r.begin(), r.end());
+                        });
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      locate_sorted(0, n);
+    }
+
+    return std::copy(locations.begin(), locations.end(), out);
+  }
+
+public:
+
   //TRAVERSING : ITERATORS AND CIRCULATORS
   Finite_faces_iterator finite_faces_begin() const;
   Finite_faces_iterator finite_faces_end() const;
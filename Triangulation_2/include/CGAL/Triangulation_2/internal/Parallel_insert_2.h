@@ -0,0 +1,339 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mariette Yvinec
+
+#ifndef CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERT_2_H
+#define CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERT_2_H
+
+#include <CGAL/license/Triangulation_2.h>
+
+#include <CGAL/tags.h>
+#include <CGAL/enum.h>
+#include <CGAL/Bbox_2.h>
+#include <CGAL/assertions.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <CGAL/Spatial_lock_grid_2.h>
+#  include <tbb/blocked_range.h>
+#  include <tbb/enumerable_thread_specific.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Concurrency_tag, Concurrency_tag, false)
+
+// The concurrency tag of a model of `TriangulationDataStructure_2`:
+// `Sequential_tag` if it does not define any.
+template <class Tds, bool = Has_nested_type_Concurrency_tag<Tds>::value>
+struct Tds_2_concurrency_tag
+{
+  typedef Sequential_tag type;
+};
+
+template <class Tds>
+struct Tds_2_concurrency_tag<Tds, true>
+{
+  typedef typename Tds::Concurrency_tag type;
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Inserts the points of indices `[first, last)` given by `point_of` in the
+// triangulation `tr`, whose TDS must use concurrent containers. The points
+// are split in blocks inserted by different threads.
+//
+// The triangulation is locked through a grid on the plane: a thread owns a
+// face when it has locked the cells of its finite vertices. A point is
+// inserted by walking from the last vertex inserted by the thread, and
+// by starring the zone of the faces in conflict with it, while all the
+// faces that are visited are locked. If a lock cannot be taken, the locks
+// of the thread are released and the insertion is retried.
+//
+// The infinite faces are never modified: a point for which an infinite face
+// is met is deferred. So are the points that `policy` does not accept. The
+// indices of the deferred points are returned, in increasing order, and
+// must be inserted sequentially afterwards.
+//
+// `Policy` provides:
+// - `bool test_conflict(const Point&, Face_handle) const`
+// - `bool accept_zone(const std::vector<Face_handle>& faces) const`, to
+//   refuse a conflict zone with a valid topology;
+// - `bool skip_duplicates() const`, which tells if a point equal to a
+//   vertex is ignored (`true`) or deferred (`false`);
+// - `void new_vertex(std::size_t i, Vertex_handle v) const`, called when
+//   the point of index `i` has been inserted as `v`, zone still locked.
+template <class Tr, class PointOf, class Policy>
+std::vector<std::size_t>
+insert_in_parallel_2(Tr& tr,
+                     std::size_t first, std::size_t last,
+                     const PointOf& point_of,
+                     typename Tr::Vertex_handle hint,
+                     const Policy& policy,
+                     int num_grid_cells_per_axis = 64)
+{
+  typedef typename Tr::Vertex_handle                    Vertex_handle;
+  typedef typename Tr::Face_handle                      Face_handle;
+  typedef typename Tr::Edge                             Edge;
+  typedef Spatial_lock_grid_2<Tag_priority_blocking>    Lock_data_structure;
+
+  CGAL_precondition(tr.dimension() == 2);
+  CGAL_precondition(hint != Vertex_handle() && !tr.is_infinite(hint));
+
+  if(first >= last)
+    return std::vector<std::size_t>();
+
+  // The grid covers the points to insert, the other points are clamped
+  double xmin = CGAL::to_double(point_of(first).x()), xmax = xmin;
+  double ymin = CGAL::to_double(point_of(first).y()), ymax = ymin;
+  for(std::size_t i = first + 1; i < last; ++i)
+  {
+    const double x = CGAL::to_double(point_of(i).x());
+    const double y = CGAL::to_double(point_of(i).y());
+    xmin = (std::min)(xmin, x); xmax = (std::max)(xmax, x);
+    ymin = (std::min)(ymin, y); ymax = (std::max)(ymax, y);
+  }
+  if(xmax == xmin) xmax = xmin + 1.;
+  if(ymax == ymin) ymax = ymin + 1.;
+  Lock_data_structure lock_ds(Bbox_2(xmin, ymin, xmax, ymax), num_grid_cells_per_axis);
+
+  enum Insertion_result { INSERTED, DUPLICATE, DEFERRED, LOCK_FAILED };
+
+  struct Thread_data
+  {
+    bool* locked_cells; // the cells locked by the thread, to skip the others quickly
+    Vertex_handle hint;
+    std::uint32_t random_state;
+    std::vector<Face_handle> faces;
+    std::vector<Edge> edges;
+    std::vector<std::pair<Face_handle, int> > stack;
+    std::vector<std::size_t> deferred;
+  };
+
+  tbb::enumerable_thread_specific<Thread_data> tls_data(
+    [&]() { return Thread_data{lock_ds.get_thread_local_grid(), hint, 1u, {}, {}, {}, {}}; });
+
+  auto try_lock_point = [&](const auto& p, Thread_data& data) -> bool
+  {
+    const int cell_index = lock_ds.get_grid_index(p);
+    return data.locked_cells[cell_index] || lock_ds.try_lock(cell_index);
+  };
+
+  auto try_lock_face = [&](Face_handle f, Thread_data& data) -> bool
+  {
+    for(int i = 0; i < 3; ++i)
+    {
+      Vertex_handle v = f->vertex(i);
+      if(!tr.is_infinite(v) && !try_lock_point(v->point(), data))
+        return false;
+    }
+    return true;
+  };
+
+  // `f` is locked: only the vertex of its `i`-th neighbor opposite to `f` may not be
+  auto try_lock_neighbor = [&](Face_handle f, int i, Thread_data& data) -> bool
+  {
+    Vertex_handle v = tr.tds().mirror_vertex(f, i);
+    return tr.is_infinite(v) || try_lock_point(v->point(), data);
+  };
+
+  auto try_insert = [&](std::size_t i, Thread_data& data) -> Insertion_result
+  {
+    const auto& p = point_of(i);
+
+    if(!try_lock_point(p, data) || !try_lock_point(data.hint->point(), data))
+      return LOCK_FAILED;
+
+    Face_handle f = data.hint->face();
+    if(!try_lock_face(f, data))
+      return LOCK_FAILED;
+
+    // Remembering stochastic walk: we never go back through the edge we come from
+    Face_handle previous;
+    for(;;)
+    {
+      if(tr.is_infinite(f))
+        return DEFERRED;
+
+      data.random_state ^= data.random_state << 13;
+      data.random_state ^= data.random_state >> 17;
+      data.random_state ^= data.random_state << 5;
+      const int start = static_cast<int>(data.random_state % 3);
+
+      Face_handle next;
+      for(int k = 0; k < 3 && next == Face_handle(); ++k)
+      {
+        const int e = (start + k) % 3;
+        Face_handle n = f->neighbor(e);
+        if(n == previous)
+          continue;
+        if(tr.orientation(f->vertex(Tr::ccw(e))->point(), f->vertex(Tr::cw(e))->point(), p) == NEGATIVE)
+        {
+          if(!try_lock_neighbor(f, e, data))
+            return LOCK_FAILED;
+          next = n;
+        }
+      }
+      if(next == Face_handle())
+        break;
+      if(tr.is_infinite(next))
+        return DEFERRED;
+      previous = f;
+      f = next;
+    }
+
+    // `p` is in the closure of `f`
+    int nb_collinear = 0;
+    for(int e = 0; e < 3; ++e)
+      if(tr.orientation(f->vertex(Tr::ccw(e))->point(), f->vertex(Tr::cw(e))->point(), p) == COLLINEAR)
+        ++nb_collinear;
+    if(nb_collinear > 1)
+      return policy.skip_duplicates() ? DUPLICATE : DEFERRED;
+
+    if(!policy.test_conflict(p, f))
+      return DEFERRED;
+
+    // Faces in conflict and boundary of their union, in counterclockwise
+    // order, found as in `Delaunay_triangulation_2::get_conflicts_and_boundary()`
+    data.faces.clear();
+    data.edges.clear();
+    data.stack.clear();
+    data.faces.push_back(f);
+    for(int e = 2; e >= 0; --e)
+      data.stack.emplace_back(f, e);
+    while(!data.stack.empty())
+    {
+      const Face_handle fh = data.stack.back().first;
+      const int e = data.stack.back().second;
+      data.stack.pop_back();
+
+      Face_handle fn = fh->neighbor(e);
+      if(!try_lock_neighbor(fh, e, data))
+        return LOCK_FAILED;
+      if(tr.is_infinite(fn))
+        return DEFERRED;
+
+      const int j = fn->index(fh);
+      if(!policy.test_conflict(p, fn))
+      {
+        data.edges.emplace_back(fn, j);
+      }
+      else
+      {
+        // met twice if the zone surrounds a vertex, which would be hidden
+        if(std::find(data.faces.begin(), data.faces.end(), fn) != data.faces.end())
+          return DEFERRED;
+        data.faces.push_back(fn);
+        data.stack.emplace_back(fn, Tr::cw(j));
+        data.stack.emplace_back(fn, Tr::ccw(j));
+      }
+    }
+
+    // the zone must be a disk without interior vertex
+    if(data.edges.size() != data.faces.size() + 2 || !policy.accept_zone(data.faces))
+      return DEFERRED;
+
+    Vertex_handle v = tr.tds().create_vertex();
+    v->set_point(p);
+    tr.tds().star_hole(v, data.edges.begin(), data.edges.end(),
+                       data.faces.begin(), data.faces.end());
+    policy.new_vertex(i, v);
+    data.hint = v;
+    return INSERTED;
+  };
+
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(first, last),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      Thread_data& data = tls_data.local();
+                      for(std::size_t i = r.begin(); i != r.end(); ++i)
+                      {
+                        Insertion_result result;
+                        do
+                        {
+                          result = try_insert(i, data);
+                          lock_ds.unlock_all_points_locked_by_this_thread();
+                        }
+                        while(result == LOCK_FAILED);
+
+                        if(result == DEFERRED)
+                          data.deferred.push_back(i);
+                      }
+                    });
+
+  std::vector<std::size_t> deferred;
+  for(const Thread_data& data : tls_data)
+    deferred.insert(deferred.end(), data.deferred.begin(), data.deferred.end());
+  std::sort(deferred.begin(), deferred.end());
+  return deferred;
+}
+
+// Inserts the `nb_points` points given by `point_of`, sorted spatially,
+// in the triangulation `tr`. A sample of points is inserted sequentially,
+// then the rest in parallel, except the points deferred by
+// `insert_in_parallel_2()`, which are inserted sequentially at the end.
+// In addition to the requirements of `insert_in_parallel_2()`, `Policy`
+// provides `bool is_valid_hint(Vertex_handle) const`, which tells if a
+// vertex returned by `tr.insert()` is in the triangulation.
+template <class Tr, class PointOf, class Policy>
+void parallel_insert_2(Tr& tr,
+                       std::size_t nb_points,
+                       const PointOf& point_of,
+                       const Policy& policy)
+{
+  typedef typename Tr::Vertex_handle                    Vertex_handle;
+  typedef typename Tr::Face_handle                      Face_handle;
+
+  std::size_t i = 0;
+  Face_handle hint;
+
+  // The first points are a random sample (see `spatial_sort()`), whose
+  // convex hull is almost the one of all the points
+  const std::size_t nb_points_seq = (std::min)(nb_points, std::size_t(1000));
+  while(i < nb_points_seq || (tr.dimension() < 2 && i < nb_points))
+  {
+    Vertex_handle v = tr.insert(point_of(i), hint);
+    policy.new_vertex(i, v);
+    if(policy.is_valid_hint(v))
+      hint = v->face();
+    ++i;
+  }
+  if(i == nb_points)
+    return;
+
+  Vertex_handle v_hint = tr.finite_vertices_begin();
+  std::vector<std::size_t> deferred =
+    insert_in_parallel_2(tr, i, nb_points, point_of, v_hint, policy);
+
+  for(std::size_t j : deferred)
+  {
+    Vertex_handle v = tr.insert(point_of(j), hint);
+    policy.new_vertex(j, v);
+    if(policy.is_valid_hint(v))
+      hint = v->face();
+  }
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERT_2_H
@@ -0,0 +1,177 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mariette Yvinec
+
+#ifndef CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_REMOVE_2_H
+#define CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_REMOVE_2_H
+
+#include <CGAL/license/Triangulation_2.h>
+
+#include <CGAL/tags.h>
+#include <CGAL/Bbox_2.h>
+#include <CGAL/assertions.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <CGAL/Spatial_lock_grid_2.h>
+#  include <tbb/blocked_range.h>
+#  include <tbb/enumerable_thread_specific.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Removes the vertices `vertices` of the triangulation `tr`, whose TDS must
+// use concurrent containers. The vertices are split in blocks removed by
+// different threads.
+//
+// The triangulation is locked through a grid on the plane, as in
+// `insert_in_parallel_2()`: a vertex is removed once the thread has locked
+// the finite vertices of all its incident faces. The removal only modifies
+// these faces, the neighbor relations across the edges of their boundary, whose
+// vertices are locked, and the faces of these vertices. If a lock cannot be
+// taken, the locks of the thread are released and the removal is retried.
+//
+// The vertices of the convex hull are deferred, as the vertices that
+// `policy` does not accept. The deferred vertices are returned, in the
+// order of `vertices`, and must be removed sequentially afterwards.
+//
+// `Policy` provides:
+// - `bool accept_vertex(Vertex_handle v) const`, called before `v` is locked,
+//   to defer a vertex whose incident faces should not be looked at;
+// - `bool accept_star(const std::vector<Face_handle>& faces) const`, to defer
+//   a vertex given its incident faces;
+// - `void remove(Vertex_handle v) const`, which removes `v` from `tr`,
+//   only modifying the faces incident to `v`.
+template <class Tr, class Policy>
+std::vector<typename Tr::Vertex_handle>
+remove_in_parallel_2(Tr& tr,
+                     const std::vector<typename Tr::Vertex_handle>& vertices,
+                     const Policy& policy,
+                     int num_grid_cells_per_axis = 64)
+{
+  typedef typename Tr::Vertex_handle                    Vertex_handle;
+  typedef typename Tr::Face_handle                      Face_handle;
+  typedef Spatial_lock_grid_2<Tag_priority_blocking>    Lock_data_structure;
+
+  CGAL_precondition(tr.dimension() == 2);
+
+  if(vertices.empty())
+    return std::vector<Vertex_handle>();
+
+  // The grid covers the vertices to remove, the other vertices are clamped
+  double xmin = CGAL::to_double(vertices.front()->point().x()), xmax = xmin;
+  double ymin = CGAL::to_double(vertices.front()->point().y()), ymax = ymin;
+  for(Vertex_handle v : vertices)
+  {
+    const double x = CGAL::to_double(v->point().x());
+    const double y = CGAL::to_double(v->point().y());
+    xmin = (std::min)(xmin, x); xmax = (std::max)(xmax, x);
+    ymin = (std::min)(ymin, y); ymax = (std::max)(ymax, y);
+  }
+  if(xmax == xmin) xmax = xmin + 1.;
+  if(ymax == ymin) ymax = ymin + 1.;
+  Lock_data_structure lock_ds(Bbox_2(xmin, ymin, xmax, ymax), num_grid_cells_per_axis);
+
+  enum Removal_result { REMOVED, DEFERRED, LOCK_FAILED };
+
+  struct Thread_data
+  {
+    bool* locked_cells; // the cells locked by the thread, to skip the others quickly
+    std::vector<Face_handle> faces;
+    std::vector<std::size_t> deferred;
+  };
+
+  tbb::enumerable_thread_specific<Thread_data> tls_data(
+    [&]() { return Thread_data{lock_ds.get_thread_local_grid(), {}, {}}; });
+
+  auto try_lock_point = [&](const auto& p, Thread_data& data) -> bool
+  {
+    const int cell_index = lock_ds.get_grid_index(p);
+    return data.locked_cells[cell_index] || lock_ds.try_lock(cell_index);
+  };
+
+  auto try_remove = [&](Vertex_handle v, Thread_data& data) -> Removal_result
+  {
+    if(!policy.accept_vertex(v))
+      return DEFERRED;
+
+    // the faces incident to `v` are only modified by a thread which has locked `v`
+    if(!try_lock_point(v->point(), data))
+      return LOCK_FAILED;
+
+    data.faces.clear();
+    Face_handle f = v->face(), done = f;
+    do
+    {
+      for(int i = 0; i < 3; ++i)
+      {
+        Vertex_handle w = f->vertex(i);
+        if(tr.is_infinite(w))
+          return DEFERRED;
+        if(!try_lock_point(w->point(), data))
+          return LOCK_FAILED;
+      }
+      data.faces.push_back(f);
+      f = f->neighbor(Tr::ccw(f->index(v)));
+    }
+    while(f != done);
+
+    if(!policy.accept_star(data.faces))
+      return DEFERRED;
+
+    policy.remove(v);
+    return REMOVED;
+  };
+
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertices.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      Thread_data& data = tls_data.local();
+                      for(std::size_t i = r.begin(); i != r.end(); ++i)
+                      {
+                        Removal_result result;
+                        do
+                        {
+                          result = try_remove(vertices[i], data);
+                          lock_ds.unlock_all_points_locked_by_this_thread();
+                        }
+                        while(result == LOCK_FAILED);
+
+                        if(result == DEFERRED)
+                          data.deferred.push_back(i);
+                      }
+                    });
+
+  std::vector<std::size_t> deferred;
+  for(const Thread_data& data : tls_data)
+    deferred.insert(deferred.end(), data.deferred.begin(), data.deferred.end());
+  std::sort(deferred.begin(), deferred.end());
+
+  std::vector<Vertex_handle> deferred_vertices;
+  deferred_vertices.reserve(deferred.size());
+  for(std::size_t i : deferred)
+    deferred_vertices.push_back(vertices[i]);
+  return deferred_vertices;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_REMOVE_2_H
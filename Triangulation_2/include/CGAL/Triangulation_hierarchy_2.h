@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <map>
+#include <type_traits>
 #include <vector>
 #include <array>
 #include <CGAL/array.h>
@@ -231,6 +232,18 @@ public:
   Face_handle
   locate(const Point&p, Face_handle start = Face_handle()) const;
 
+  // The batched location of the base triangulation: as the points are
+  // spatially sorted, each point is located from the face of the previous one,
+  // without using the upper levels of the hierarchy.
+  template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  std::enable_if_t<std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+                   std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                   OutputIterator>
+  locate(const PointRange& points, OutputIterator out, ConcurrencyTag tag) const
+  {
+    return Tr_Base::locate(points, out, tag);
+  }
+
   Vertex_handle
   nearest_vertex(const Point& p, Face_handle start = Face_handle()) const
   {
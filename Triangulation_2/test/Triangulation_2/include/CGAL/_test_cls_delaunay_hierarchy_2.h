@@ -24,6 +24,10 @@
 #include <CGAL/point_generators_2.h>
 #include <CGAL/algorithm.h>
 
+#include <cassert>
+#include <tuple>
+#include <vector>
+
 template <class Dh>
 void
 _test_cls_delaunay_hierarchy_2( const Dh & )
@@ -44,6 +48,23 @@ _test_cls_delaunay_hierarchy_2( const Dh & )
 
   dh.locate(Point(0.,0.));
 
+  std::cout << "    batched location of 1000 points" << std::endl;
+  typedef typename Delaunay_hierarchy::Face_handle  Face_handle;
+  typedef typename Delaunay_hierarchy::Locate_type  Locate_type;
+  std::vector<Point> queries;
+  CGAL::Random_points_in_square_2<Point,Creator> gq(1.2);
+  std::copy_n( gq, 1000, std::back_inserter(queries));
+  std::vector<std::tuple<Face_handle, Locate_type, int> > locations;
+  dh.locate(queries, std::back_inserter(locations), CGAL::Sequential_tag());
+  assert(locations.size() == queries.size());
+  for(std::size_t i=0; i<queries.size(); ++i) {
+    Locate_type lt;
+    int li;
+    Face_handle f = dh.locate(queries[i], lt, li);
+    assert(std::get<1>(locations[i]) == lt);
+    assert(lt != Delaunay_hierarchy::FACE || std::get<0>(locations[i]) == f);
+  }
+
   while( dh.number_of_vertices() >0) {
     dh.remove(dh.finite_vertices_begin());
   }
@@ -0,0 +1,107 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Regular_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Iterator_range.h>
+#include <CGAL/Random.h>
+
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_2                                               Point;
+typedef K::Weighted_point_2                                      Weighted_point;
+
+template <class Tr, class Tag, class PointRange>
+void test_locate_range(const Tr& tr, const PointRange& queries)
+{
+  typedef typename Tr::Face_handle                               Face_handle;
+  typedef typename Tr::Locate_type                               Locate_type;
+  typedef std::tuple<Face_handle, Locate_type, int>              Location;
+
+  std::vector<Location> locations;
+  tr.locate(queries, std::back_inserter(locations), Tag());
+
+  std::vector<typename Tr::Point> points(queries.begin(), queries.end());
+  assert(locations.size() == points.size());
+  for (std::size_t k=0; k<points.size(); ++k)
+  {
+    Locate_type lt;
+    int li;
+    Face_handle f = tr.locate(points[k], lt, li);
+    const Location& l = locations[k];
+    assert(std::get<1>(l) == lt);
+    switch (lt)
+    {
+    case Tr::VERTEX:
+      assert(std::get<0>(l)->vertex(std::get<2>(l)) == f->vertex(li));
+      break;
+    case Tr::FACE:
+      assert(std::get<0>(l) == f);
+      break;
+    case Tr::OUTSIDE_CONVEX_HULL:
+      assert(tr.is_infinite(std::get<0>(l)));
+      break;
+    default:
+      assert(std::get<0>(l)->has_vertex(f->vertex(Tr::cw(li))) &&
+             std::get<0>(l)->has_vertex(f->vertex(Tr::ccw(li))));
+    }
+  }
+}
+
+template <class Tag>
+void test(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  typedef CGAL::Delaunay_triangulation_2<K>                      Delaunay;
+  typedef CGAL::Regular_triangulation_2<K>                       Regular;
+
+  Delaunay dt(points.begin(), points.end());
+  test_locate_range<Delaunay, Tag>(dt, queries);
+
+  // a range whose iterator does not return references
+  auto translate = [](const Point& p) { return Point(p.x() + 0.125, p.y()); };
+  test_locate_range<Delaunay, Tag>(
+    dt, CGAL::make_range(boost::make_transform_iterator(queries.begin(), translate),
+                         boost::make_transform_iterator(queries.end(), translate)));
+
+  std::vector<Weighted_point> wpoints, wqueries;
+  CGAL::Random rnd(1);
+  for (const Point& p : points)
+    wpoints.emplace_back(p, rnd.get_double(0, 0.0001));
+  for (const Point& q : queries)
+    wqueries.emplace_back(q, 0);
+  Regular rt(wpoints.begin(), wpoints.end());
+  test_locate_range<Regular, Tag>(rt, wqueries);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_square_2<Point> gen(1., rnd);
+  std::vector<Point> points, queries;
+  for (int i=0; i<5000; ++i)
+    points.push_back(*gen++);
+  for (int i=0; i<20000; ++i)
+    queries.emplace_back(1.2 * gen->x(), 1.2 * (gen++)->y());
+  // vertices, and points on edges
+  for (int i=0; i<1000; ++i)
+  {
+    queries.push_back(points[i]);
+    queries.push_back(CGAL::midpoint(points[i], points[i+1]));
+  }
+
+  std::cout << "Sequential location" << std::endl;
+  test<CGAL::Sequential_tag>(points, queries);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel location" << std::endl;
+  test<CGAL::Parallel_tag>(points, queries);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Regular_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <tbb/global_control.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel            K;
+typedef K::Point_2                                                     Point;
+typedef K::Weighted_point_2                                            Weighted_point;
+
+typedef CGAL::Delaunay_triangulation_2<K>                              DT;
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Tds_parallel;
+typedef CGAL::Delaunay_triangulation_2<K, Tds_parallel>                DT_parallel;
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<std::size_t, K>    Vb_info;
+typedef CGAL::Triangulation_data_structure_2<
+          Vb_info,
+          CGAL::Triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Tds_info_parallel;
+typedef CGAL::Delaunay_triangulation_2<K, Tds_info_parallel>           DT_info_parallel;
+typedef CGAL::Triangulation_data_structure_2<
+          Vb_info,
+          CGAL::Triangulation_face_base_2<K> >                         Tds_info;
+typedef CGAL::Delaunay_triangulation_2<K, Tds_info>                    DT_info;
+
+typedef CGAL::Regular_triangulation_2<K>                               RT;
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Regular_triangulation_vertex_base_2<K>,
+          CGAL::Regular_triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Rtds_parallel;
+typedef CGAL::Regular_triangulation_2<K, Rtds_parallel>                RT_parallel;
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<
+          std::size_t, K, CGAL::Regular_triangulation_vertex_base_2<K> > Rvb_info;
+typedef CGAL::Triangulation_data_structure_2<
+          Rvb_info,
+          CGAL::Regular_triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Rtds_info_parallel;
+typedef CGAL::Regular_triangulation_2<K, Rtds_info_parallel>           RT_info_parallel;
+typedef CGAL::Triangulation_data_structure_2<
+          Rvb_info,
+          CGAL::Regular_triangulation_face_base_2<K> >                 Rtds_info;
+typedef CGAL::Regular_triangulation_2<K, Rtds_info>                    RT_info;
+
+typedef std::array<double, 6>                                          Face_key;
+
+// the finite faces, as sorted triples of bare points
+template <class Tr>
+std::set<Face_key> face_set(const Tr& tr)
+{
+  std::set<Face_key> faces;
+  for(typename Tr::Face_handle f : tr.finite_face_handles())
+  {
+    std::array<std::pair<double, double>, 3> v;
+    for(int i=0; i<3; ++i)
+    {
+      const Point p = K::Construct_point_2()(tr.point(f, i));
+      v[i] = std::make_pair(p.x(), p.y());
+    }
+    std::sort(v.begin(), v.end());
+    faces.insert({ v[0].first, v[0].second, v[1].first, v[1].second, v[2].first, v[2].second });
+  }
+  return faces;
+}
+
+template <class Tr, class Tr_parallel>
+void check_same(const Tr& tr, const Tr_parallel& tr_parallel)
+{
+  assert(tr_parallel.is_valid());
+  assert(tr_parallel.number_of_vertices() == tr.number_of_vertices());
+  assert(tr_parallel.number_of_faces() == tr.number_of_faces());
+  assert(face_set(tr_parallel) == face_set(tr));
+}
+
+// the vertices at the same place have the same info, even for duplicated points
+template <class Tr, class Tr_parallel>
+void check_same_infos(const Tr& tr, const Tr_parallel& tr_parallel)
+{
+  std::map<std::pair<double, double>, std::size_t> infos;
+  for(typename Tr::Vertex_handle v : tr.finite_vertex_handles())
+  {
+    const Point p = K::Construct_point_2()(v->point());
+    infos[std::make_pair(p.x(), p.y())] = v->info();
+  }
+  for(typename Tr_parallel::Vertex_handle v : tr_parallel.finite_vertex_handles())
+  {
+    const Point p = K::Construct_point_2()(v->point());
+    assert(infos[std::make_pair(p.x(), p.y())] == v->info());
+  }
+}
+
+void test_delaunay(const std::vector<Point>& points)
+{
+  DT dt(points.begin(), points.end());
+
+  DT_parallel dt_parallel(points.begin(), points.end());
+  check_same(dt, dt_parallel);
+
+  std::vector<std::pair<Point, std::size_t> > points_with_info;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_info.push_back(std::make_pair(points[i], i));
+
+  DT_info_parallel dt_info(points_with_info.begin(), points_with_info.end());
+  check_same(dt, dt_info);
+  for(DT_info_parallel::Vertex_handle v : dt_info.finite_vertex_handles())
+    assert(points[v->info()] == v->point());
+
+  DT_info dt_info_sequential(points_with_info.begin(), points_with_info.end());
+  check_same_infos(dt_info_sequential, dt_info);
+}
+
+void test_regular(const std::vector<Weighted_point>& points)
+{
+  RT rt(points.begin(), points.end());
+
+  RT_parallel rt_parallel(points.begin(), points.end());
+  check_same(rt, rt_parallel);
+  assert(rt_parallel.number_of_hidden_vertices() == rt.number_of_hidden_vertices());
+
+  std::vector<std::pair<Weighted_point, std::size_t> > points_with_info;
+  for(std::size_t i=0; i<points.size(); ++i)
+    points_with_info.push_back(std::make_pair(points[i], i));
+
+  RT_info_parallel rt_info(points_with_info.begin(), points_with_info.end());
+  check_same(rt, rt_info);
+  for(RT_info_parallel::Vertex_handle v : rt_info.finite_vertex_handles())
+    assert(points[v->info()] == v->point());
+
+  RT_info rt_info_sequential(points_with_info.begin(), points_with_info.end());
+  check_same_infos(rt_info_sequential, rt_info);
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+  std::cout << "Random seed: " << rng.get_seed() << std::endl;
+
+  // random points, duplicates and cocircular points
+  std::vector<Point> points;
+  CGAL::Random_points_in_square_2<Point> gen(1., rng);
+  for(int i=0; i<20000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<500; ++i)
+    points.push_back(points[7*i]);
+  for(int i=0; i<200; ++i)
+    for(int j=0; j<5; ++j)
+      points.push_back(points[3*i]);
+  for(int i=0; i<50; ++i)
+    for(int j=0; j<50; ++j)
+      points.push_back(Point(i / 50., j / 50.));
+
+  // tiny weights, and some large ones that hide their neighbors
+  std::vector<Weighted_point> wpoints;
+  for(const Point& p : points)
+    wpoints.push_back(Weighted_point(p, rng.get_double(0, 1e-7)));
+  for(int i=0; i<300; ++i)
+    wpoints.push_back(Weighted_point(points[5*i], 0.01));
+
+  for(int nb_threads : { 1, 2, 4 })
+  {
+    std::cout << "Testing with " << nb_threads << " threads" << std::endl;
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+
+    test_delaunay(points);
+    test_regular(wpoints);
+
+    // small inputs are inserted sequentially
+    test_delaunay(std::vector<Point>(points.begin(), points.begin() + 10));
+    test_regular(std::vector<Weighted_point>(wpoints.begin(), wpoints.begin() + 10));
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+  std::cout << "TBB not found, skipping the test of parallel insertion" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif
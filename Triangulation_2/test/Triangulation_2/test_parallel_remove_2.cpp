@@ -0,0 +1,140 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Regular_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <tbb/global_control.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel            K;
+typedef K::Point_2                                                     Point;
+typedef K::Weighted_point_2                                            Weighted_point;
+
+typedef CGAL::Delaunay_triangulation_2<K>                              DT;
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Tds_parallel;
+typedef CGAL::Delaunay_triangulation_2<K, Tds_parallel>                DT_parallel;
+
+typedef CGAL::Regular_triangulation_2<K>                               RT;
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Regular_triangulation_vertex_base_2<K>,
+          CGAL::Regular_triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                                          Rtds_parallel;
+typedef CGAL::Regular_triangulation_2<K, Rtds_parallel>                RT_parallel;
+
+typedef std::array<double, 6>                                          Face_key;
+
+// the finite faces, as sorted triples of bare points
+template <class Tr>
+std::set<Face_key> face_set(const Tr& tr)
+{
+  std::set<Face_key> faces;
+  for(typename Tr::Face_handle f : tr.finite_face_handles())
+  {
+    std::array<std::pair<double, double>, 3> v;
+    for(int i=0; i<3; ++i)
+    {
+      const Point p = K::Construct_point_2()(tr.point(f, i));
+      v[i] = std::make_pair(p.x(), p.y());
+    }
+    std::sort(v.begin(), v.end());
+    faces.insert({ v[0].first, v[0].second, v[1].first, v[1].second, v[2].first, v[2].second });
+  }
+  return faces;
+}
+
+// removes the vertices of the points of `selected`, and the vertices of the convex hull
+template <class Tr, class PointSet>
+typename Tr::size_type remove_vertices(Tr& tr, const PointSet& selected)
+{
+  std::vector<typename Tr::Vertex_handle> vertices;
+  for(typename Tr::Vertex_handle v : tr.finite_vertex_handles())
+    if(selected.count(v->point()) != 0 || tr.is_edge(v, tr.infinite_vertex()))
+      vertices.push_back(v);
+  return tr.remove(vertices.begin(), vertices.end());
+}
+
+template <class Tr, class Tr_parallel, class PointRange>
+void test(const PointRange& points, int step, bool same_faces)
+{
+  Tr tr(points.begin(), points.end());
+  Tr_parallel tr_parallel(points.begin(), points.end());
+  assert(tr_parallel.number_of_vertices() == tr.number_of_vertices());
+
+  std::set<typename Tr::Point> selected;
+  for(std::size_t i=0; i<points.size(); i+=step)
+    selected.insert(points[i]);
+
+  const typename Tr::size_type n = remove_vertices(tr, selected);
+  const typename Tr::size_type n_parallel = remove_vertices(tr_parallel, selected);
+
+  assert(tr_parallel.is_valid());
+  assert(n_parallel == n);
+  assert(tr_parallel.number_of_vertices() == tr.number_of_vertices());
+  assert(tr_parallel.number_of_faces() == tr.number_of_faces());
+  if(same_faces)
+    assert(face_set(tr_parallel) == face_set(tr));
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+  std::cout << "Random seed: " << rng.get_seed() << std::endl;
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_square_2<Point> gen(1., rng);
+  for(int i=0; i<20000; ++i)
+    points.push_back(*gen++);
+
+  // cocircular points: the result depends on the order of removal
+  std::vector<Point> grid;
+  for(int i=0; i<60; ++i)
+    for(int j=0; j<60; ++j)
+      grid.push_back(Point(i / 60., j / 60.));
+
+  // tiny weights, and some large ones that hide their neighbors
+  std::vector<Weighted_point> wpoints;
+  for(const Point& p : points)
+    wpoints.push_back(Weighted_point(p, rng.get_double(0, 1e-7)));
+  for(int i=0; i<300; ++i)
+    wpoints.push_back(Weighted_point(points[5*i], 0.01));
+
+  for(int nb_threads : { 1, 2, 4 })
+  {
+    std::cout << "Testing with " << nb_threads << " threads" << std::endl;
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, nb_threads);
+
+    test<DT, DT_parallel>(points, 3, true);
+    test<DT, DT_parallel>(points, 1, true);
+    test<DT, DT_parallel>(grid, 2, false);
+    test<RT, RT_parallel>(wpoints, 3, false);
+
+    // small inputs
+    test<DT, DT_parallel>(std::vector<Point>(points.begin(), points.begin() + 10), 2, true);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+  std::cout << "TBB not found, skipping the test of parallel removal" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif
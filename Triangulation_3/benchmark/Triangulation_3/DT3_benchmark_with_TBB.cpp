@@ -1,6 +1,14 @@
+// With CGAL_CONCURRENT_TRIANGULATION_3_PROFILING, the counters of the
+// triangulation are printed at exit. CGAL_PROFILE must be defined before
+// any CGAL header to also get the filter failures of the predicates.
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+#  define CGAL_PROFILE
+#endif
+
 #include <CGAL/Real_timer.h>
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Regular_triangulation_3.h>
 #include <CGAL/bounding_box.h>
 #include <CGAL/Random.h>
 
@@ -17,6 +25,13 @@ typedef CGAL::Triangulation_data_structure_3<
                   CGAL::Parallel_tag>                                Tds;
 typedef CGAL::Delaunay_triangulation_3<K, Tds>               PDT;
 
+typedef K::Weighted_point_3                                  Weighted_point_3;
+typedef CGAL::Triangulation_data_structure_3<
+                  CGAL::Regular_triangulation_vertex_base_3<K>,
+                  CGAL::Regular_triangulation_cell_base_3<K>,
+                  CGAL::Parallel_tag>                        Rtds;
+typedef CGAL::Regular_triangulation_3<K, Rtds>               PRT;
+
 // global variables used by bench_dt3
 int argc;
 char** argv;
@@ -43,6 +58,28 @@ void bench_dt3(benchmark::State& state) {
 }
 BENCHMARK(bench_dt3)->Unit(benchmark::kMillisecond);;
 
+// the weights are small, so that most of the points are not hidden
+void bench_rt3(benchmark::State& state) {
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Weighted_point_3> points;
+  Point_3 p;
+
+  std::ifstream in(argv[1]);
+  CGAL::Random rng(0);
+  while(in >> p)
+    points.push_back(Weighted_point_3(p, rng.get_double(0, 1e-6)));
+
+  for(auto _ : state) {
+    CGAL::Bbox_3 bb = CGAL::bbox_3(points.begin(), points.end());
+    PRT::Lock_data_structure locking_ds(bb, 50);
+
+    PRT prt(points.begin(), points.end(), &locking_ds);
+  }
+  return;
+}
+BENCHMARK(bench_rt3)->Unit(benchmark::kMillisecond);
+
 
 int main(int argc, char* argv[])
 {
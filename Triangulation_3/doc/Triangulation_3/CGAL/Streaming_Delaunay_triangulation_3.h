@@ -0,0 +1,153 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTriangulation3TriangulationClasses
+
+The class `Streaming_Delaunay_triangulation_3` computes the Delaunay
+triangulation of a set of points given in several chunks, keeping in memory
+only the part of the triangulation which can still change
+\cgalCite{cgal:ilss-scdt-06}.
+
+The domain containing the points is divided into a regular grid.
+After inserting some points, the user tells which regions of the domain
+will not receive points anymore with `finalize()`. A cell of the triangulation is
+<I>final</I> when the bounding box of its circumscribing sphere only meets
+finalized grid cells, or the outside of the domain: its sphere cannot contain
+a point inserted later, so it is a cell of the final Delaunay triangulation.
+The final cells are given to an output function, and then removed from the
+triangulation, together with the vertices all of whose incident cells are final.
+
+The memory used is thus proportional to the size of the front between the
+finalized regions and the others, when the points are given in an order
+which follows the finalization, such as slabs or tiles of the domain.
+The cells of the convex hull are output at the end only.
+
+While some cells have been removed, the triangulation returned by `triangulation()`
+is not valid: the facets which were shared with removed cells have no neighbor.
+
+\tparam Traits is the geometric traits class and must be a model of `DelaunayTriangulationTraits_3`.
+
+\tparam TDS is the triangulation data structure. Its vertex base must have
+an `info()` of type `std::size_t`. The default is a
+`Triangulation_data_structure_3` whose vertices and cells derive from
+`Triangulation_ds_indexed_vertex_base_3` and `Triangulation_ds_indexed_cell_base_3`.
+
+\sa `CGAL::Delaunay_triangulation_3`
+*/
+template< typename Traits, typename TDS = Default >
+class Streaming_Delaunay_triangulation_3 {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+The Delaunay triangulation storing the cells which are not final.
+*/
+typedef Delaunay_triangulation_3<Traits, TDS> Triangulation;
+
+/*!
+
+*/
+typedef Triangulation::Point Point;
+
+/*!
+
+*/
+typedef Triangulation::Vertex_handle Vertex_handle;
+
+/*!
+
+*/
+typedef Triangulation::Cell_handle Cell_handle;
+
+/*!
+
+*/
+typedef Triangulation::size_type size_type;
+
+/*!
+The output function, called with each final cell before its removal.
+The `info()` of a vertex is the rank of its point in the sequence of inserted points.
+*/
+typedef std::function<void(Cell_handle)> Cell_output;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+Creates an empty triangulation of the points of `domain`, which is divided
+into `resolution`\f$^3\f$ grid cells.
+*/
+Streaming_Delaunay_triangulation_3(const Bbox_3& domain,
+                                   unsigned int resolution,
+                                   const Cell_output& output,
+                                   const Traits& traits = Traits());
+
+/// @}
+
+/// \name Insertion and Finalization
+/// @{
+
+/*!
+Inserts the point `p`, and returns the corresponding vertex.
+If a vertex already has the point `p`, it is returned.
+
+\pre `p` is in the domain, and not in a finalized region. If `p` is inside the convex
+hull of the points inserted before, one of them is in the box of grid cells obtained by
+growing the grid cell of `p` by layers of grid cells on all its sides, as long as the layers
+do not contain a finalized grid cell.
+*/
+Vertex_handle insert(const Point& p);
+
+/*!
+Inserts the points of the range `[first,last)`, after sorting them
+spatially. The ranks of the points are given by their order in the range.
+Returns the number of inserted vertices.
+
+\tparam InputIterator must be an input iterator with value type `Point`.
+*/
+template < class InputIterator >
+size_type insert(InputIterator first, InputIterator last);
+
+/*!
+Declares that no point will be inserted anymore in the grid cells included
+in `box`, and outputs and removes the cells which became final.
+*/
+void finalize(const Bbox_3& box);
+
+/*!
+Outputs all the remaining finite cells, and clears the triangulation.
+*/
+void finalize();
+
+/// @}
+
+/// \name Access Functions
+/// @{
+
+/*!
+Returns the triangulation of the cells which are not final yet.
+Once some cells have been removed, it is not a valid `Delaunay_triangulation_3`:
+only its vertices and cells can be iterated over, and the functions which walk
+through its cells must not be called.
+*/
+const Triangulation& triangulation() const;
+
+/*!
+Returns the number of cells given to the output function so far.
+*/
+size_type number_of_output_cells() const;
+
+/*!
+Returns the largest number of cells the triangulation had after an insertion.
+*/
+size_type maximal_number_of_cells() const;
+
+/// @}
+
+}; /* end Streaming_Delaunay_triangulation_3 */
+} /* end namespace CGAL */
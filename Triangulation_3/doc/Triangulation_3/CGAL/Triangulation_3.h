@@ -776,6 +776,27 @@ locate(const Point & query, Locate_type & lt,
 int & li, int & lj, Vertex_handle hint,
 bool *could_lock_zone = nullptr) const;
 
+/*!
+Locates all the points of `points`, as the function above, and writes
+for each of them a `std::tuple<Cell_handle, Locate_type, int, int>`, made of
+the returned cell, `lt`, `li`, and `lj`, to `out`, in the order of `points`.
+
+The points are spatially sorted, so that each point is located starting from
+the cell of the previous one. If `ConcurrencyTag` is `Parallel_tag`,
+the sorted points are split between several threads, and the triangulation
+must not be modified until the function returns.
+
+\tparam ConcurrencyTag enables sequential versus parallel location.
+Possible values are `Sequential_tag` and `Parallel_tag`.
+\tparam PointRange is a model of `ConstRange` with value type `Point`.
+\tparam OutputIterator is an output iterator accepting `std::tuple<Cell_handle, Locate_type, int, int>`.
+
+Returns the past-the-end output iterator.
+*/
+template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+OutputIterator
+locate(const PointRange& points, OutputIterator out, ConcurrencyTag tag) const;
+
 
 /*!
 Returns a value indicating on which side of the oriented boundary
@@ -0,0 +1,849 @@
+// Copyright (c) 2025  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sylvain Pion
+
+#ifndef CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
+#define CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
+
+#include <CGAL/license/Triangulation_3.h>
+
+#include <CGAL/disable_warnings.h>
+#include <CGAL/basic.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_vertex_base_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_ds_indexed_cell_base_3.h>
+#include <CGAL/Triangulation_ds_indexed_vertex_base_3.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/FPU.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Random.h>
+#include <CGAL/Default.h>
+#include <CGAL/assertions.h>
+#include <CGAL/constructions/kernel_ftC3.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+// Streaming construction of a 3D Delaunay triangulation, following
+// Isenburg, Liu, Shewchuk and Snoeyink, "Streaming computation of Delaunay
+// triangulations" (SIGGRAPH 2006).
+//
+// The domain is divided into a grid. The user tells which regions of the domain
+// will not receive points anymore; a cell is final when the bounding box of its
+// circumscribing sphere only meets finalized grid cells (or the outside of the domain):
+// no point inserted later can be in conflict with it. The final cells are given
+// to an output function, and removed from the triangulation, as well as the
+// vertices whose incident cells are all final. The facets of the remaining cells
+// which were shared with removed cells get default constructed neighbors.
+//
+// The finite cells which are not final are stored in buckets indexed by the grid
+// cells: a cell is in the bucket of a grid cell which is not finalized and is met
+// by the bounding box of its circumscribing sphere. When a grid cell is finalized,
+// only the cells of its bucket are checked again, and are either final or moved
+// to another bucket.
+//
+// As Triangulation_3::locate() and the insertion of Delaunay_triangulation_3
+// cross all the facets, the points are inserted in dimension 3 with a walk and
+// a conflict zone computation which do not cross the facets without neighbor.
+template < class Gt, class Tds_ = Default >
+class Streaming_Delaunay_triangulation_3
+{
+  typedef Triangulation_data_structure_3<
+            Triangulation_vertex_base_with_info_3<std::size_t, Gt,
+              Triangulation_vertex_base_3<Gt, Triangulation_ds_indexed_vertex_base_3<> > >,
+            Delaunay_triangulation_cell_base_3<Gt,
+              Triangulation_cell_base_3<Gt, Triangulation_ds_indexed_cell_base_3<> > > >
+                                                        Default_tds;
+
+public:
+  typedef typename Default::Get<Tds_, Default_tds>::type Triangulation_data_structure;
+  typedef Delaunay_triangulation_3<Gt, Triangulation_data_structure>
+                                                        Triangulation;
+  typedef Gt                                            Geom_traits;
+
+  typedef typename Triangulation::Point                 Point;
+  typedef typename Triangulation::Vertex_handle         Vertex_handle;
+  typedef typename Triangulation::Cell_handle           Cell_handle;
+  typedef typename Triangulation::size_type             size_type;
+
+  // Called with each final cell, before it is removed. The `info()` of a
+  // vertex is the rank of its point in the sequence of inserted points.
+  typedef std::function<void(Cell_handle)>              Cell_output;
+
+  Streaming_Delaunay_triangulation_3(const Bbox_3& domain,
+                                     unsigned int resolution,
+                                     const Cell_output& output,
+                                     const Gt& gt = Gt())
+    : m_tr(gt), m_domain(domain), m_resolution((std::max)(resolution, 1u)),
+      m_finalized(std::size_t(m_resolution) * m_resolution * m_resolution, false),
+      m_output(output), m_rank(0), m_nb_output_cells(0), m_max_nb_cells(0),
+      m_rng(0)
+  {
+    CGAL_precondition(domain.xmin() <= domain.xmax() &&
+                      domain.ymin() <= domain.ymax() &&
+                      domain.zmin() <= domain.zmax());
+    for(int d=0; d<3; ++d)
+      m_cell_size[d] = (std::max)(domain.max(d) - domain.min(d), 1e-300) / m_resolution;
+  }
+
+  // The cells which are not final yet. Once some cells have been removed, this is not
+  // a valid Delaunay_triangulation_3: the facets shared with removed cells have no
+  // neighbor, and some vertices have no incident cell. Only its vertices and cells can
+  // be iterated over; functions which walk through the cells must not be called.
+  const Triangulation& triangulation() const { return m_tr; }
+
+  // Number of cells given to the output function so far.
+  size_type number_of_output_cells() const { return m_nb_output_cells; }
+
+  // Largest number of cells of the triangulation, after an insertion.
+  size_type maximal_number_of_cells() const { return m_max_nb_cells; }
+
+  // Inserts `p`, which must be in the domain, and not in a finalized region.
+  // If it is inside the convex hull of the points inserted before, a point inserted
+  // before must be in the box of grid cells which are not finalized grown from the
+  // grid cell of `p` (see `search_conflict()` and `vertex_hint_around()`).
+  Vertex_handle insert(const Point& p)
+  {
+    const Grid_cell g = grid_cell(p);
+    CGAL_precondition(!is_finalized(g));
+    Vertex_handle v;
+    if(m_tr.dimension() < 3)
+    {
+      const size_type n = m_tr.number_of_vertices();
+      v = m_tr.insert(p);
+      if(m_tr.number_of_vertices() != n)
+        v->info() = m_rank;
+      // the next insertions are done by insert_in_dimension_3(), which maintains the buckets
+      if(m_tr.dimension() == 3)
+        for(Cell_handle c : m_tr.tds().cell_handles())
+          add_cell(c);
+    }
+    else
+    {
+      v = insert_in_dimension_3(p);
+    }
+    m_vertex_hints[grid_index(g[0], g[1], g[2])] = v;
+    ++m_rank;
+    m_max_nb_cells = (std::max)(m_max_nb_cells, m_tr.tds().cells().size());
+    return v;
+  }
+
+  // Inserts a chunk of points, after sorting it along a Hilbert curve. The
+  // ranks of the points are the ones of the input order.
+  template < class InputIterator >
+  size_type insert(InputIterator first, InputIterator last)
+  {
+    std::vector<std::pair<Point, std::size_t> > points;
+    for(; first != last; ++first)
+      points.emplace_back(*first, m_rank + points.size());
+
+    typedef First_of_pair_property_map<std::pair<Point, std::size_t> > Point_pmap;
+    typedef Spatial_sort_traits_adapter_3<Gt, Point_pmap>              Search_traits;
+    spatial_sort(points.begin(), points.end(), Search_traits(Point_pmap(), m_tr.geom_traits()));
+
+    const std::size_t first_rank = m_rank;
+    const size_type n = m_tr.number_of_vertices();
+    for(const std::pair<Point, std::size_t>& pt : points)
+    {
+      m_rank = pt.second;
+      insert(pt.first);
+    }
+    m_rank = first_rank + points.size();
+    return m_tr.number_of_vertices() - n;
+  }
+
+  // Declares that no point will be inserted in `box` anymore: the grid cells
+  // contained in `box` are finalized, and the cells which became final
+  // are given to the output function and removed.
+  void finalize(const Bbox_3& box)
+  {
+    std::array<int, 3> lo, hi;
+    for(int d=0; d<3; ++d)
+    {
+      lo[d] = (std::max)(0, int(std::ceil((box.min(d) - m_domain.min(d)) / m_cell_size[d])));
+      hi[d] = (std::min)(int(m_resolution),
+                         int(std::floor((box.max(d) - m_domain.min(d)) / m_cell_size[d])));
+      if(box.max(d) >= m_domain.max(d))
+        hi[d] = int(m_resolution);
+    }
+    std::vector<std::size_t> finalized;
+    for(int i=lo[0]; i<hi[0]; ++i)
+      for(int j=lo[1]; j<hi[1]; ++j)
+        for(int k=lo[2]; k<hi[2]; ++k)
+        {
+          const std::size_t g = grid_index(i, j, k);
+          if(!m_finalized[g])
+            finalized.push_back(g);
+          m_finalized[g] = true;
+          m_vertex_hints.erase(g);
+        }
+    output_final_cells(finalized);
+  }
+
+  // Gives all the remaining finite cells to the output function,
+  // and clears the triangulation.
+  void finalize()
+  {
+    if(m_tr.dimension() == 3)
+    {
+      for(Cell_handle c : m_tr.finite_cell_handles())
+      {
+        m_output(c);
+        ++m_nb_output_cells;
+      }
+    }
+    m_tr.clear();
+    m_hint = Cell_handle();
+    m_buckets.clear();
+    m_cell_locations.clear();
+    m_vertex_degrees.clear();
+    m_vertex_hints.clear();
+    std::fill(m_finalized.begin(), m_finalized.end(), true);
+  }
+
+private:
+  typedef typename Triangulation::Facet                 Facet;
+  typedef std::array<int, 3>                            Grid_cell;
+  // the bucket of a cell, and its position in the bucket
+  typedef std::pair<std::size_t, std::size_t>           Cell_location;
+
+  // The bucket of the cells which are already final when they are added.
+  static constexpr std::size_t final_bucket = std::size_t(-1);
+
+  std::size_t grid_index(int i, int j, int k) const
+  {
+    return (std::size_t(i) * m_resolution + j) * m_resolution + k;
+  }
+
+  int grid_coordinate(double x, int d) const
+  {
+    const int i = int(std::floor((x - m_domain.min(d)) / m_cell_size[d]));
+    return (std::min)((std::max)(i, 0), int(m_resolution) - 1);
+  }
+
+  Grid_cell grid_cell(const Point& p) const
+  {
+    return {{ grid_coordinate(to_double(p.x()), 0),
+              grid_coordinate(to_double(p.y()), 1),
+              grid_coordinate(to_double(p.z()), 2) }};
+  }
+
+  bool is_finalized(const Grid_cell& g) const
+  {
+    return m_finalized[grid_index(g[0], g[1], g[2])];
+  }
+
+  // Circumcenter and squared radius of `c`, computed with doubles, only used to
+  // order the cells in `search_conflict()`. Returns `false` if `c` is too flat
+  // for them to be computed.
+  bool approximate_circumsphere(Cell_handle c, std::array<double, 3>& center,
+                                double& squared_radius) const
+  {
+    double x[4], y[4], z[4];
+    for(int j=0; j<4; ++j)
+    {
+      const Point& q = c->vertex(j)->point();
+      x[j] = to_double(q.x());
+      y[j] = to_double(q.y());
+      z[j] = to_double(q.z());
+    }
+    double num_x, num_y, num_z, den;
+    determinants_for_circumcenterC3(x[0], y[0], z[0], x[1], y[1], z[1],
+                                    x[2], y[2], z[2], x[3], y[3], z[3],
+                                    num_x, num_y, num_z, den);
+    if(den == 0)
+      return false;
+    const double inv = 1 / (2 * den);
+    center = {{ x[0] + num_x * inv, y[0] - num_y * inv, z[0] + num_z * inv }};
+    squared_radius = CGAL::square(center[0] - x[0]) + CGAL::square(center[1] - y[0]) +
+                     CGAL::square(center[2] - z[0]);
+    return std::isfinite(squared_radius);
+  }
+
+  // Bounding box of the circumscribing sphere of `c`, computed with interval
+  // arithmetic so that it contains the sphere. Returns `false` if the sign of
+  // the denominator of the circumcenter is not certified, or if the box overflows:
+  // the sphere is then considered as unbounded.
+  bool circumsphere_bbox(Cell_handle c, std::array<double, 3>& lo,
+                         std::array<double, 3>& hi) const
+  {
+    typedef Interval_nt_advanced IT;
+    Protect_FPU_rounding<true> protection;
+
+    IT x[4], y[4], z[4];
+    for(int j=0; j<4; ++j)
+    {
+      const Point& q = c->vertex(j)->point();
+      x[j] = to_interval(q.x());
+      y[j] = to_interval(q.y());
+      z[j] = to_interval(q.z());
+    }
+    IT num_x, num_y, num_z, den;
+    determinants_for_circumcenterC3(x[0], y[0], z[0], x[1], y[1], z[1],
+                                    x[2], y[2], z[2], x[3], y[3], z[3],
+                                    num_x, num_y, num_z, den);
+    if(!(den.inf() > 0) && !(den.sup() < 0))
+      return false;
+    const IT inv = 1 / (2 * den);
+    const IT center[3] = { x[0] + num_x * inv, y[0] - num_y * inv, z[0] + num_z * inv };
+    const IT r = CGAL::sqrt(CGAL::square(center[0] - x[0]) + CGAL::square(center[1] - y[0]) +
+                            CGAL::square(center[2] - z[0]));
+    for(int d=0; d<3; ++d)
+    {
+      lo[d] = (center[d] - r).inf();
+      hi[d] = (center[d] + r).sup();
+      if(!std::isfinite(lo[d]) || !std::isfinite(hi[d]))
+        return false;
+    }
+    return true;
+  }
+
+  // A grid cell which is not finalized and is met by the bounding box of the
+  // circumscribing sphere of `c`, or `final_bucket` if there is none: then `c`
+  // is final. As the box contains the sphere, and as `grid_coordinate()` is
+  // monotone, the grid cell of a point in conflict with `c` is in the range
+  // of grid cells which is checked.
+  std::size_t watched_grid_cell(Cell_handle c) const
+  {
+    Grid_cell lo = {{ 0, 0, 0 }};
+    Grid_cell hi = {{ int(m_resolution) - 1, int(m_resolution) - 1, int(m_resolution) - 1 }};
+    std::array<double, 3> box_lo, box_hi;
+    if(circumsphere_bbox(c, box_lo, box_hi))
+    {
+      for(int d=0; d<3; ++d)
+      {
+        if(!(box_lo[d] < m_domain.max(d)) || !(box_hi[d] > m_domain.min(d)))
+          return final_bucket; // the open ball does not meet the domain
+        lo[d] = grid_coordinate(box_lo[d], d);
+        hi[d] = grid_coordinate(box_hi[d], d);
+      }
+    }
+    for(int i=lo[0]; i<=hi[0]; ++i)
+      for(int j=lo[1]; j<=hi[1]; ++j)
+        for(int k=lo[2]; k<=hi[2]; ++k)
+          if(!m_finalized[grid_index(i, j, k)])
+            return grid_index(i, j, k);
+    return final_bucket;
+  }
+
+  void place_cell(Cell_handle c, std::size_t g)
+  {
+    std::vector<Cell_handle>& bucket = m_buckets[g];
+    m_cell_locations[c] = Cell_location(g, bucket.size());
+    bucket.push_back(c);
+  }
+
+  // Called with each new cell.
+  void add_cell(Cell_handle c)
+  {
+    for(int j=0; j<4; ++j)
+      ++m_vertex_degrees[c->vertex(j)];
+    if(!m_tr.is_infinite(c))
+      place_cell(c, watched_grid_cell(c));
+  }
+
+  // Called with each cell deleted by an insertion.
+  void remove_cell(Cell_handle c)
+  {
+    for(int j=0; j<4; ++j)
+      --m_vertex_degrees[c->vertex(j)];
+
+    auto it = m_cell_locations.find(c);
+    if(it == m_cell_locations.end())
+      return; // infinite cell
+    const std::size_t g = it->second.first, pos = it->second.second;
+    m_cell_locations.erase(it);
+
+    auto bit = m_buckets.find(g);
+    std::vector<Cell_handle>& bucket = bit->second;
+    if(pos + 1 != bucket.size())
+    {
+      bucket[pos] = bucket.back();
+      m_cell_locations[bucket[pos]].second = pos;
+    }
+    bucket.pop_back();
+    if(bucket.empty())
+      m_buckets.erase(bit);
+  }
+
+  // A cell which is not final and is incident to `v`, found by turning around `v`
+  // from the final cell `c` through the final cells, or a default constructed handle.
+  // The cells around `v` may be separated by cells removed earlier, in which case
+  // the remaining cells may not be reached.
+  Cell_handle remaining_incident_cell(Vertex_handle v, Cell_handle c) const
+  {
+    std::vector<Cell_handle> visited(1, c);
+    for(std::size_t k=0; k<visited.size(); ++k)
+    {
+      Cell_handle d = visited[k];
+      const int iv = d->index(v);
+      for(int i=0; i<4; ++i)
+      {
+        Cell_handle n = d->neighbor(i);
+        if(i == iv || n == Cell_handle())
+          continue;
+        if(!n->tds_data().processed())
+          return n;
+        if(std::find(visited.begin(), visited.end(), n) == visited.end())
+          visited.push_back(n);
+      }
+    }
+    return Cell_handle();
+  }
+
+  // Outputs and removes the cells which became final after the finalization of the
+  // grid cells `finalized`: only the cells of their buckets are checked.
+  void output_final_cells(const std::vector<std::size_t>& finalized)
+  {
+    if(m_tr.dimension() < 3)
+      return;
+
+    typename Triangulation::Triangulation_data_structure& tds = m_tr.tds();
+
+    std::vector<Cell_handle> final_cells;
+    std::vector<std::size_t> buckets(finalized);
+    buckets.push_back(final_bucket);
+    for(std::size_t g : buckets)
+    {
+      auto bit = m_buckets.find(g);
+      if(bit == m_buckets.end())
+        continue;
+      std::vector<Cell_handle> bucket;
+      bucket.swap(bit->second);
+      m_buckets.erase(bit);
+
+      for(Cell_handle c : bucket)
+      {
+        const std::size_t w = (g == final_bucket) ? final_bucket : watched_grid_cell(c);
+        if(w == final_bucket)
+        {
+          m_cell_locations.erase(c);
+          c->tds_data().mark_processed();
+          final_cells.push_back(c);
+        }
+        else
+        {
+          place_cell(c, w);
+        }
+      }
+    }
+
+    for(Cell_handle c : final_cells)
+    {
+      m_output(c);
+      for(int i=0; i<4; ++i)
+      {
+        Cell_handle n = c->neighbor(i);
+        if(n != Cell_handle() && !n->tds_data().processed())
+          n->set_neighbor(n->index(c), Cell_handle());
+      }
+    }
+
+    // The vertices whose incident cells are all final are removed. The other
+    // ones are attached to a remaining cell, if one can be found around them.
+    std::vector<Vertex_handle> final_vertices;
+    for(Cell_handle c : final_cells)
+      for(int j=0; j<4; ++j)
+      {
+        Vertex_handle v = c->vertex(j);
+        auto it = m_vertex_degrees.find(v);
+        if(--(it->second) == 0)
+        {
+          m_vertex_degrees.erase(it);
+          v->set_cell(Cell_handle());
+          final_vertices.push_back(v);
+        }
+      }
+    for(Cell_handle c : final_cells)
+      for(int j=0; j<4; ++j)
+      {
+        Vertex_handle v = c->vertex(j);
+        Cell_handle vc = v->cell();
+        if(vc != Cell_handle() && vc->tds_data().processed())
+          v->set_cell(remaining_incident_cell(v, c));
+      }
+
+    if(m_hint != Cell_handle() && m_hint->tds_data().processed())
+      m_hint = Cell_handle();
+    m_nb_output_cells += final_cells.size();
+    tds.delete_cells(final_cells.begin(), final_cells.end());
+    tds.delete_vertices(final_vertices.begin(), final_vertices.end());
+  }
+
+  // Walks from the hint to a cell in conflict with `p`, without crossing
+  // the facets without neighbor. Returns the vertex equal to `p` in `v`, if any.
+  // If the walk is blocked by a facet without neighbor, the last visited cell
+  // is returned.
+  Cell_handle locate_in_conflict(const Point& p, Vertex_handle& v)
+  {
+    typename Gt::Orientation_3 orientation = m_tr.geom_traits().orientation_3_object();
+
+    Cell_handle c = (m_hint == Cell_handle()) ? m_tr.infinite_vertex()->cell() : m_hint;
+    if(m_tr.is_infinite(c))
+      c = c->neighbor(c->index(m_tr.infinite_vertex()));
+    if(c == Cell_handle())
+      return c;
+
+    Cell_handle previous;
+    for(;;)
+    {
+      const int start = m_rng.get_int(0, 4);
+      Cell_handle next;
+      bool blocked = false;
+      for(int k=0; k<4; ++k)
+      {
+        const int i = (start + k) & 3;
+        Cell_handle n = c->neighbor(i);
+        if(n == previous && n != Cell_handle())
+          continue;
+        const Point* pts[4] = { &c->vertex(0)->point(), &c->vertex(1)->point(),
+                                &c->vertex(2)->point(), &c->vertex(3)->point() };
+        pts[i] = &p;
+        if(orientation(*pts[0], *pts[1], *pts[2], *pts[3]) != NEGATIVE)
+          continue;
+        if(n == Cell_handle())
+        {
+          blocked = true;
+          continue;
+        }
+        next = n;
+        break;
+      }
+
+      if(next == Cell_handle())
+      {
+        if(blocked)
+          return c;
+        for(int j=0; j<4; ++j)
+          if(c->vertex(j)->point() == p)
+            v = c->vertex(j);
+        return c;
+      }
+      // `p` is beyond a facet of the convex hull.
+      if(m_tr.is_infinite(next))
+        return next;
+      previous = c;
+      c = next;
+    }
+  }
+
+  bool in_conflict(Cell_handle c, const Point& p) const
+  {
+    return m_tr.side_of_sphere(c, p, true) == ON_BOUNDED_SIDE;
+  }
+
+  // Approximate power of `p` with respect to the circumscribing sphere of `c`,
+  // or squared distance to the finite facet of an infinite cell, used to
+  // visit first the cells which are the closest to be in conflict with `p`.
+  double approximate_power(Cell_handle c, const Point& p) const
+  {
+    const double px = to_double(p.x()), py = to_double(p.y()), pz = to_double(p.z());
+    if(m_tr.is_infinite(c))
+    {
+      const int i = c->index(m_tr.infinite_vertex());
+      double d[3] = { -3 * px, -3 * py, -3 * pz };
+      for(int j=1; j<4; ++j)
+      {
+        const Point& q = c->vertex((i+j)&3)->point();
+        d[0] += to_double(q.x());
+        d[1] += to_double(q.y());
+        d[2] += to_double(q.z());
+      }
+      return (CGAL::square(d[0]) + CGAL::square(d[1]) + CGAL::square(d[2])) / 9;
+    }
+    std::array<double, 3> cc;
+    double squared_radius;
+    if(!approximate_circumsphere(c, cc, squared_radius))
+      return -(std::numeric_limits<double>::infinity());
+    return CGAL::square(cc[0] - px) + CGAL::square(cc[1] - py) + CGAL::square(cc[2] - pz) -
+           squared_radius;
+  }
+
+  // A vertex inserted in a box of grid cells which contains `g` and no finalized
+  // grid cell, or a default constructed handle. The box is grown from `g` by one
+  // layer of grid cells at a time on each of its sides, as long as the layer has no
+  // finalized grid cell, until a vertex is found.
+  Vertex_handle vertex_hint_around(const Grid_cell& g) const
+  {
+    const int last = int(m_resolution) - 1;
+
+    // whether the grid cells of the box `[a, b]` are not finalized
+    auto is_open = [&](const Grid_cell& a, const Grid_cell& b) -> bool
+    {
+      for(int i=a[0]; i<=b[0]; ++i)
+        for(int j=a[1]; j<=b[1]; ++j)
+          for(int k=a[2]; k<=b[2]; ++k)
+            if(m_finalized[grid_index(i, j, k)])
+              return false;
+      return true;
+    };
+
+    // a vertex inserted in the box `[a, b]`
+    auto hint_in = [&](const Grid_cell& a, const Grid_cell& b) -> Vertex_handle
+    {
+      for(int i=a[0]; i<=b[0]; ++i)
+        for(int j=a[1]; j<=b[1]; ++j)
+          for(int k=a[2]; k<=b[2]; ++k)
+          {
+            auto it = m_vertex_hints.find(grid_index(i, j, k));
+            if(it != m_vertex_hints.end())
+              return it->second;
+          }
+      return Vertex_handle();
+    };
+
+    Grid_cell lo = g, hi = g;
+    Vertex_handle hint = hint_in(lo, hi);
+    for(bool grown = true; grown && hint == Vertex_handle(); )
+    {
+      grown = false;
+      for(int d=0; d<3 && hint == Vertex_handle(); ++d)
+        for(int side=0; side<2 && hint == Vertex_handle(); ++side)
+        {
+          if((side == 0) ? (lo[d] == 0) : (hi[d] == last))
+            continue;
+          Grid_cell a = lo, b = hi;
+          a[d] = b[d] = (side == 0) ? lo[d] - 1 : hi[d] + 1;
+          if(!is_open(a, b))
+            continue;
+          ((side == 0) ? lo[d] : hi[d]) = a[d];
+          grown = true;
+          hint = hint_in(a, b);
+        }
+    }
+    return hint;
+  }
+
+  // Looks for a cell in conflict with `p` when the walk was stopped by the removed cells.
+  // A cell containing `p` remains, as its circumscribing sphere contains `p`, which is
+  // not in a finalized region. The remaining cells are visited through their facets,
+  // closest to be in conflict first, from `start`, from the cells of the bucket of
+  // the grid cell of `p`, whose spheres are close to `p`, and from the infinite cells.
+  // Returns the vertex equal to `p` in `v`, if any.
+  //
+  // If they are not connected to the cells in conflict with `p`, the search goes on
+  // from a vertex inserted in a box of grid cells which are not finalized around `p`.
+  // The cells which meet such a box are not final, and are connected through their
+  // facets: the cell containing `p` is one of them, as well as the cells incident to
+  // the vertex. If there is no such vertex, `p` is outside the convex hull (see
+  // `insert()`), and is in conflict with an infinite cell: they are never removed,
+  // and are connected to each other.
+  Cell_handle search_conflict(const Point& p, Cell_handle start, Vertex_handle& v)
+  {
+    typedef std::pair<double, Cell_handle> Queue_item;
+    struct Greater_power
+    {
+      bool operator()(const Queue_item& a, const Queue_item& b) const { return a.first > b.first; }
+    };
+    std::priority_queue<Queue_item, std::vector<Queue_item>, Greater_power> queue;
+    std::vector<Cell_handle> visited;
+    Cell_handle found;
+
+    auto push = [&](Cell_handle c)
+    {
+      if(c == Cell_handle() || c->tds_data().processed())
+        return;
+      c->tds_data().mark_processed();
+      visited.push_back(c);
+      queue.emplace(approximate_power(c, p), c);
+    };
+
+    auto search = [&]()
+    {
+      while(!queue.empty() && found == Cell_handle())
+      {
+        Cell_handle c = queue.top().second;
+        queue.pop();
+        for(int j=0; j<4; ++j)
+          if(!m_tr.is_infinite(c->vertex(j)) && c->vertex(j)->point() == p)
+            v = c->vertex(j);
+        if(v != Vertex_handle())
+          break;
+        if(in_conflict(c, p))
+          found = c;
+        else
+          for(int i=0; i<4; ++i)
+            push(c->neighbor(i));
+      }
+    };
+
+    push(start);
+    const Grid_cell gp = grid_cell(p);
+    auto bit = m_buckets.find(grid_index(gp[0], gp[1], gp[2]));
+    if(bit != m_buckets.end())
+      for(Cell_handle c : bit->second)
+        push(c);
+    push(m_tr.infinite_vertex()->cell());
+    search();
+
+    if(found == Cell_handle() && v == Vertex_handle())
+    {
+      Vertex_handle hint = vertex_hint_around(gp);
+      if(hint != Vertex_handle())
+        push(hint->cell());
+      search();
+    }
+
+    for(Cell_handle c : visited)
+      c->tds_data().clear();
+    CGAL_assertion(found != Cell_handle() || v != Vertex_handle());
+    return found;
+  }
+
+  Vertex_handle insert_in_dimension_3(const Point& p)
+  {
+    Vertex_handle v;
+    Cell_handle c = locate_in_conflict(p, v);
+    if(v != Vertex_handle())
+      return v;
+
+    if(c == Cell_handle() || !in_conflict(c, p))
+    {
+      c = search_conflict(p, c, v);
+      if(v != Vertex_handle())
+        return v;
+      CGAL_assertion(c != Cell_handle());
+    }
+
+    // Conflict zone, as in Triangulation_3::find_conflicts().
+    std::vector<Cell_handle> cells;
+    std::vector<Cell_handle> others;
+    std::vector<Facet> boundary;
+    c->tds_data().mark_in_conflict();
+    cells.push_back(c);
+    for(std::size_t k=0; k<cells.size(); ++k)
+    {
+      Cell_handle d = cells[k];
+      for(int i=0; i<4; ++i)
+      {
+        Cell_handle n = d->neighbor(i);
+        if(n == Cell_handle() || n->tds_data().is_on_boundary())
+        {
+          boundary.emplace_back(d, i);
+          continue;
+        }
+        if(n->tds_data().is_in_conflict())
+          continue;
+        if(in_conflict(n, p))
+        {
+          n->tds_data().mark_in_conflict();
+          cells.push_back(n);
+        }
+        else
+        {
+          n->tds_data().mark_on_boundary();
+          others.push_back(n);
+          boundary.emplace_back(d, i);
+        }
+      }
+    }
+
+    // Star of the new vertex, as in Triangulation_data_structure_3::create_star_3().
+    v = m_tr.tds().create_vertex();
+    v->set_point(p);
+    v->info() = m_rank;
+
+    typedef std::pair<Vertex_handle, Vertex_handle> Vertex_pair;
+    std::map<Vertex_pair, std::pair<Cell_handle, int> > open_facets;
+    std::vector<Cell_handle> new_cells;
+    for(const Facet& f : boundary)
+    {
+      Cell_handle d = f.first;
+      const int i = f.second;
+      Cell_handle nc = m_tr.tds().create_cell(d->vertex(0), d->vertex(1),
+                                              d->vertex(2), d->vertex(3));
+      nc->set_vertex(i, v);
+      Cell_handle n = d->neighbor(i);
+      if(n != Cell_handle())
+        m_tr.tds().set_adjacency(nc, i, n, n->index(d));
+
+      for(int j=0; j<4; ++j)
+      {
+        if(j == i)
+          continue;
+        d->vertex(j)->set_cell(nc);
+        // The facet of `nc` opposite to its j-th vertex contains the new vertex
+        // and the two vertices of `f` other than the j-th one.
+        Vertex_handle a = d->vertex(Triangulation::next_around_edge(i, j));
+        Vertex_handle b = d->vertex(Triangulation::next_around_edge(j, i));
+        Vertex_pair key = (a < b) ? Vertex_pair(a, b) : Vertex_pair(b, a);
+        auto it = open_facets.find(key);
+        if(it == open_facets.end())
+        {
+          open_facets.emplace(key, std::make_pair(nc, j));
+        }
+        else
+        {
+          m_tr.tds().set_adjacency(nc, j, it->second.first, it->second.second);
+          open_facets.erase(it);
+        }
+      }
+      v->set_cell(nc);
+      new_cells.push_back(nc);
+    }
+    CGAL_assertion(open_facets.empty());
+
+    for(Cell_handle n : others)
+      n->tds_data().clear();
+    for(Cell_handle d : cells)
+      remove_cell(d);
+    for(Cell_handle nc : new_cells)
+      add_cell(nc);
+    m_tr.tds().delete_cells(cells.begin(), cells.end());
+    m_hint = v->cell();
+    return v;
+  }
+
+  Triangulation            m_tr;
+  Bbox_3                   m_domain;
+  unsigned int             m_resolution;
+  double                   m_cell_size[3];
+  std::vector<bool>        m_finalized;
+  Cell_output              m_output;
+  std::size_t              m_rank;
+  size_type                m_nb_output_cells;
+  size_type                m_max_nb_cells;
+  Cell_handle              m_hint;
+  Random                   m_rng;
+
+  std::unordered_map<std::size_t, std::vector<Cell_handle> > m_buckets;
+  std::unordered_map<Cell_handle, Cell_location>             m_cell_locations;
+  // number of cells incident to each vertex
+  std::unordered_map<Vertex_handle, std::size_t>             m_vertex_degrees;
+  // the last vertex inserted in each grid cell which is not finalized
+  std::unordered_map<std::size_t, Vertex_handle>             m_vertex_hints;
+};
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_STREAMING_DELAUNAY_TRIANGULATION_3_H
@@ -66,10 +66,15 @@
 
 #ifdef CGAL_LINKED_WITH_TBB
 # include <tbb/scalable_allocator.h>
+# include <tbb/parallel_for.h>
+# include <tbb/blocked_range.h>
 #endif
 
 #include <iostream>
 #include <list>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
 #include <set>
 #include <map>
 #include <unordered_map>
@@ -281,6 +286,11 @@ public:
     {
       success = try_lock_vertex(cell_handle->vertex(iVertex), lock_radius);
     }
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+    static Profile_thread_counter failures("failed calls to try_lock_cell [Triangulation_3]");
+    if(!success)
+      ++failures;
+#endif
     return success;
   }
 
@@ -1046,6 +1056,89 @@ public:
                   could_lock_zone);
   }
 
+  // Locates the points of the range `points`, and writes for each of them,
+  // in the order of the range, a `std::tuple<Cell_handle, Locate_type, int, int>`
+  // giving the cell, `lt`, `li`, and `lj`, as the function above, to `out`.
+  // The points are spatially sorted, each one being located from the cell of
+  // the previous one. With `Parallel_tag`, the sorted points are split
+  // between threads, and the triangulation must not be modified meanwhile.
+  template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  std::enable_if_t<std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+                   std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                   OutputIterator>
+  locate(const PointRange& points, OutputIterator out, ConcurrencyTag) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef decltype(*std::begin(points)) Reference;
+    if constexpr(std::is_lvalue_reference<Reference>::value)
+    {
+      std::vector<const Point*> pts;
+      for(const Point& p : points)
+        pts.push_back(std::addressof(p));
+      return locate_points<ConcurrencyTag>(
+               pts.size(), [&](std::size_t i) -> const Point& { return *pts[i]; }, out);
+    }
+    else
+    {
+      std::vector<Point> pts(std::begin(points), std::end(points));
+      return locate_points<ConcurrencyTag>(
+               pts.size(), [&](std::size_t i) -> const Point& { return pts[i]; }, out);
+    }
+  }
+
+private:
+  template <typename ConcurrencyTag, typename PointOf, typename OutputIterator>
+  OutputIterator locate_points(std::size_t n, const PointOf& point_of, OutputIterator out) const
+  {
+    typedef std::tuple<Cell_handle, Locate_type, int, int>     Location;
+
+    // Spatial sorting can only be applied to bare points
+    typedef typename boost::result_of<const Construct_point_3(const Point&)>::type Ret;
+    auto bare_point = [&](std::size_t i) -> Ret { return construct_point(point_of(i)); };
+    typedef boost::function_property_map<decltype(bare_point), std::size_t, Ret> Pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Pmap>   Search_traits_3;
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    spatial_sort<ConcurrencyTag>(order.begin(), order.end(),
+                                 Search_traits_3(Pmap(bare_point), geom_traits()));
+
+    std::vector<Location> locations(n);
+    auto locate_sorted = [&](std::size_t begin, std::size_t end)
+    {
+      Cell_handle hint;
+      for(std::size_t k = begin; k < end; ++k)
+      {
+        Location& l = locations[order[k]];
+        hint = locate(point_of(order[k]), std::get<1>(l), std::get<2>(l), std::get<3>(l), hint);
+        std::get<0>(l) = hint;
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr(std::is_same<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, 256),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          locate_sorted(r.begin(), r.end());
+                        });
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      locate_sorted(0, n);
+    }
+
+    return std::copy(locations.begin(), locations.end(), out);
+  }
+
+public:
+
   // PREDICATES ON POINTS ``TEMPLATED'' by the geom traits
   Bounded_side side_of_tetrahedron(const Point& p,
                                    const Point& p0, const Point& p1,
@@ -1348,6 +1441,12 @@ protected:
 
     CGAL_precondition(tester(d));
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+    static Profile_thread_histogram_counter zone_sizes(
+      "number of cells of the conflict zone [Triangulation_3::find_conflicts]");
+    unsigned nb_cells = 1;
+#endif
+
     // To store the boundary cells, in case we need to rollback
     typedef boost::container::small_vector<Cell_handle,64> SV;
     SV sv;
@@ -1417,6 +1516,9 @@ protected:
             cell_stack.push(test);
             test->tds_data().mark_in_conflict();
             *it.second++ = test;
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+            ++nb_cells;
+#endif
             continue;
           }
 
@@ -1437,6 +1539,10 @@ protected:
     }
     while(!cell_stack.empty());
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+    zone_sizes(nb_cells);
+#endif
+
     return it;
   }
 
@@ -2889,11 +2995,20 @@ exact_locate(const Point& p, Locate_type& lt, int& li, int& lj,
       boost::uniform_smallint<> four(0, 3);
       boost::variate_generator<boost::rand48&, boost::uniform_smallint<> > die4(rng, four);
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+      static Profile_thread_histogram_counter walk_lengths(
+        "number of cells visited by the walk [Triangulation_3::exact_locate]");
+      unsigned nb_visited_cells = 0;
+#endif
+
       // Now treat the cell c.
       bool try_next_cell = true;
       while(try_next_cell)
       {
         try_next_cell = false;
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+        ++nb_visited_cells;
+#endif
 
         // We know that the 4 vertices of c are positively oriented.
         // So, in order to test if p is seen outside from one of c's facets,
@@ -2936,6 +3051,9 @@ exact_locate(const Point& p, Locate_type& lt, int& li, int& lj,
               {
                 // We are outside the convex hull.
                 lt = OUTSIDE_CONVEX_HULL;
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+                walk_lengths(nb_visited_cells + 1);
+#endif
                 return next;
               }
               previous = c;
@@ -2956,6 +3074,10 @@ exact_locate(const Point& p, Locate_type& lt, int& li, int& lj,
         } // next vertex
       } // next cell
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+      walk_lengths(nb_visited_cells);
+#endif
+
       // now p is in c or on its boundary
       int sum =(o[0] == COPLANAR)
           +(o[1] == COPLANAR)
@@ -3226,6 +3348,12 @@ inexact_locate(const Point& t, Cell_handle start, int n_of_turns,
     }
   }
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+  static Profile_thread_histogram_counter walk_lengths(
+    "number of cells visited by the walk [Triangulation_3::inexact_locate]");
+  const int max_n_of_turns = n_of_turns;
+#endif
+
   // Now treat the cell c.
 try_next_cell:
   n_of_turns--;
@@ -3257,6 +3385,9 @@ try_next_cell:
     if(next->has_vertex(infinite))
     {
       // We are outside the convex hull.
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+      walk_lengths(max_n_of_turns - n_of_turns + 1);
+#endif
       return next;
     }
 
@@ -3276,6 +3407,9 @@ try_next_cell:
     if(n_of_turns) goto try_next_cell;
   }
 
+#ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+  walk_lengths(max_n_of_turns - n_of_turns);
+#endif
   return c;
 }
 #endif // no CGAL_NO_STRUCTURAL_FILTERING
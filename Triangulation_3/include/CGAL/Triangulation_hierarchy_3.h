@@ -50,6 +50,7 @@
 #include <boost/mpl/identity.hpp>
 
 #include <array>
+#include <type_traits>
 #include <CGAL/array.h>
 
 #endif //CGAL_TRIANGULATION_3_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
@@ -429,6 +430,18 @@ public:
 
   Cell_handle locate(const Point& p, Cell_handle start = Cell_handle ()) const;
 
+  // The batched location of the base triangulation: as the points are
+  // spatially sorted, each point is located from the cell of the previous one,
+  // without using the upper levels of the hierarchy.
+  template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+  std::enable_if_t<std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+                   std::is_same<ConcurrencyTag, Parallel_tag>::value,
+                   OutputIterator>
+  locate(const PointRange& points, OutputIterator out, ConcurrencyTag tag) const
+  {
+    return Tr_Base::locate(points, out, tag);
+  }
+
   Vertex_handle
   nearest_vertex(const Point& p, Cell_handle start = Cell_handle()) const;
 
@@ -0,0 +1,70 @@
+// Checks that the triangulations compile and run with the profiling counters
+// enabled by CGAL_CONCURRENT_TRIANGULATION_3_PROFILING.
+#define CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <cassert>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef K::Weighted_point_3                                      Weighted_point;
+
+template <class Tr>
+void test(const std::vector<typename Tr::Point>& points,
+          typename Tr::Lock_data_structure* lock_ds = nullptr)
+{
+  Tr tr(points.begin(), points.end(), lock_ds);
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == points.size());
+
+  // point location, through both walks
+  CGAL::Random_points_in_cube_3<Point> queries(1.);
+  for(int i=0; i<100; ++i)
+  {
+    const Point q = *queries++;
+    typename Tr::Cell_handle c = tr.locate(typename Tr::Point(q));
+    assert(c != typename Tr::Cell_handle());
+    c = tr.inexact_locate(typename Tr::Point(q));
+    assert(c != typename Tr::Cell_handle());
+  }
+}
+
+int main()
+{
+  CGAL::Random_points_in_cube_3<Point> rnd(1.);
+  std::vector<Point> points;
+  std::vector<Weighted_point> weighted_points;
+  for(int i=0; i<1000; ++i)
+  {
+    points.push_back(*rnd++);
+    weighted_points.push_back(Weighted_point(points.back(), 0.));
+  }
+
+  test<CGAL::Delaunay_triangulation_3<K> >(points);
+  test<CGAL::Regular_triangulation_3<K> >(weighted_points);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Triangulation_data_structure_3<
+    CGAL::Triangulation_vertex_base_3<K>,
+    CGAL::Delaunay_triangulation_cell_base_3<K>,
+    CGAL::Parallel_tag>                                          Tds;
+  typedef CGAL::Delaunay_triangulation_3<K, Tds>                 Parallel_DT3;
+
+  typedef CGAL::Regular_triangulation_vertex_base_3<K>           Rvb;
+  typedef CGAL::Regular_triangulation_cell_base_3<K>             Rcb;
+  typedef CGAL::Triangulation_data_structure_3<Rvb, Rcb, CGAL::Parallel_tag> Rtds;
+  typedef CGAL::Regular_triangulation_3<K, Rtds>                 Parallel_RT3;
+
+  Parallel_DT3::Lock_data_structure dt_locks(CGAL::Bbox_3(-1., -1., -1., 1, 1, 1), 50);
+  test<Parallel_DT3>(points, &dt_locks);
+  Parallel_RT3::Lock_data_structure rt_locks(CGAL::Bbox_3(-1., -1., -1., 1, 1, 1), 50);
+  test<Parallel_RT3>(weighted_points, &rt_locks);
+#endif
+
+  return 0;
+}
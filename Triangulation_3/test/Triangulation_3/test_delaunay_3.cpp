@@ -19,6 +19,8 @@
 #include <CGAL/Triangulation_vertex_base_3.h>
 #include <CGAL/Delaunay_triangulation_cell_base_3.h>
 #include <CGAL/Delaunay_triangulation_cell_base_with_circumcenter_3.h>
+#include <CGAL/Triangulation_ds_indexed_vertex_base_3.h>
+#include <CGAL/Triangulation_ds_indexed_cell_base_3.h>
 
 bool del=true;
 
@@ -45,6 +47,17 @@ int main()
 
   _test_cls_delaunay_3( Cls_with_Delaunay_Cb() );
 
+  // Vertices and cells referring to each other with 32-bit indices.
+  typedef CGAL::Triangulation_data_structure_3<
+    CGAL::Triangulation_vertex_base_3<EPIC,
+      CGAL::Triangulation_ds_indexed_vertex_base_3<> >,
+    CGAL::Delaunay_triangulation_cell_base_3<EPIC,
+      CGAL::Triangulation_cell_base_3<EPIC,
+        CGAL::Triangulation_ds_indexed_cell_base_3<> > > >   Tds_indexed;
+  typedef CGAL::Delaunay_triangulation_3<EPIC, Tds_indexed> Cls_indexed;
+
+  _test_cls_delaunay_3( Cls_indexed() );
+
 #ifdef CGAL_LINKED_WITH_TBB
   typedef CGAL::Spatial_lock_grid_3<
     CGAL::Tag_priority_blocking>                      Lock_ds;
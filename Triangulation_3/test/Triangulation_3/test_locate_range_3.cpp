@@ -0,0 +1,134 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/Triangulation_hierarchy_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/Iterator_range.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef K::Weighted_point_3                                      Weighted_point;
+
+template <class Tr, class Tag, class PointRange>
+void test_locate_range(const Tr& tr, const PointRange& queries)
+{
+  typedef typename Tr::Cell_handle                               Cell_handle;
+  typedef typename Tr::Locate_type                               Locate_type;
+  typedef std::tuple<Cell_handle, Locate_type, int, int>         Location;
+
+  std::vector<Location> locations;
+  tr.locate(queries, std::back_inserter(locations), Tag());
+  assert(locations.size() == std::size(queries));
+
+  std::size_t k = 0;
+  for(const auto& q : queries)
+  {
+    Locate_type lt;
+    int li, lj;
+    Cell_handle c = tr.locate(q, lt, li, lj);
+    const Location& l = locations[k++];
+    assert(std::get<1>(l) == lt);
+    switch(lt)
+    {
+    case Tr::VERTEX:
+      assert(std::get<0>(l)->vertex(std::get<2>(l)) == c->vertex(li));
+      break;
+    case Tr::CELL:
+      assert(std::get<0>(l) == c);
+      break;
+    case Tr::OUTSIDE_CONVEX_HULL:
+      assert(tr.is_infinite(std::get<0>(l)));
+      break;
+    default:
+      assert(std::get<0>(l)->has_vertex(c->vertex(li)) ||
+             std::get<0>(l)->has_vertex(c->vertex((li+1)&3)));
+    }
+  }
+}
+
+template <class Tag>
+void test(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  typedef CGAL::Delaunay_triangulation_3<K>                      Delaunay;
+  typedef CGAL::Regular_triangulation_3<K>                       Regular;
+
+  Delaunay dt(points.begin(), points.end());
+  test_locate_range<Delaunay, Tag>(dt, queries);
+
+  // a range whose iterator does not return references
+  auto translate = [](const Point& p) { return Point(p.x() + 0.125, p.y(), p.z()); };
+  auto first = boost::make_transform_iterator(queries.begin(), translate);
+  auto last = boost::make_transform_iterator(queries.end(), translate);
+  std::vector<Point> translated(first, last);
+  std::vector<Delaunay::Cell_handle> cells;
+  dt.locate(CGAL::make_range(first, last),
+            boost::make_function_output_iterator(
+              [&](const std::tuple<Delaunay::Cell_handle, Delaunay::Locate_type, int, int>& l)
+              { cells.push_back(std::get<0>(l)); }),
+            Tag());
+  assert(cells.size() == translated.size());
+  for(std::size_t i=0; i<translated.size(); ++i)
+  {
+    Delaunay::Locate_type lt;
+    int li, lj;
+    assert(dt.is_infinite(cells[i]) ||
+           dt.side_of_cell(translated[i], cells[i], lt, li, lj) != CGAL::ON_UNBOUNDED_SIDE);
+  }
+
+  // the hierarchy gives the batched location of its base triangulation
+  typedef CGAL::Triangulation_vertex_base_3<K>                   Vbb;
+  typedef CGAL::Triangulation_hierarchy_vertex_base_3<Vbb>       Hvb;
+  typedef CGAL::Delaunay_triangulation_cell_base_3<K>            Cb;
+  typedef CGAL::Triangulation_data_structure_3<Hvb, Cb>          Tds;
+  typedef CGAL::Triangulation_hierarchy_3<
+            CGAL::Delaunay_triangulation_3<K, Tds> >             Hierarchy;
+  Hierarchy dh(points.begin(), points.end());
+  test_locate_range<Hierarchy, Tag>(dh, queries);
+
+  std::vector<Weighted_point> wpoints, wqueries;
+  CGAL::Random rnd(1);
+  for(const Point& p : points)
+    wpoints.emplace_back(p, rnd.get_double(0, 0.001));
+  for(const Point& q : queries)
+    wqueries.emplace_back(q, 0);
+  Regular rt(wpoints.begin(), wpoints.end());
+  test_locate_range<Regular, Tag>(rt, wqueries);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_cube_3<Point> gen(1., rnd);
+  std::vector<Point> points, queries;
+  for(int i=0; i<5000; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i<20000; ++i)
+    queries.emplace_back(1.2 * gen->x(), 1.2 * gen->y(), 1.2 * (gen++)->z());
+  // vertices, and points on edges
+  for(int i=0; i<1000; ++i)
+  {
+    queries.push_back(points[i]);
+    queries.push_back(CGAL::midpoint(points[i], points[i+1]));
+  }
+
+  std::cout << "Sequential location" << std::endl;
+  test<CGAL::Sequential_tag>(points, queries);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel location" << std::endl;
+  test<CGAL::Parallel_tag>(points, queries);
+#endif
+
+  return 0;
+}
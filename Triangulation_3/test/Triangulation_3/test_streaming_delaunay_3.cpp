@@ -0,0 +1,189 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Streaming_Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef CGAL::Streaming_Delaunay_triangulation_3<K>              Streaming_DT;
+
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL::Triangulation_vertex_base_with_info_3<std::size_t, K>,
+  CGAL::Delaunay_triangulation_cell_base_3<K> >                  Tds;
+typedef CGAL::Delaunay_triangulation_3<K, Tds>                   Delaunay;
+
+typedef std::array<std::size_t, 4>                               Tet;
+
+template <class Cell_handle>
+Tet tet(Cell_handle c)
+{
+  Tet t = {{ c->vertex(0)->info(), c->vertex(1)->info(),
+             c->vertex(2)->info(), c->vertex(3)->info() }};
+  std::sort(t.begin(), t.end());
+  return t;
+}
+
+void test(const std::vector<Point>& points, int nb_slabs, unsigned int resolution)
+{
+  // Reference triangulation.
+  std::vector<std::pair<Point, std::size_t> > indexed;
+  for(std::size_t i=0; i<points.size(); ++i)
+    indexed.emplace_back(points[i], i);
+  Delaunay dt(indexed.begin(), indexed.end());
+  std::vector<Tet> expected;
+  for(Delaunay::Cell_handle c : dt.finite_cell_handles())
+    expected.push_back(tet(c));
+  std::sort(expected.begin(), expected.end());
+
+  // The points are given in slabs along x, and each slab is finalized
+  // once the next one has been inserted.
+  std::vector<Tet> output;
+  Streaming_DT sdt(CGAL::Bbox_3(0, 0, 0, 1, 1, 1), resolution,
+                   [&](Streaming_DT::Cell_handle c) { output.push_back(tet(c)); });
+
+  std::vector<std::vector<std::size_t> > slabs(nb_slabs);
+  for(std::size_t i=0; i<points.size(); ++i)
+    slabs[(std::min)(int(points[i].x() * nb_slabs), nb_slabs - 1)].push_back(i);
+
+  // The ranks of the streaming triangulation follow the order of the slabs.
+  std::vector<std::size_t> original;
+  for(int s=0; s<nb_slabs; ++s)
+  {
+    std::vector<Point> slab;
+    for(std::size_t i : slabs[s])
+    {
+      slab.push_back(points[i]);
+      original.push_back(i);
+    }
+    sdt.insert(slab.begin(), slab.end());
+    if(s > 0)
+      sdt.finalize(CGAL::Bbox_3(-1, -1, -1, double(s) / nb_slabs, 2, 2));
+  }
+  const std::size_t nb_before_flush = sdt.number_of_output_cells();
+  sdt.finalize();
+
+  for(Tet& t : output)
+  {
+    for(std::size_t& i : t)
+      i = original[i];
+    std::sort(t.begin(), t.end());
+  }
+  std::sort(output.begin(), output.end());
+
+  std::cout << points.size() << " points, " << nb_slabs << " slabs: "
+            << output.size() << " cells, " << nb_before_flush << " streamed, at most "
+            << sdt.maximal_number_of_cells() << " cells in memory" << std::endl;
+
+  assert(sdt.number_of_output_cells() == output.size());
+  assert(output == expected);
+  if(nb_slabs > 4)
+  {
+    assert(nb_before_flush > output.size() / 2);
+    assert(sdt.maximal_number_of_cells() < dt.tds().number_of_cells());
+  }
+}
+
+// Some points are inserted in a pocket of the domain once all the rest of the domain
+// is finalized: the remaining cells around the pocket may not be connected to the
+// other remaining cells.
+void test_pocket(const std::vector<Point>& points)
+{
+  std::vector<std::pair<Point, std::size_t> > indexed;
+  for(std::size_t i=0; i<points.size(); ++i)
+    indexed.emplace_back(points[i], i);
+  Delaunay dt(indexed.begin(), indexed.end());
+  std::vector<Tet> expected;
+  for(Delaunay::Cell_handle c : dt.finite_cell_handles())
+    expected.push_back(tet(c));
+  std::sort(expected.begin(), expected.end());
+
+  auto in_pocket = [](const Point& p)
+  {
+    return p.x() > 0.375 && p.x() < 0.625 && p.y() > 0.375 && p.y() < 0.625 &&
+           p.z() > 0.375 && p.z() < 0.625;
+  };
+
+  std::vector<Tet> output;
+  Streaming_DT sdt(CGAL::Bbox_3(0, 0, 0, 1, 1, 1), 8,
+                   [&](Streaming_DT::Cell_handle c) { output.push_back(tet(c)); });
+
+  // The points outside the pocket and half of the points of the pocket, except the
+  // ones of its last grid cell, then the points of this grid cell, and the other half.
+  std::vector<std::size_t> original;
+  for(int pass=0; pass<3; ++pass)
+  {
+    for(std::size_t i=0; i<points.size(); ++i)
+    {
+      const Point& p = points[i];
+      const bool in_last_grid_cell = in_pocket(p) && p.x() > 0.5 && p.y() > 0.5 && p.z() > 0.5;
+      const int point_pass = in_last_grid_cell ? 1 : (!in_pocket(p) || i % 2 == 0) ? 0 : 2;
+      if(point_pass == pass)
+      {
+        sdt.insert(p);
+        original.push_back(i);
+      }
+    }
+    if(pass == 0)
+    {
+      sdt.finalize(CGAL::Bbox_3(-1, -1, -1, 0.375, 2, 2));
+      sdt.finalize(CGAL::Bbox_3(0.625, -1, -1, 2, 2, 2));
+      sdt.finalize(CGAL::Bbox_3(-1, -1, -1, 2, 0.375, 2));
+      sdt.finalize(CGAL::Bbox_3(-1, 0.625, -1, 2, 2, 2));
+      sdt.finalize(CGAL::Bbox_3(-1, -1, -1, 2, 2, 0.375));
+      sdt.finalize(CGAL::Bbox_3(-1, -1, 0.625, 2, 2, 2));
+    }
+  }
+  const std::size_t nb_before_flush = sdt.number_of_output_cells();
+  sdt.finalize();
+
+  for(Tet& t : output)
+  {
+    for(std::size_t& i : t)
+      i = original[i];
+    std::sort(t.begin(), t.end());
+  }
+  std::sort(output.begin(), output.end());
+
+  std::cout << points.size() << " points, pocket: " << output.size() << " cells, "
+            << nb_before_flush << " streamed" << std::endl;
+
+  assert(output == expected);
+  assert(nb_before_flush > output.size() / 2);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_cube_3<Point> gen(0.5, rnd);
+  std::vector<Point> points;
+  for(int i=0; i<20000; ++i)
+  {
+    const Point p = *gen++;
+    points.emplace_back(p.x() + 0.5, p.y() + 0.5, p.z() + 0.5);
+  }
+
+  test(points, 1, 4);
+  test(points, 8, 8);
+  test(points, 16, 32);
+  test_pocket(points);
+
+  // Points on a grid: many cospherical points.
+  std::vector<Point> grid;
+  for(int i=0; i<12; ++i)
+    for(int j=0; j<12; ++j)
+      for(int k=0; k<12; ++k)
+        grid.emplace_back((i + 0.5) / 12, (j + 0.5) / 12, (k + 0.5) / 12);
+  std::vector<Point> grid_points = grid;
+  CGAL::cpp98::random_shuffle(grid_points.begin(), grid_points.end(), rnd);
+  test(grid_points, 6, 12);
+
+  return 0;
+}